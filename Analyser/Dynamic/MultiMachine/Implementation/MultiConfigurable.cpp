@@ -22,10 +22,13 @@ class MultiStruct: public Reflection::Struct {
 			}
 		}
 
-		void apply() {
+		/// Applies these options to every one of the original devices that remains within @c devices.
+		void apply(const std::vector<Configurable::Device *> &devices) {
 			auto options = options_.begin();
 			for(auto device: devices_) {
-				device->set_options(*options);
+				if(std::find(devices.begin(), devices.end(), device) != devices.end()) {
+					device->set_options(*options);
+				}
 				++options;
 			}
 		}
@@ -97,13 +100,14 @@ class MultiStruct: public Reflection::Struct {
 		}
 
 	private:
-		const std::vector<Configurable::Device *> &devices_;
+		const std::vector<Configurable::Device *> devices_;
 		std::vector<std::unique_ptr<Reflection::Struct>> options_;
 };
 
 }
 
-MultiConfigurable::MultiConfigurable(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines) {
+MultiConfigurable::MultiConfigurable(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex) :
+	machines_mutex_(machines_mutex) {
 	for(const auto &machine: machines) {
 		Configurable::Device *device = machine->configurable_device();
 		if(device) devices_.push_back(device);
@@ -112,9 +116,17 @@ MultiConfigurable::MultiConfigurable(const std::vector<std::unique_ptr<::Machine
 
 void MultiConfigurable::set_options(const std::unique_ptr<Reflection::Struct> &str) {
 	const auto options = dynamic_cast<MultiStruct *>(str.get());
-	options->apply();
+	std::lock_guard machines_lock(machines_mutex_);
+	options->apply(devices_);
 }
 
 std::unique_ptr<Reflection::Struct> MultiConfigurable::get_options() {
+	std::lock_guard machines_lock(machines_mutex_);
 	return std::make_unique<MultiStruct>(devices_);
 }
+
+void MultiConfigurable::will_remove_machine(::Machine::DynamicMachine *machine) {
+	const auto device = machine->configurable_device();
+	std::lock_guard machines_lock(machines_mutex_);
+	devices_.erase(std::remove(devices_.begin(), devices_.end(), device), devices_.end());
+}
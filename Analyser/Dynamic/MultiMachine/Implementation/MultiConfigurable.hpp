@@ -13,6 +13,7 @@
 #include "../../../../Configurable/Configurable.hpp"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Analyser::Dynamic {
@@ -20,19 +21,23 @@ namespace Analyser::Dynamic {
 /*!
 	Provides a class that multiplexes the configurable interface to multiple machines.
 
-	Makes a static internal copy of the list of machines; makes no guarantees about the
-	order of delivered messages.
+	Makes a static internal copy of the list of machines, guarded by the owner's mutex; makes
+	no guarantees about the order of delivered messages.
 */
 class MultiConfigurable: public Configurable::Device {
 	public:
-		MultiConfigurable(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines);
+		MultiConfigurable(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex);
 
 		// Below is the standard Configurable::Device interface; see there for documentation.
 		void set_options(const std::unique_ptr<Reflection::Struct> &options) final;
 		std::unique_ptr<Reflection::Struct> get_options() final;
 
+		/// Ceases to forward to @c machine, in preparation for its destruction.
+		void will_remove_machine(::Machine::DynamicMachine *machine);
+
 	private:
 		std::vector<Configurable::Device *> devices_;
+		std::recursive_mutex &machines_mutex_;
 };
 
 }
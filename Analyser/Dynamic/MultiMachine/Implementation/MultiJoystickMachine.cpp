@@ -16,7 +16,8 @@ namespace {
 
 class MultiJoystick: public Inputs::Joystick {
 	public:
-		MultiJoystick(std::vector<MachineTypes::JoystickMachine *> &machines, std::size_t index) {
+		MultiJoystick(std::vector<MachineTypes::JoystickMachine *> &machines, std::size_t index, std::recursive_mutex &machines_mutex) :
+			machines_mutex_(machines_mutex) {
 			for(const auto &machine: machines) {
 				const auto &joysticks = machine->get_joysticks();
 				if(joysticks.size() >= index) {
@@ -26,6 +27,7 @@ class MultiJoystick: public Inputs::Joystick {
 		}
 
 		const std::vector<Input> &get_inputs() final {
+			std::lock_guard machines_lock(machines_mutex_);
 			if(inputs.empty()) {
 				for(const auto &joystick: joysticks_) {
 					std::vector<Input> joystick_inputs = joystick->get_inputs();
@@ -41,31 +43,43 @@ class MultiJoystick: public Inputs::Joystick {
 		}
 
 		void set_input(const Input &digital_input, bool is_active) final {
+			std::lock_guard machines_lock(machines_mutex_);
 			for(const auto &joystick: joysticks_) {
 				joystick->set_input(digital_input, is_active);
 			}
 		}
 
 		void set_input(const Input &digital_input, float value) final {
+			std::lock_guard machines_lock(machines_mutex_);
 			for(const auto &joystick: joysticks_) {
 				joystick->set_input(digital_input, value);
 			}
 		}
 
 		void reset_all_inputs() final {
+			std::lock_guard machines_lock(machines_mutex_);
 			for(const auto &joystick: joysticks_) {
 				joystick->reset_all_inputs();
 			}
 		}
 
+		/// Ceases to forward to any of @c joysticks.
+		void remove(const std::vector<std::unique_ptr<Inputs::Joystick>> &joysticks) {
+			std::lock_guard machines_lock(machines_mutex_);
+			for(const auto &joystick: joysticks) {
+				joysticks_.erase(std::remove(joysticks_.begin(), joysticks_.end(), joystick.get()), joysticks_.end());
+			}
+		}
+
 	private:
 		std::vector<Input> inputs;
 		std::vector<Inputs::Joystick *> joysticks_;
+		std::recursive_mutex &machines_mutex_;
 };
 
 }
 
-MultiJoystickMachine::MultiJoystickMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines) {
+MultiJoystickMachine::MultiJoystickMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex) {
 	std::size_t total_joysticks = 0;
 	std::vector<MachineTypes::JoystickMachine *> joystick_machines;
 	for(const auto &machine: machines) {
@@ -77,10 +91,19 @@ MultiJoystickMachine::MultiJoystickMachine(const std::vector<std::unique_ptr<::M
 	}
 
 	for(std::size_t index = 0; index < total_joysticks; ++index) {
-		joysticks_.emplace_back(new MultiJoystick(joystick_machines, index));
+		joysticks_.emplace_back(new MultiJoystick(joystick_machines, index, machines_mutex));
 	}
 }
 
 const std::vector<std::unique_ptr<Inputs::Joystick>> &MultiJoystickMachine::get_joysticks() {
 	return joysticks_;
 }
+
+void MultiJoystickMachine::will_remove_machine(::Machine::DynamicMachine *machine) {
+	const auto joystick_machine = machine->joystick_machine();
+	if(!joystick_machine) return;
+
+	for(const auto &joystick: joysticks_) {
+		static_cast<MultiJoystick *>(joystick.get())->remove(joystick_machine->get_joysticks());
+	}
+}
@@ -12,6 +12,7 @@
 #include "../../../../Machines/DynamicMachine.hpp"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Analyser::Dynamic {
@@ -19,16 +20,19 @@ namespace Analyser::Dynamic {
 /*!
 	Provides a class that multiplexes the joystick machine interface to multiple machines.
 
-	Makes a static internal copy of the list of machines; makes no guarantees about the
-	order of delivered messages.
+	Makes a static internal copy of the list of machines, guarded by the owner's mutex; makes
+	no guarantees about the order of delivered messages.
 */
 class MultiJoystickMachine: public MachineTypes::JoystickMachine {
 	public:
-		MultiJoystickMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines);
+		MultiJoystickMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex);
 
 		// Below is the standard JoystickMachine::Machine interface; see there for documentation.
 		const std::vector<std::unique_ptr<Inputs::Joystick>> &get_joysticks() final;
 
+		/// Ceases to forward to @c machine, in preparation for its destruction.
+		void will_remove_machine(::Machine::DynamicMachine *machine);
+
 	private:
 		std::vector<std::unique_ptr<Inputs::Joystick>> joysticks_;
 };
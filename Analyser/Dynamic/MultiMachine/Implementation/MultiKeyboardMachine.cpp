@@ -8,35 +8,42 @@
 
 #include "MultiKeyboardMachine.hpp"
 
+#include <algorithm>
+
 using namespace Analyser::Dynamic;
 
-MultiKeyboardMachine::MultiKeyboardMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines) {
+MultiKeyboardMachine::MultiKeyboardMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex) :
+	machines_mutex_(machines_mutex) {
 	for(const auto &machine: machines) {
 		auto keyboard_machine = machine->keyboard_machine();
 		if(keyboard_machine) machines_.push_back(keyboard_machine);
 	}
-	keyboard_ = std::make_unique<MultiKeyboard>(machines_);
+	keyboard_ = std::make_unique<MultiKeyboard>(machines_, machines_mutex_);
 }
 
 void MultiKeyboardMachine::clear_all_keys() {
+	std::lock_guard machines_lock(machines_mutex_);
 	for(const auto &machine: machines_) {
 		machine->clear_all_keys();
 	}
 }
 
 void MultiKeyboardMachine::set_key_state(uint16_t key, bool is_pressed) {
+	std::lock_guard machines_lock(machines_mutex_);
 	for(const auto &machine: machines_) {
 		machine->set_key_state(key, is_pressed);
 	}
 }
 
 void MultiKeyboardMachine::type_string(const std::string &string) {
+	std::lock_guard machines_lock(machines_mutex_);
 	for(const auto &machine: machines_) {
 		machine->type_string(string);
 	}
 }
 
 bool MultiKeyboardMachine::can_type(char c) const {
+	std::lock_guard machines_lock(machines_mutex_);
 	bool can_type = true;
 	for(const auto &machine: machines_) {
 		can_type &= machine->can_type(c);
@@ -48,8 +55,14 @@ Inputs::Keyboard &MultiKeyboardMachine::get_keyboard() {
 	return *keyboard_;
 }
 
-MultiKeyboardMachine::MultiKeyboard::MultiKeyboard(const std::vector<::MachineTypes::KeyboardMachine *> &machines)
-	: machines_(machines) {
+void MultiKeyboardMachine::will_remove_machine(::Machine::DynamicMachine *machine) {
+	const auto keyboard_machine = machine->keyboard_machine();
+	std::lock_guard machines_lock(machines_mutex_);
+	machines_.erase(std::remove(machines_.begin(), machines_.end(), keyboard_machine), machines_.end());
+}
+
+MultiKeyboardMachine::MultiKeyboard::MultiKeyboard(const std::vector<::MachineTypes::KeyboardMachine *> &machines, std::recursive_mutex &machines_mutex)
+	: machines_(machines), machines_mutex_(machines_mutex) {
 	for(const auto &machine: machines_) {
 		observed_keys_.insert(machine->get_keyboard().observed_keys().begin(), machine->get_keyboard().observed_keys().end());
 		is_exclusive_ |= machine->get_keyboard().is_exclusive();
@@ -57,6 +70,7 @@ MultiKeyboardMachine::MultiKeyboard::MultiKeyboard(const std::vector<::MachineTy
 }
 
 bool MultiKeyboardMachine::MultiKeyboard::set_key_pressed(Key key, char value, bool is_pressed) {
+	std::lock_guard machines_lock(machines_mutex_);
 	bool was_consumed = false;
 	for(const auto &machine: machines_) {
 		was_consumed |= machine->get_keyboard().set_key_pressed(key, value, is_pressed);
@@ -65,6 +79,7 @@ bool MultiKeyboardMachine::MultiKeyboard::set_key_pressed(Key key, char value, b
 }
 
 void MultiKeyboardMachine::MultiKeyboard::reset_all_keys() {
+	std::lock_guard machines_lock(machines_mutex_);
 	for(const auto &machine: machines_) {
 		machine->get_keyboard().reset_all_keys();
 	}
@@ -13,6 +13,7 @@
 #include "../../../../Machines/KeyboardMachine.hpp"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Analyser::Dynamic {
@@ -20,16 +21,17 @@ namespace Analyser::Dynamic {
 /*!
 	Provides a class that multiplexes the keyboard machine interface to multiple machines.
 
-	Makes a static internal copy of the list of machines; makes no guarantees about the
-	order of delivered messages.
+	Makes a static internal copy of the list of machines, guarded by the owner's mutex; makes
+	no guarantees about the order of delivered messages.
 */
 class MultiKeyboardMachine: public MachineTypes::KeyboardMachine {
 	private:
 		std::vector<MachineTypes::KeyboardMachine *> machines_;
+		std::recursive_mutex &machines_mutex_;
 
 		class MultiKeyboard: public Inputs::Keyboard {
 			public:
-				MultiKeyboard(const std::vector<MachineTypes::KeyboardMachine *> &machines);
+				MultiKeyboard(const std::vector<MachineTypes::KeyboardMachine *> &machines, std::recursive_mutex &machines_mutex);
 
 				bool set_key_pressed(Key key, char value, bool is_pressed) final;
 				void reset_all_keys() final;
@@ -38,13 +40,14 @@ class MultiKeyboardMachine: public MachineTypes::KeyboardMachine {
 
 			private:
 				const std::vector<MachineTypes::KeyboardMachine *> &machines_;
+				std::recursive_mutex &machines_mutex_;
 				std::set<Key> observed_keys_;
 				bool is_exclusive_ = false;
 		};
 		std::unique_ptr<MultiKeyboard> keyboard_;
 
 	public:
-		MultiKeyboardMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines);
+		MultiKeyboardMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex);
 
 		// Below is the standard KeyboardMachine::Machine interface; see there for documentation.
 		void clear_all_keys() final;
@@ -52,6 +55,9 @@ class MultiKeyboardMachine: public MachineTypes::KeyboardMachine {
 		void type_string(const std::string &) final;
 		bool can_type(char c) const final;
 		Inputs::Keyboard &get_keyboard() final;
+
+		/// Ceases to forward to @c machine, in preparation for its destruction.
+		void will_remove_machine(::Machine::DynamicMachine *machine);
 };
 
 }
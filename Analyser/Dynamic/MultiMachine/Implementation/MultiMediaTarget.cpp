@@ -8,9 +8,12 @@
 
 #include "MultiMediaTarget.hpp"
 
+#include <algorithm>
+
 using namespace Analyser::Dynamic;
 
-MultiMediaTarget::MultiMediaTarget(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines) {
+MultiMediaTarget::MultiMediaTarget(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex) :
+	machines_mutex_(machines_mutex) {
 	for(const auto &machine: machines) {
 		auto media_target = machine->media_target();
 		if(media_target) targets_.push_back(media_target);
@@ -18,9 +21,16 @@ MultiMediaTarget::MultiMediaTarget(const std::vector<std::unique_ptr<::Machine::
 }
 
 bool MultiMediaTarget::insert_media(const Analyser::Static::Media &media) {
+	std::lock_guard machines_lock(machines_mutex_);
 	bool inserted = false;
 	for(const auto &target : targets_) {
 		inserted |= target->insert_media(media);
 	}
 	return inserted;
 }
+
+void MultiMediaTarget::will_remove_machine(::Machine::DynamicMachine *machine) {
+	const auto media_target = machine->media_target();
+	std::lock_guard machines_lock(machines_mutex_);
+	targets_.erase(std::remove(targets_.begin(), targets_.end(), media_target), targets_.end());
+}
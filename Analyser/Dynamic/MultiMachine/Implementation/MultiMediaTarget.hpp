@@ -13,6 +13,7 @@
 #include "../../../../Machines/DynamicMachine.hpp"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Analyser::Dynamic {
@@ -20,18 +21,22 @@ namespace Analyser::Dynamic {
 /*!
 	Provides a class that multiplexes the media target interface to multiple machines.
 
-	Makes a static internal copy of the list of machines; makes no guarantees about the
-	order of delivered messages.
+	Makes a static internal copy of the list of machines, guarded by the owner's mutex; makes
+	no guarantees about the order of delivered messages.
 */
 struct MultiMediaTarget: public MachineTypes::MediaTarget {
 	public:
-		MultiMediaTarget(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines);
+		MultiMediaTarget(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex);
 
 		// Below is the standard MediaTarget::Machine interface; see there for documentation.
 		bool insert_media(const Analyser::Static::Media &media) final;
 
+		/// Ceases to forward to @c machine, in preparation for its destruction.
+		void will_remove_machine(::Machine::DynamicMachine *machine);
+
 	private:
 		std::vector<MachineTypes::MediaTarget *> targets_;
+		std::recursive_mutex &machines_mutex_;
 };
 
 }
@@ -79,9 +79,26 @@ void MultiScanProducer::did_change_machine_order() {
 	if(machine) machine->set_scan_target(scan_target_);
 }
 
+void MultiScanProducer::will_remove_machine(::Machine::DynamicMachine *machine) {
+	std::lock_guard machines_lock(machines_mutex_);
+	const auto scan_producer = machine->scan_producer();
+	if(!scan_producer) return;
+
+	// If the machine being removed is currently outputting, announce the change of owner
+	// and pass the scan target to whichever machine will be frontmost once it has gone.
+	const bool is_front = machines_.front().get() == machine;
+	if(is_front && scan_target_) scan_target_->will_change_owner();
+	scan_producer->set_scan_target(nullptr);
+
+	if(is_front && machines_.size() > 1) {
+		const auto successor = machines_[1]->scan_producer();
+		if(successor) successor->set_scan_target(scan_target_);
+	}
+}
+
 // MARK: - MultiAudioProducer
 MultiAudioProducer::MultiAudioProducer(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex) : MultiInterface(machines, machines_mutex) {
-	speaker_ = MultiSpeaker::create(machines);
+	speaker_ = MultiSpeaker::create(machines, machines_mutex);
 }
 
 Outputs::Speaker::Speaker *MultiAudioProducer::get_speaker() {
@@ -94,6 +111,12 @@ void MultiAudioProducer::did_change_machine_order() {
 	}
 }
 
+void MultiAudioProducer::will_remove_machine(::Machine::DynamicMachine *machine) {
+	if(speaker_) {
+		speaker_->will_remove_machine(machine);
+	}
+}
+
 // MARK: - MultiTimedMachine
 
 void MultiTimedMachine::run_for(Time::Seconds duration) {
@@ -101,5 +124,13 @@ void MultiTimedMachine::run_for(Time::Seconds duration) {
 		if(machine->get_confidence() >= 0.01f) machine->run_for(duration);
 	});
 
-	if(delegate_) delegate_->did_run_machines(this);
+	if(delegate_) delegate_->did_run_machines(this, duration);
+}
+
+void MultiTimedMachine::run_for(Time::Seconds duration, const std::vector<MachineTypes::InputEvent> &events) {
+	perform_parallel([duration, &events](::MachineTypes::TimedMachine *machine) {
+		if(machine->get_confidence() >= 0.01f) machine->run_for(duration, events);
+	});
+
+	if(delegate_) delegate_->did_run_machines(this, duration);
 }
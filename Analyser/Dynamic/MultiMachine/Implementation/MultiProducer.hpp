@@ -55,10 +55,10 @@ class MultiTimedMachine: public MultiInterface<MachineTypes::TimedMachine>, publ
 
 		/*!
 			Provides a mechanism by which a delegate can be informed each time a call to run_for has
-			been received.
+			been received, and of the amount of time for which the machines were run.
 		*/
 		struct Delegate {
-			virtual void did_run_machines(MultiTimedMachine *) = 0;
+			virtual void did_run_machines(MultiTimedMachine *, Time::Seconds duration) = 0;
 		};
 		/// Sets @c delegate as the receiver of delegate messages.
 		void set_delegate(Delegate *delegate) {
@@ -66,6 +66,7 @@ class MultiTimedMachine: public MultiInterface<MachineTypes::TimedMachine>, publ
 		}
 
 		void run_for(Time::Seconds duration) final;
+		void run_for(Time::Seconds duration, const std::vector<MachineTypes::InputEvent> &events) final;
 
 	private:
 		void run_for(const Cycles) final {}
@@ -83,6 +84,9 @@ class MultiScanProducer: public MultiInterface<MachineTypes::ScanProducer>, publ
 		*/
 		void did_change_machine_order();
 
+		/// Detaches @c machine from the scan target, in preparation for its destruction.
+		void will_remove_machine(::Machine::DynamicMachine *machine);
+
 		void set_scan_target(Outputs::Display::ScanTarget *scan_target) final;
 		Outputs::Display::ScanStatus get_scan_status() const final;
 
@@ -100,6 +104,9 @@ class MultiAudioProducer: public MultiInterface<MachineTypes::AudioProducer>, pu
 		*/
 		void did_change_machine_order();
 
+		/// Ceases to use the speaker of @c machine, in preparation for its destruction.
+		void will_remove_machine(::Machine::DynamicMachine *machine);
+
 		Outputs::Speaker::Speaker *get_speaker() final;
 
 	private:
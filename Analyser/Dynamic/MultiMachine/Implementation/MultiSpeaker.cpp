@@ -8,9 +8,11 @@
 
 #include "MultiSpeaker.hpp"
 
+#include <algorithm>
+
 using namespace Analyser::Dynamic;
 
-MultiSpeaker *MultiSpeaker::create(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines) {
+MultiSpeaker *MultiSpeaker::create(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex) {
 	std::vector<Outputs::Speaker::Speaker *> speakers;
 	for(const auto &machine: machines) {
 		Outputs::Speaker::Speaker *speaker = machine->audio_producer()->get_speaker();
@@ -18,17 +20,18 @@ MultiSpeaker *MultiSpeaker::create(const std::vector<std::unique_ptr<::Machine::
 	}
 	if(speakers.empty()) return nullptr;
 
-	return new MultiSpeaker(speakers);
+	return new MultiSpeaker(speakers, machines_mutex);
 }
 
-MultiSpeaker::MultiSpeaker(const std::vector<Outputs::Speaker::Speaker *> &speakers) :
-	speakers_(speakers), front_speaker_(speakers.front()) {
+MultiSpeaker::MultiSpeaker(const std::vector<Outputs::Speaker::Speaker *> &speakers, std::recursive_mutex &machines_mutex) :
+	speakers_(speakers), machines_mutex_(machines_mutex), front_speaker_(speakers.front()) {
 	for(const auto &speaker: speakers_) {
 		speaker->set_delegate(this);
 	}
 }
 
 float MultiSpeaker::get_ideal_clock_rate_in_range(float minimum, float maximum) {
+	std::lock_guard machines_lock(machines_mutex_);
 	float ideal = 0.0f;
 	for(const auto &speaker: speakers_) {
 		ideal += speaker->get_ideal_clock_rate_in_range(minimum, maximum);
@@ -38,6 +41,7 @@ float MultiSpeaker::get_ideal_clock_rate_in_range(float minimum, float maximum)
 }
 
 void MultiSpeaker::set_computed_output_rate(float cycles_per_second, int buffer_size, bool stereo) {
+	std::lock_guard machines_lock(machines_mutex_);
 	stereo_output_ = stereo;
 	for(const auto &speaker: speakers_) {
 		speaker->set_computed_output_rate(cycles_per_second, buffer_size, stereo);
@@ -45,6 +49,7 @@ void MultiSpeaker::set_computed_output_rate(float cycles_per_second, int buffer_
 }
 
 bool MultiSpeaker::get_is_stereo() {
+	std::lock_guard machines_lock(machines_mutex_);
 	// Return as stereo if any subspeaker is stereo.
 	for(const auto &speaker: speakers_) {
 		if(speaker->get_is_stereo()) {
@@ -55,6 +60,7 @@ bool MultiSpeaker::get_is_stereo() {
 }
 
 void MultiSpeaker::set_output_volume(float volume) {
+	std::lock_guard machines_lock(machines_mutex_);
 	for(const auto &speaker: speakers_) {
 		speaker->set_output_volume(volume);
 	}
@@ -90,3 +96,12 @@ void MultiSpeaker::set_new_front_machine(::Machine::DynamicMachine *machine) {
 		delegate->speaker_did_change_input_clock(this);
 	}
 }
+
+void MultiSpeaker::will_remove_machine(::Machine::DynamicMachine *machine) {
+	const auto audio_producer = machine->audio_producer();
+	if(!audio_producer) return;
+
+	const auto speaker = audio_producer->get_speaker();
+	std::lock_guard machines_lock(machines_mutex_);
+	speakers_.erase(std::remove(speakers_.begin(), speakers_.end(), speaker), speakers_.end());
+}
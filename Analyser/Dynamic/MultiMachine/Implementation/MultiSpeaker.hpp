@@ -22,8 +22,8 @@ namespace Analyser::Dynamic {
 	Provides a class that multiplexes calls to and from Outputs::Speaker::Speaker in order
 	transparently to connect a single caller to multiple destinations.
 
-	Makes a static internal copy of the list of machines; expects the owner to keep it
-	abreast of the current frontmost machine.
+	Makes a static internal copy of the list of machines, guarded by the owner's mutex; expects
+	the owner to keep it abreast of the current frontmost machine.
 */
 class MultiSpeaker: public Outputs::Speaker::Speaker, Outputs::Speaker::Speaker::Delegate {
 	public:
@@ -31,11 +31,14 @@ class MultiSpeaker: public Outputs::Speaker::Speaker, Outputs::Speaker::Speaker:
 			Provides a construction mechanism that may return nullptr, in the case that all included
 			machines return nullptr as their speaker.
 		*/
-		static MultiSpeaker *create(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines);
+		static MultiSpeaker *create(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex);
 
 		/// This class requires the caller to nominate changes in the frontmost machine.
 		void set_new_front_machine(::Machine::DynamicMachine *machine);
 
+		/// Ceases to use the speaker of @c machine, in preparation for its destruction.
+		void will_remove_machine(::Machine::DynamicMachine *machine);
+
 		// Below is the standard Outputs::Speaker::Speaker interface; see there for documentation.
 		float get_ideal_clock_rate_in_range(float minimum, float maximum) override;
 		void set_computed_output_rate(float cycles_per_second, int buffer_size, bool stereo) override;
@@ -45,9 +48,10 @@ class MultiSpeaker: public Outputs::Speaker::Speaker, Outputs::Speaker::Speaker:
 	private:
 		void speaker_did_complete_samples(Speaker *speaker, const std::vector<int16_t> &buffer) final;
 		void speaker_did_change_input_clock(Speaker *speaker) final;
-		MultiSpeaker(const std::vector<Outputs::Speaker::Speaker *> &speakers);
+		MultiSpeaker(const std::vector<Outputs::Speaker::Speaker *> &speakers, std::recursive_mutex &machines_mutex);
 
 		std::vector<Outputs::Speaker::Speaker *> speakers_;
+		std::recursive_mutex &machines_mutex_;
 		Outputs::Speaker::Speaker *front_speaker_ = nullptr;
 		std::mutex front_speaker_mutex_;
 
@@ -10,18 +10,20 @@
 #include "../../../Outputs/Log.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 using namespace Analyser::Dynamic;
 
-MultiMachine::MultiMachine(std::vector<std::unique_ptr<DynamicMachine>> &&machines) :
+MultiMachine::MultiMachine(std::vector<std::unique_ptr<DynamicMachine>> &&machines, const EvaluationPolicy &policy) :
 	machines_(std::move(machines)),
-	configurable_(machines_),
+	configurable_(machines_, machines_mutex_),
 	timed_machine_(machines_, machines_mutex_),
 	scan_producer_(machines_, machines_mutex_),
 	audio_producer_(machines_, machines_mutex_),
-	joystick_machine_(machines_),
-	keyboard_machine_(machines_),
-	media_target_(machines_) {
+	joystick_machine_(machines_, machines_mutex_),
+	keyboard_machine_(machines_, machines_mutex_),
+	media_target_(machines_, machines_mutex_),
+	policy_(policy) {
 	timed_machine_.set_delegate(this);
 }
 
@@ -51,16 +53,42 @@ MachineTypes::MouseMachine *MultiMachine::mouse_machine() {
 	return nullptr;
 }
 
+MachineTypes::StateHashProducer *MultiMachine::state_hash_producer() {
+	// State hashes are meaningful only once a single machine has been picked.
+	std::lock_guard machines_lock(machines_mutex_);
+	return has_picked_ ? machines_.front()->state_hash_producer() : nullptr;
+}
+
+MachineTypes::StateProducer *MultiMachine::state_producer() {
+	// Only a picked machine has a state that could be restored to a single machine.
+	std::lock_guard machines_lock(machines_mutex_);
+	return has_picked_ ? machines_.front()->state_producer() : nullptr;
+}
+
+MachineTypes::MemoryAccountant *MultiMachine::memory_accountant() {
+	// Candidate machines are short-lived; only a picked machine is worth accounting for.
+	std::lock_guard machines_lock(machines_mutex_);
+	return has_picked_ ? machines_.front()->memory_accountant() : nullptr;
+}
+
 #undef Provider
 
-bool MultiMachine::would_collapse(const std::vector<std::unique_ptr<DynamicMachine>> &machines) {
+bool MultiMachine::would_collapse(const std::vector<std::unique_ptr<DynamicMachine>> &machines, const EvaluationPolicy &policy) {
+	if(machines.size() < 2) return true;
 	return
-		(machines.front()->timed_machine()->get_confidence() > 0.9f) ||
-		(machines.front()->timed_machine()->get_confidence() >= 2.0f * machines[1]->timed_machine()->get_confidence());
+		(machines.front()->timed_machine()->get_confidence() > policy.decisive_confidence) ||
+		(machines.front()->timed_machine()->get_confidence() >= policy.decisive_ratio * machines[1]->timed_machine()->get_confidence());
 }
 
-void MultiMachine::did_run_machines(MultiTimedMachine *) {
+void MultiMachine::did_run_machines(MultiTimedMachine *, Time::Seconds duration) {
 	std::lock_guard machines_lock(machines_mutex_);
+	if(has_picked_) return;
+
+	// Evaluate only at checkpoints.
+	time_since_checkpoint_ += duration;
+	if(time_since_checkpoint_ < policy_.checkpoint_interval) return;
+	time_since_checkpoint_ = policy_.checkpoint_interval > 0.0 ? std::fmod(time_since_checkpoint_, policy_.checkpoint_interval) : 0.0;
+
 #ifndef NDEBUG
 	for(const auto &machine: machines_) {
 		auto timed_machine = machine->timed_machine();
@@ -80,13 +108,57 @@ void MultiMachine::did_run_machines(MultiTimedMachine *) {
 	if(machines_.front().get() != front) {
 		scan_producer_.did_change_machine_order();
 		audio_producer_.did_change_machine_order();
+		decisive_checkpoints_ = 0;
+	}
+
+	// Pick the frontmost machine if it has been decisively ahead for long enough.
+	if(would_collapse(machines_, policy_)) {
+		++decisive_checkpoints_;
+		if(decisive_checkpoints_ >= policy_.required_checkpoints) {
+			pick_first();
+			return;
+		}
+	} else {
+		decisive_checkpoints_ = 0;
 	}
 
-	if(would_collapse(machines_)) {
-		pick_first();
+	discard_losers();
+}
+
+void MultiMachine::discard_losers() {
+	auto machine = machines_.begin() + 1;
+	while(machine != machines_.end()) {
+		if((*machine)->timed_machine()->get_confidence() >= policy_.discard_confidence) {
+			losing_checkpoints_.erase(machine->get());
+			++machine;
+			continue;
+		}
+
+		auto &checkpoints = losing_checkpoints_[machine->get()];
+		++checkpoints;
+		if(checkpoints < policy_.required_checkpoints) {
+			++machine;
+			continue;
+		}
+
+		losing_checkpoints_.erase(machine->get());
+		remove_machine(machine);
+		machine = machines_.begin() + 1;
 	}
 }
 
+void MultiMachine::remove_machine(std::vector<std::unique_ptr<DynamicMachine>>::iterator machine) {
+	// Ensure that nothing retains a reference to the machine before destroying it.
+	configurable_.will_remove_machine(machine->get());
+	scan_producer_.will_remove_machine(machine->get());
+	audio_producer_.will_remove_machine(machine->get());
+	joystick_machine_.will_remove_machine(machine->get());
+	keyboard_machine_.will_remove_machine(machine->get());
+	media_target_.will_remove_machine(machine->get());
+
+	machines_.erase(machine);
+}
+
 void MultiMachine::pick_first() {
 	has_picked_ = true;
 
@@ -102,15 +174,12 @@ void MultiMachine::pick_first() {
 		}
 	}
 
-	// TODO: because it is not invalid for a caller to keep a reference to anything previously returned,
-	// this erase can be added only once the Multi machines that take static copies of the machines list
-	// are updated.
-	//
-	// Example failing use case otherwise: a caller still has reference to the MultiJoystickMachine, and
-	// it has dangling references to the various JoystickMachines.
-	//
-	// This gets into particularly long grass with the MultiConfigurable and its MultiStruct.
-//	machines_.erase(machines_.begin() + 1, machines_.end());
+	// Destroy all other machines; the various Multi classes are informed first as it is not invalid
+	// for a caller to keep a reference to anything previously returned.
+	while(machines_.size() > 1) {
+		remove_machine(machines_.end() - 1);
+	}
+	losing_checkpoints_.clear();
 }
 
 void *MultiMachine::raw_pointer() {
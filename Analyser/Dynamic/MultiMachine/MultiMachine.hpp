@@ -18,12 +18,35 @@
 #include "Implementation/MultiKeyboardMachine.hpp"
 #include "Implementation/MultiMediaTarget.hpp"
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 namespace Analyser::Dynamic {
 
+/*!
+	Describes when and how a MultiMachine evaluates confidence.
+*/
+struct MultiMachineEvaluationPolicy {
+	/// The amount of emulated time between evaluations; if this is zero then evaluation
+	/// occurs after every run_for.
+	Time::Seconds checkpoint_interval = 0.0;
+
+	/// The number of consecutive evaluations for which a decision must hold before
+	/// it is acted upon.
+	int required_checkpoints = 1;
+
+	/// The frontmost machine is picked once its confidence exceeds this…
+	float decisive_confidence = 0.9f;
+
+	/// … or once it is at least this multiple of that of the next machine.
+	float decisive_ratio = 2.0f;
+
+	/// Any other machine with a confidence below this is discarded.
+	float discard_confidence = 0.01f;
+};
+
 /*!
 	Provides the same interface as to a single machine, while multiplexing all
 	underlying calls to an array of real dynamic machines.
@@ -32,14 +55,19 @@ namespace Analyser::Dynamic {
 	anything installed as the speaker's delegate will similarly receive
 	feedback only from that machine.
 
-	Following each crt_machine->run_for, reorders the supplied machines by
-	confidence.
+	At each evaluation checkpoint, as measured in emulated time, reorders the
+	supplied machines by confidence.
 
 	If confidence for any machine becomes disproportionately low compared to
-	the others in the set, that machine stops running.
+	the others in the set, that machine stops running; if that remains the case
+	for long enough then the machine is destroyed. Similarly once the frontmost
+	machine has been decisively ahead for long enough, all others are destroyed.
+	See EvaluationPolicy.
 */
 class MultiMachine: public ::Machine::DynamicMachine, public MultiTimedMachine::Delegate {
 	public:
+		using EvaluationPolicy = MultiMachineEvaluationPolicy;
+
 		/*!
 			Allows a potential MultiMachine creator to enquire as to whether there's any benefit in
 			requesting this class as a proxy.
@@ -47,8 +75,8 @@ class MultiMachine: public ::Machine::DynamicMachine, public MultiTimedMachine::
 			@returns @c true if the multimachine would discard all but the first machine in this list;
 				@c false otherwise.
 		*/
-		static bool would_collapse(const std::vector<std::unique_ptr<DynamicMachine>> &machines);
-		MultiMachine(std::vector<std::unique_ptr<DynamicMachine>> &&machines);
+		static bool would_collapse(const std::vector<std::unique_ptr<DynamicMachine>> &machines, const EvaluationPolicy &policy = EvaluationPolicy());
+		MultiMachine(std::vector<std::unique_ptr<DynamicMachine>> &&machines, const EvaluationPolicy &policy = EvaluationPolicy());
 
 		Activity::Source *activity_source() final;
 		Configurable::Device *configurable_device() final;
@@ -59,10 +87,13 @@ class MultiMachine: public ::Machine::DynamicMachine, public MultiTimedMachine::
 		MachineTypes::KeyboardMachine *keyboard_machine() final;
 		MachineTypes::MouseMachine *mouse_machine() final;
 		MachineTypes::MediaTarget *media_target() final;
+		MachineTypes::StateHashProducer *state_hash_producer() final;
+		MachineTypes::StateProducer *state_producer() final;
+		MachineTypes::MemoryAccountant *memory_accountant() final;
 		void *raw_pointer() final;
 
 	private:
-		void did_run_machines(MultiTimedMachine *) final;
+		void did_run_machines(MultiTimedMachine *, Time::Seconds duration) final;
 
 		std::vector<std::unique_ptr<DynamicMachine>> machines_;
 		std::recursive_mutex machines_mutex_;
@@ -77,6 +108,14 @@ class MultiMachine: public ::Machine::DynamicMachine, public MultiTimedMachine::
 
 		void pick_first();
 		bool has_picked_ = false;
+
+		void discard_losers();
+		void remove_machine(std::vector<std::unique_ptr<DynamicMachine>>::iterator);
+
+		EvaluationPolicy policy_;
+		Time::Seconds time_since_checkpoint_ = 0.0;
+		int decisive_checkpoints_ = 0;
+		std::map<const DynamicMachine *, int> losing_checkpoints_;
 };
 
 }
@@ -15,6 +15,8 @@
 #include "ForceInline.hpp"
 
 #include <atomic>
+#include <cassert>
+#include <memory>
 
 /*!
 	A JustInTimeActor holds (i) an embedded object with a run_for method; and (ii) an amount
@@ -33,7 +35,7 @@
 	observer and potentially stop clocking or stop delaying clocking until just-in-time references
 	as directed.
 
-	TODO: incorporate and codify AsyncJustInTimeActor.
+	See also AsyncJustInTimeActor, which can additionally run the object ahead on a separate thread.
 */
 template <class T, class LocalTimeScale = HalfCycles, int multiplier = 1, int divider = 1> class JustInTimeActor:
 	public ClockingHint::Observer {
@@ -285,55 +287,208 @@ template <class T, class LocalTimeScale = HalfCycles, int multiplier = 1, int di
 };
 
 /*!
-	An AsyncJustInTimeActor acts like a JustInTimeActor but additionally contains an AsyncTaskQueue.
-	Any time the amount of accumulated time crosses a threshold provided at construction time,
-	the object will be updated on the AsyncTaskQueue.
+	An AsyncJustInTimeActor acts like a JustInTimeActor but can optionally also own an AsyncTaskQueue.
+
+	Any time the amount of accumulated time crosses a threshold provided at construction time, that
+	time is supplied to the object. If asynchronous running is enabled then it is supplied on the
+	AsyncTaskQueue, allowing the object to run ahead in parallel with the owner; any access via ->
+	or flush() waits for that work to complete. Otherwise it is supplied immediately.
+
+	If the held object implements get_next_sequence_point() then no work is dispatched beyond the
+	next sequence point; upon reaching it the object is flushed synchronously exactly as per a
+	JustInTimeActor.
+
+	Time is therefore supplied in the same quantities at the same points whether or not asynchronous
+	running is enabled; only the thread it is supplied on differs. Input from the owner should be
+	posted via perform() so that it too reaches the object at the same point in either mode.
 */
-template <class T, class LocalTimeScale = HalfCycles, class TargetTimeScale = LocalTimeScale> class AsyncJustInTimeActor {
+template <class T, class LocalTimeScale = HalfCycles, int multiplier = 1, int divider = 1> class AsyncJustInTimeActor {
+	private:
+		/// As per JustInTimeActor::SequencePointAwareDeleter.
+		class SequencePointAwareDeleter {
+			public:
+				explicit SequencePointAwareDeleter(AsyncJustInTimeActor<T, LocalTimeScale, multiplier, divider> *actor) noexcept
+					: actor_(actor) {}
+
+				forceinline void operator ()(const T *const) const {
+					if constexpr (has_sequence_points<T>::value) {
+						actor_->update_sequence_point();
+					}
+				}
+
+			private:
+				AsyncJustInTimeActor<T, LocalTimeScale, multiplier, divider> *const actor_;
+		};
+
+		// This block of SFINAE determines whether objects of type T accepts Cycles or HalfCycles.
+		using HalfRunFor = void (T::*const)(HalfCycles);
+		static uint8_t half_sig(...);
+		static uint16_t half_sig(HalfRunFor);
+		using TargetTimeScale =
+			std::conditional_t<
+				sizeof(half_sig(&T::run_for)) == sizeof(uint16_t),
+				HalfCycles,
+				Cycles>;
+
 	public:
-		/// Constructs a new AsyncJustInTimeActor using the same construction arguments as the included object.
-		template<typename... Args> AsyncJustInTimeActor(TargetTimeScale threshold, Args&&... args) :
+		/// Constructs a new AsyncJustInTimeActor using the same construction arguments as the included object;
+		/// @c threshold is the amount of local time that must accumulate before work is dispatched.
+		template<typename... Args> AsyncJustInTimeActor(LocalTimeScale threshold, Args&&... args) :
 			object_(std::forward<Args>(args)...),
-			threshold_(threshold) {}
+			threshold_(threshold * multiplier) {}
+
+		/// Enables or disables asynchronous running.
+		void set_is_asynchronous(bool is_asynchronous) {
+			if(is_asynchronous == bool(task_queue_)) return;
+
+			if(is_asynchronous) {
+				task_queue_ = std::make_unique<Concurrency::AsyncTaskQueue<true>>();
+			} else {
+				flush();
+				task_queue_.reset();
+			}
+		}
 
 		/// Adds time to the actor.
-		inline void operator += (const LocalTimeScale &rhs) {
-			time_since_update_ += rhs;
-			if(time_since_update_ >= threshold_) {
-				time_since_update_ -= threshold_;
-				task_queue_.enqueue([this] () {
-					object_.run_for(threshold_);
-				});
+		///
+		/// @returns @c true if adding time caused a flush; @c false otherwise.
+		forceinline bool operator += (LocalTimeScale rhs) {
+			if constexpr (multiplier != 1) {
+				time_since_update_ += rhs * multiplier;
+			} else {
+				time_since_update_ += rhs;
 			}
 			is_flushed_ = false;
+
+			if constexpr (has_sequence_points<T>::value) {
+				time_until_event_ -= rhs * multiplier;
+				if(time_until_event_ <= LocalTimeScale(0)) {
+					time_overrun_ = time_until_event_ / divider;
+					flush();
+					update_sequence_point();
+					return true;
+				}
+			}
+
+			if(time_since_update_ >= threshold_) {
+				dispatch();
+			}
+
+			return false;
 		}
 
 		/// Flushes all accumulated time and returns a pointer to the included object.
-		inline T *operator->() {
+		///
+		/// If this object provides sequence points, checks for changes to the next
+		/// sequence point upon deletion of the pointer.
+		[[nodiscard]] forceinline auto operator->() {
 			flush();
-			return &object_;
+			return std::unique_ptr<T, SequencePointAwareDeleter>(&object_, SequencePointAwareDeleter(this));
+		}
+
+		/// Performs @c function upon the included object after all time that has so far been supplied to it,
+		/// but without flushing time. If asynchronous running is enabled and work is outstanding then
+		/// @c function is performed on the worker thread, in sequence with that work.
+		template <typename FunctionT> void perform(const FunctionT &function) {
+			if(has_dispatched_) {
+				task_queue_->enqueue([this, function] {
+					function(object_);
+				});
+			} else {
+				function(object_);
+			}
 		}
 
-		/// Returns a pointer to the included object without flushing time.
-		inline T *last_valid() {
+		/// @returns a pointer to the included object, without flushing time.
+		///
+		/// If asynchronous running is enabled then the object may currently be running on another
+		/// thread, so this should be used only to access parts of it that are thread safe; use
+		/// perform() to modify it.
+		[[nodiscard]] forceinline T *last_valid() {
 			return &object_;
 		}
 
-		/// Flushes all accumulated time.
-		inline void flush() {
+		/// Flushes all accumulated time, waiting for any asynchronous work to complete.
+		///
+		/// This does not affect this actor's record of when the next sequence point will occur.
+		forceinline void flush() {
 			if(!is_flushed_) {
-				task_queue_.flush();
-				object_.run_for(time_since_update_.template flush<TargetTimeScale>());
-				is_flushed_ = true;
+				did_flush_ = is_flushed_ = true;
+				if(has_dispatched_) {
+					task_queue_->flush();
+					has_dispatched_ = false;
+				}
+
+				const auto duration = take_time();
+				if(duration > TargetTimeScale(0)) {
+					object_.run_for(duration);
+				}
+			}
+		}
+
+		/// Indicates whether a flush has occurred since the last call to did_flush().
+		[[nodiscard]] forceinline bool did_flush() {
+			const bool did_flush = did_flush_;
+			did_flush_ = false;
+			return did_flush;
+		}
+
+		/// @returns a number in the range [-max, 0] indicating the offset of the most recent sequence
+		/// point from the final time at the end of the += that triggered the sequence point.
+		[[nodiscard]] forceinline LocalTimeScale last_sequence_point_overrun() {
+			return time_overrun_;
+		}
+
+		/// Updates this template's record of the next sequence point.
+		void update_sequence_point() {
+			if constexpr (has_sequence_points<T>::value) {
+				const auto time = object_.get_next_sequence_point();
+				if(time == TargetTimeScale::max()) {
+					time_until_event_ = LocalTimeScale::max();
+				} else {
+					time_until_event_ = time * divider;
+				}
+				assert(time_until_event_ > LocalTimeScale(0));
 			}
 		}
 
 	private:
 		T object_;
-		LocalTimeScale time_since_update_;
-		TargetTimeScale threshold_;
+		LocalTimeScale time_since_update_, time_until_event_, time_overrun_;
+		const LocalTimeScale threshold_;
 		bool is_flushed_ = true;
-		Concurrency::AsyncTaskQueue<true> task_queue_;
+		bool did_flush_ = false;
+		bool has_dispatched_ = false;
+
+		// Declared after object_ so that it is destroyed, and its thread joined, first.
+		std::unique_ptr<Concurrency::AsyncTaskQueue<true>> task_queue_;
+
+		template <typename S, typename = void> struct has_sequence_points : std::false_type {};
+		template <typename S> struct has_sequence_points<S, decltype(void(std::declval<S &>().get_next_sequence_point()))> : std::true_type {};
+
+		/// Converts as much accumulated time as possible to the target time scale, retaining any remainder.
+		forceinline TargetTimeScale take_time() {
+			if constexpr (divider == 1) {
+				return time_since_update_.template flush<TargetTimeScale>();
+			} else {
+				return time_since_update_.template divide<TargetTimeScale>(LocalTimeScale(divider));
+			}
+		}
+
+		/// Supplies all accumulated time to the object, on the task queue if there is one.
+		void dispatch() {
+			const auto duration = take_time();
+			if(duration <= TargetTimeScale(0)) return;
+
+			if(task_queue_) {
+				task_queue_->enqueue([this, duration] {
+					object_.run_for(duration);
+				});
+				has_dispatched_ = true;
+			} else {
+				object_.run_for(duration);
+			}
+		}
 };
 
 #endif /* JustInTime_h */
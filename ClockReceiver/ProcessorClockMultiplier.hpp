@@ -0,0 +1,60 @@
+//
+//  ProcessorClockMultiplier.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef ProcessorClockMultiplier_h
+#define ProcessorClockMultiplier_h
+
+#include "ClockReceiver.hpp"
+
+#include <algorithm>
+
+/*!
+	Provides the bookkeeping necessary to run a machine's processor at a multiple of its
+	original clock rate while everything else in the machine retains its original timing.
+
+	A machine asked to run for a period of time should run its processor for @c processor_time
+	of that period; each period of processor activity should then be converted via @c machine_time
+	before being applied to any other component. Any fractional part of a conversion is carried
+	forward, so no time is lost.
+
+	With a multiplier of 1 both conversions are the identity.
+*/
+template <typename TimeUnit> class ProcessorClockMultiplier {
+	public:
+		/// Sets the factor by which the processor should run faster than the rest of the machine.
+		void set_multiplier(int multiplier) {
+			multiplier_ = std::max(multiplier, 1);
+			if(multiplier_ == 1) {
+				remainder_ = TimeUnit(0);
+			}
+		}
+
+		/// @returns The current multiplier.
+		int multiplier() const {
+			return multiplier_;
+		}
+
+		/// @returns The amount of processor time that should elapse over @c machine_time.
+		TimeUnit processor_time(TimeUnit machine_time) const {
+			return machine_time * TimeUnit(multiplier_);
+		}
+
+		/// @returns The amount of machine time that has elapsed given @c processor_time of
+		/// further processor activity.
+		TimeUnit machine_time(TimeUnit processor_time) {
+			if(multiplier_ == 1) return processor_time;
+			remainder_ += processor_time;
+			return remainder_.divide(TimeUnit(multiplier_));
+		}
+
+	private:
+		int multiplier_ = 1;
+		TimeUnit remainder_;
+};
+
+#endif /* ProcessorClockMultiplier_h */
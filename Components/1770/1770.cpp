@@ -838,3 +838,55 @@ ClockingHint::Preference WD1770::preferred_clocking() const {
 	if(status_.busy) return ClockingHint::Preference::RealTime;
 	return Storage::Disk::MFMController::preferred_clocking();
 }
+
+// MARK: - State.
+
+State::State(const WD1770 &source) : State() {
+	track = source.track_;
+	sector = source.sector_;
+	data = source.data_;
+	command = source.command_;
+
+	write_protect = source.status_.write_protect;
+	record_type = source.status_.record_type;
+	spin_up = source.status_.spin_up;
+	record_not_found = source.status_.record_not_found;
+	crc_error = source.status_.crc_error;
+	seek_error = source.status_.seek_error;
+	lost_data = source.status_.lost_data;
+	data_request = source.status_.data_request;
+	interrupt_request = source.status_.interrupt_request;
+	track_zero = source.status_.track_zero;
+	status_type = int(source.status_.type);
+
+	index_hole_count = source.index_hole_count_;
+	head_is_loaded = source.head_is_loaded_;
+}
+
+void State::apply(WD1770 &target) {
+	target.track_ = track;
+	target.sector_ = sector;
+	target.data_ = data;
+	target.command_ = command;
+
+	target.update_status([this] (WD1770::Status &status) {
+		status.write_protect = write_protect;
+		status.record_type = record_type;
+		status.spin_up = spin_up;
+		status.record_not_found = record_not_found;
+		status.crc_error = crc_error;
+		status.seek_error = seek_error;
+		status.lost_data = lost_data;
+		status.data_request = data_request;
+		status.interrupt_request = interrupt_request;
+		status.track_zero = track_zero;
+		switch(status_type) {
+			default:	status.type = WD1770::Status::One;		break;
+			case 1:		status.type = WD1770::Status::Two;		break;
+			case 2:		status.type = WD1770::Status::Three;	break;
+		}
+	});
+
+	target.index_hole_count_ = index_hole_count;
+	target.head_is_loaded_ = head_is_loaded;
+}
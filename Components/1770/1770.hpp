@@ -10,6 +10,7 @@
 #define _770_hpp
 
 #include "../../Storage/Disk/Controller/MFMDiskController.hpp"
+#include "../../Reflection/Struct.hpp"
 
 namespace WD {
 
@@ -68,6 +69,9 @@ class WD1770: public Storage::Disk::MFMController {
 		/// @returns The current value of the DRQ line output.
 		inline bool get_data_request_line() const		{	return status_.data_request;		}
 
+		/// @returns @c true if a command is in progress; @c false if the controller is idle, awaiting a command.
+		inline bool get_is_busy() const					{	return status_.busy;				}
+
 		class Delegate {
 			public:
 				virtual void wd1770_did_change_output(WD1770 *wd1770) = 0;
@@ -138,6 +142,65 @@ class WD1770: public Storage::Disk::MFMController {
 
 		// delegate
 		Delegate *delegate_ = nullptr;
+
+		friend struct State;
+};
+
+/*!
+	Captures or restores the state of an idle controller: its registers, status and head-load and
+	motor-timeout progress. Commands in progress aren't captured, so states should be captured only
+	while @c get_is_busy() is @c false.
+*/
+struct State: public Reflection::StructImpl<State> {
+	uint8_t track = 0;
+	uint8_t sector = 0;
+	uint8_t data = 0;
+	uint8_t command = 0;
+
+	// The status flags other than busy, and the type of the most recent command; as that
+	// determines how the status register is composed.
+	bool write_protect = false;
+	bool record_type = false;
+	bool spin_up = false;
+	bool record_not_found = false;
+	bool crc_error = false;
+	bool seek_error = false;
+	bool lost_data = false;
+	bool data_request = false;
+	bool interrupt_request = false;
+	bool track_zero = false;
+	int status_type = 0;
+
+	int index_hole_count = 0;
+	bool head_is_loaded = false;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(track);
+			DeclareField(sector);
+			DeclareField(data);
+			DeclareField(command);
+			DeclareField(write_protect);
+			DeclareField(record_type);
+			DeclareField(spin_up);
+			DeclareField(record_not_found);
+			DeclareField(crc_error);
+			DeclareField(seek_error);
+			DeclareField(lost_data);
+			DeclareField(data_request);
+			DeclareField(interrupt_request);
+			DeclareField(track_zero);
+			DeclareField(status_type);
+			DeclareField(index_hole_count);
+			DeclareField(head_is_loaded);
+		}
+	}
+
+	/// Captures the state of @c source.
+	State(const WD1770 &source);
+
+	/// Applies this state to @c target, which should be idle.
+	void apply(WD1770 &target);
 };
 
 }
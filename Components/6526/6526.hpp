@@ -63,6 +63,11 @@ template <typename PortHandlerT, Personality personality> class MOS6526:
 		/// @returns @c true if the interrupt output is active, @c false otherwise.
 		bool get_interrupt_line();
 
+		/// @returns A lower bound on the time until either timer, or serial output clocked by timer A,
+		/// might next activate the interrupt output; @c HalfCycles::max() if no such interrupt is possible.
+		/// Interrupts prompted by external inputs — CNT, FLG, serial input and TOD — are not predicted.
+		HalfCycles get_next_sequence_point() const;
+
 		/// Sets the current state of the CNT input.
 		void set_cnt_input(bool active);
 
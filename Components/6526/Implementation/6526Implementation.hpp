@@ -9,8 +9,10 @@
 #ifndef _526Implementation_h
 #define _526Implementation_h
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
+#include <limits>
 
 namespace MOS::MOS6526 {
 
@@ -57,6 +59,42 @@ bool MOS6526<BusHandlerT, personality>::get_interrupt_line() {
 	return interrupt_state_ & 0x80;
 }
 
+template <typename BusHandlerT, Personality personality>
+HalfCycles MOS6526<BusHandlerT, personality>::get_next_sequence_point() const {
+	if(pending_ & (InterruptInOne | InterruptNow)) {
+		return HalfCycles(0);
+	}
+
+	// Timer A underflows are relevant to its own interrupt, to serial output and to timer B if chained.
+	const int timer_a = (counter_[0].control & 0x20) ? 0 : counter_[0].minimum_clocks_to_underflow();
+	int clocks = std::numeric_limits<int>::max();
+
+	if(interrupt_control_ & Interrupts::TimerA) {
+		clocks = std::min(clocks, timer_a);
+	}
+	if(interrupt_control_ & Interrupts::SerialPort && shifter_is_output_) {
+		clocks = std::min(clocks, timer_a);
+	}
+	if(interrupt_control_ & Interrupts::TimerB) {
+		switch(counter_[1].control & 0x60) {
+			case 0x00:	// Phi2.
+				clocks = std::min(clocks, counter_[1].minimum_clocks_to_underflow());
+			break;
+			case 0x20:	// CNT; not predicted.
+				clocks = 0;
+			break;
+			default:	// Timer A, possibly gated by CNT; an underflow of A may already be in the pipeline.
+				clocks = std::min(clocks, counter_[1].minimum_clocks_to_underflow() > 1 ? timer_a : 0);
+			break;
+		}
+	}
+
+	if(clocks == std::numeric_limits<int>::max()) {
+		return HalfCycles::max();
+	}
+	return std::max(HalfCycles(clocks * 2) - half_divider_, HalfCycles(0));
+}
+
 template <typename BusHandlerT, Personality personality>
 void MOS6526<BusHandlerT, personality>::set_cnt_input(bool active) {
 	cnt_edge_ = active && !cnt_state_;
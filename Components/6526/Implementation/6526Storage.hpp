@@ -9,7 +9,9 @@
 #ifndef _526Storage_h
 #define _526Storage_h
 
+#include <algorithm>
 #include <array>
+#include <limits>
 
 #include "../../../ClockReceiver/ClockReceiver.hpp"
 
@@ -305,6 +307,17 @@ struct MOS6526Storage {
 			return should_reload;
 		}
 
+		/// @returns A lower bound on the number of input clocks until this counter next underflows,
+		/// or @c std::numeric_limits<int>::max() if it is stopped.
+		int minimum_clocks_to_underflow() const {
+			if(!(control & 1) && !(pending & (ApplyClockInTwo | ApplyClockInOne | ApplyClockNow))) {
+				return std::numeric_limits<int>::max();
+			}
+
+			// A pending reload may substitute the reload value for the current one.
+			return std::min(value, reload);
+		}
+
 		private:
 			int pending = 0;
 
@@ -10,11 +10,14 @@
 #define _560_hpp
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../ClockReceiver/ForceInline.hpp"
 #include "../../Concurrency/AsyncTaskQueue.hpp"
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
 #include "../../Outputs/Speaker/Implementation/SampleSource.hpp"
 
+#include <algorithm>
+
 namespace MOS::MOS6560 {
 
 // audio state
@@ -46,6 +49,31 @@ struct BusHandler {
 		*pixel_data = 0xff;
 		*colour_data = 0xff;
 	}
+
+	/// Performs @c count consecutive reads from @c address onwards, wrapping within the VIC's 16kb address space.
+	void perform_reads([[maybe_unused]] uint16_t address, int count, uint8_t *pixel_data, uint8_t *colour_data) {
+		std::fill(pixel_data, pixel_data + count, 0xff);
+		std::fill(colour_data, colour_data + count, 0xff);
+	}
+};
+
+/*!
+	Provides, for every possible byte of character data, the colour index to use for each of
+	the eight pixels it produces: in high-resolution mode each bit selects between two colours;
+	in multicolour mode each pair of bits selects from four and produces two pixels.
+*/
+struct PixelTables {
+	uint8_t high_resolution[256][8];
+	uint8_t multicolour[256][8];
+
+	constexpr PixelTables() : high_resolution{}, multicolour{} {
+		for(int value = 0; value < 256; value++) {
+			for(int pixel = 0; pixel < 8; pixel++) {
+				high_resolution[value][pixel] = uint8_t((value >> (7 - pixel)) & 1);
+				multicolour[value][pixel] = uint8_t((value >> (6 - (pixel & ~1))) & 3);
+			}
+		}
+	}
 };
 
 enum class OutputMode {
@@ -166,180 +194,32 @@ template <class BusHandler> class MOS6560 {
 		}
 
 		/*!
-			Runs for cycles. Derr.
+			Runs for cycles.
+
+			Whole raster lines are run with a single bulk fetch of the row's screen and colour bytes
+			via the bus handler's @c perform_reads; partial lines, such as those either side of a
+			register write, are stepped a cycle at a time. The owner must therefore call @c run_for
+			before changing registers or any memory visible to the VIC, and the bus handler's reads
+			must be free of side effects.
 		*/
 		inline void run_for(const Cycles cycles) {
 			// keep track of the amount of time since the speaker was updated; lazy updates are applied
 			cycles_since_speaker_update_ += cycles;
 
 			auto number_of_cycles = cycles.as_integral();
-			while(number_of_cycles--) {
-				// keep an old copy of the vertical count because that test is a cycle later than the actual changes
-				int previous_vertical_counter = vertical_counter_;
-
-				// keep track of internal time relative to this scanline
-				horizontal_counter_++;
-				if(horizontal_counter_ == timing_.cycles_per_line) {
-					if(horizontal_drawing_latch_) {
-						current_character_row_++;
-						if(
-							(current_character_row_ == 16) ||
-							(current_character_row_ == 8 && !registers_.tall_characters)
-						) {
-							current_character_row_ = 0;
-							current_row_++;
-						}
-
-						pixel_line_cycle_ = -1;
-						columns_this_line_ = -1;
-						column_counter_ = -1;
-					}
-
-					horizontal_counter_ = 0;
-					if(output_mode_ == OutputMode::PAL) is_odd_line_ ^= true;
-					horizontal_drawing_latch_ = false;
-
-					vertical_counter_ ++;
-					if(vertical_counter_ == lines_this_field()) {
-						vertical_counter_ = 0;
-
-						if(output_mode_ == OutputMode::NTSC) is_odd_frame_ ^= true;
-						current_row_ = 0;
-						rows_this_field_ = -1;
-						vertical_drawing_latch_ = false;
-						base_video_matrix_address_counter_ = 0;
-						current_character_row_ = 0;
-					}
-				}
-
-				// check for vertical starting events
-				vertical_drawing_latch_ |= registers_.first_row_location == (previous_vertical_counter >> 1);
-				horizontal_drawing_latch_ |= vertical_drawing_latch_ && (horizontal_counter_ == registers_.first_column_location);
-
-				if(pixel_line_cycle_ >= 0) pixel_line_cycle_++;
-				switch(pixel_line_cycle_) {
-					case -1:
-						if(horizontal_drawing_latch_) {
-							pixel_line_cycle_ = 0;
-							video_matrix_address_counter_ = base_video_matrix_address_counter_;
-						}
-					break;
-					case 1:	columns_this_line_ = registers_.number_of_columns;	break;
-					case 2:	if(rows_this_field_ < 0) rows_this_field_ = registers_.number_of_rows;	break;
-					case 3: if(current_row_ < rows_this_field_) column_counter_ = 0;	break;
-				}
-
-				uint16_t fetch_address = 0x1c;
-				if(column_counter_ >= 0 && column_counter_ < columns_this_line_*2) {
-					if(column_counter_&1) {
-						fetch_address = registers_.character_cell_start_address + (character_code_*(registers_.tall_characters ? 16 : 8)) + current_character_row_;
-					} else {
-						fetch_address = uint16_t(registers_.video_matrix_start_address + video_matrix_address_counter_);
-						video_matrix_address_counter_++;
-						if(
-							(current_character_row_ == 15) ||
-							(current_character_row_ == 7 && !registers_.tall_characters)
-						) {
-							base_video_matrix_address_counter_ = video_matrix_address_counter_;
-						}
-					}
-				}
-
-				fetch_address &= 0x3fff;
-
-				uint8_t pixel_data;
-				uint8_t colour_data;
-				bus_handler_.perform_read(fetch_address, &pixel_data, &colour_data);
-
-				// TODO: there should be a further two-cycle delay on pixels being output; the reverse bit should
-				// divide the byte it is set for 3:1 and then continue as usual.
-
-				// determine output state; colour burst and sync timing are currently a guess
-				if(horizontal_counter_ > timing_.cycles_per_line-4) this_state_ = State::ColourBurst;
-				else if(horizontal_counter_ > timing_.cycles_per_line-7) this_state_ = State::Sync;
-				else {
-					this_state_ = (column_counter_ >= 0 && column_counter_ < columns_this_line_*2) ? State::Pixels : State::Border;
-				}
-
-				// apply vertical sync
+			while(number_of_cycles) {
+				// A line can be run in bulk only if it'll also end here, and will begin
+				// neither fetching nor part way through the start-of-pixels sequence.
 				if(
-					(vertical_counter_ < 3 && is_odd_frame()) ||
-					(registers_.interlaced &&
-						(
-							(vertical_counter_ == 0 && horizontal_counter_ > 32) ||
-							(vertical_counter_ == 1) || (vertical_counter_ == 2) ||
-							(vertical_counter_ == 3 && horizontal_counter_ <= 32)
-						)
-					))
-					this_state_ = State::Sync;
-
-				// update the CRT
-				if(this_state_ != output_state_) {
-					switch(output_state_) {
-						case State::Sync:			crt_.output_sync(cycles_in_state_ * 4);														break;
-						case State::ColourBurst:	crt_.output_colour_burst(cycles_in_state_ * 4, (is_odd_frame_ || is_odd_line_) ? 128 : 0);	break;
-						case State::Border:			output_border(cycles_in_state_ * 4);														break;
-						case State::Pixels:			crt_.output_data(cycles_in_state_ * 4);														break;
-					}
-					output_state_ = this_state_;
-					cycles_in_state_ = 0;
-
-					pixel_pointer = nullptr;
-					if(output_state_ == State::Pixels) {
-						pixel_pointer = reinterpret_cast<uint16_t *>(crt_.begin_data(260));
-					}
-				}
-				cycles_in_state_++;
-
-				if(this_state_ == State::Pixels) {
-					// TODO: palette changes can happen within half-characters; the below needs to be divided.
-					// Also: a perfect opportunity to rearrange this inner loop for no longer needing to be
-					// two parts with a cooperative owner?
-					if(column_counter_&1) {
-						character_value_ = pixel_data;
-
-						if(pixel_pointer) {
-							uint16_t cell_colour = colours_[character_colour_ & 0x7];
-							if(!(character_colour_&0x8)) {
-								uint16_t colours[2];
-								if(registers_.invertedCells) {
-									colours[0] = cell_colour;
-									colours[1] = registers_.backgroundColour;
-								} else {
-									colours[0] = registers_.backgroundColour;
-									colours[1] = cell_colour;
-								}
-								pixel_pointer[0] = colours[(character_value_ >> 7)&1];
-								pixel_pointer[1] = colours[(character_value_ >> 6)&1];
-								pixel_pointer[2] = colours[(character_value_ >> 5)&1];
-								pixel_pointer[3] = colours[(character_value_ >> 4)&1];
-								pixel_pointer[4] = colours[(character_value_ >> 3)&1];
-								pixel_pointer[5] = colours[(character_value_ >> 2)&1];
-								pixel_pointer[6] = colours[(character_value_ >> 1)&1];
-								pixel_pointer[7] = colours[(character_value_ >> 0)&1];
-							} else {
-								uint16_t colours[4] = {registers_.backgroundColour, registers_.borderColour, cell_colour, registers_.auxiliary_colour};
-								pixel_pointer[0] =
-								pixel_pointer[1] = colours[(character_value_ >> 6)&3];
-								pixel_pointer[2] =
-								pixel_pointer[3] = colours[(character_value_ >> 4)&3];
-								pixel_pointer[4] =
-								pixel_pointer[5] = colours[(character_value_ >> 2)&3];
-								pixel_pointer[6] =
-								pixel_pointer[7] = colours[(character_value_ >> 0)&3];
-							}
-
-							pixel_pointer += 8;
-						}
-					} else {
-						character_code_ = pixel_data;
-						character_colour_ = colour_data;
-					}
-				}
-
-				// Keep counting columns even if sync or the colour burst have interceded.
-				if(column_counter_ >= 0 && column_counter_ < columns_this_line_*2) {
-					column_counter_++;
+					horizontal_counter_ == timing_.cycles_per_line - 1 &&
+					number_of_cycles >= timing_.cycles_per_line &&
+					(horizontal_drawing_latch_ || (column_counter_ < 0 && pixel_line_cycle_ < 0))
+				) {
+					run_line();
+					number_of_cycles -= timing_.cycles_per_line;
+				} else {
+					run_cycle();
+					--number_of_cycles;
 				}
 			}
 		}
@@ -497,11 +377,21 @@ template <class BusHandler> class MOS6560 {
 		// data latched from the bus
 		uint8_t character_code_ = 0, character_colour_ = 0, character_value_ = 0;
 
+		// character codes and colours for the current line, if it is being run in bulk;
+		// no line can fetch more than 36 columns
+		uint8_t row_codes_[40], row_colours_[40];
+
+		bool is_fetching() const {
+			return column_counter_ >= 0 && column_counter_ < columns_this_line_*2;
+		}
+
 		bool is_odd_frame_ = false, is_odd_line_ = false;
 
 		// lookup table from 6560 colour index to appropriate PAL/NTSC value
 		uint16_t colours_[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
+		static constexpr PixelTables pixel_tables_{};
+
 		uint16_t *pixel_pointer = nullptr;
 		void output_border(int number_of_cycles) {
 			uint16_t *colour_pointer = reinterpret_cast<uint16_t *>(crt_.begin_data(1));
@@ -509,6 +399,279 @@ template <class BusHandler> class MOS6560 {
 			crt_.output_level(number_of_cycles);
 		}
 
+		/// Runs for a single cycle.
+		forceinline void run_cycle() {
+			// keep an old copy of the vertical count because that test is a cycle later than the actual changes
+			int previous_vertical_counter = vertical_counter_;
+
+			// keep track of internal time relative to this scanline
+			horizontal_counter_++;
+			if(horizontal_counter_ == timing_.cycles_per_line) {
+				if(horizontal_drawing_latch_) {
+					current_character_row_++;
+					if(
+						(current_character_row_ == 16) ||
+						(current_character_row_ == 8 && !registers_.tall_characters)
+					) {
+						current_character_row_ = 0;
+						current_row_++;
+					}
+
+					pixel_line_cycle_ = -1;
+					columns_this_line_ = -1;
+					column_counter_ = -1;
+				}
+
+				horizontal_counter_ = 0;
+				if(output_mode_ == OutputMode::PAL) is_odd_line_ ^= true;
+				horizontal_drawing_latch_ = false;
+
+				vertical_counter_ ++;
+				if(vertical_counter_ == lines_this_field()) {
+					vertical_counter_ = 0;
+
+					if(output_mode_ == OutputMode::NTSC) is_odd_frame_ ^= true;
+					current_row_ = 0;
+					rows_this_field_ = -1;
+					vertical_drawing_latch_ = false;
+					base_video_matrix_address_counter_ = 0;
+					current_character_row_ = 0;
+				}
+			}
+
+			// check for vertical starting events
+			vertical_drawing_latch_ |= registers_.first_row_location == (previous_vertical_counter >> 1);
+			horizontal_drawing_latch_ |= vertical_drawing_latch_ && (horizontal_counter_ == registers_.first_column_location);
+
+			if(pixel_line_cycle_ >= 0) pixel_line_cycle_++;
+			switch(pixel_line_cycle_) {
+				case -1:
+					if(horizontal_drawing_latch_) {
+						pixel_line_cycle_ = 0;
+						video_matrix_address_counter_ = base_video_matrix_address_counter_;
+					}
+				break;
+				case 1:	columns_this_line_ = registers_.number_of_columns;	break;
+				case 2:	if(rows_this_field_ < 0) rows_this_field_ = registers_.number_of_rows;	break;
+				case 3: if(current_row_ < rows_this_field_) column_counter_ = 0;	break;
+			}
+
+			uint16_t fetch_address = 0x1c;
+			if(is_fetching()) {
+				if(column_counter_&1) {
+					fetch_address = character_address();
+				} else {
+					fetch_address = uint16_t(registers_.video_matrix_start_address + video_matrix_address_counter_);
+					video_matrix_address_counter_++;
+					if(is_final_character_row()) {
+						base_video_matrix_address_counter_ = video_matrix_address_counter_;
+					}
+				}
+			}
+
+			fetch_address &= 0x3fff;
+
+			uint8_t pixel_data;
+			uint8_t colour_data;
+			bus_handler_.perform_read(fetch_address, &pixel_data, &colour_data);
+
+			// TODO: there should be a further two-cycle delay on pixels being output; the reverse bit should
+			// divide the byte it is set for 3:1 and then continue as usual.
+
+			// determine output state; colour burst and sync timing are currently a guess
+			if(horizontal_counter_ > timing_.cycles_per_line-4) this_state_ = State::ColourBurst;
+			else if(horizontal_counter_ > timing_.cycles_per_line-7) this_state_ = State::Sync;
+			else {
+				this_state_ = is_fetching() ? State::Pixels : State::Border;
+			}
+
+			// apply vertical sync
+			if(
+				(vertical_counter_ < 3 && is_odd_frame()) ||
+				(registers_.interlaced &&
+					(
+						(vertical_counter_ == 0 && horizontal_counter_ > 32) ||
+						(vertical_counter_ == 1) || (vertical_counter_ == 2) ||
+						(vertical_counter_ == 3 && horizontal_counter_ <= 32)
+					)
+				))
+				this_state_ = State::Sync;
+
+			set_output_state(this_state_);
+			cycles_in_state_++;
+
+			if(this_state_ == State::Pixels) {
+				// TODO: palette changes can happen within half-characters; the below needs to be divided.
+				if(column_counter_&1) {
+					character_value_ = pixel_data;
+					output_character();
+				} else {
+					character_code_ = pixel_data;
+					character_colour_ = colour_data;
+				}
+			}
+
+			// Keep counting columns even if sync or the colour burst have interceded.
+			if(is_fetching()) {
+				column_counter_++;
+			}
+		}
+
+		/// Runs for an entire line, starting from the final cycle of the previous, as a series of spans of
+		/// constant output state; the line's character codes and colours are obtained with a single bulk fetch.
+		void run_line() {
+			const int cycles_per_line = timing_.cycles_per_line;
+
+			// The first cycle completes the previous line and possibly the field, so is run conventionally.
+			run_cycle();
+
+			// From here on the vertical counter is fixed, so this is the final test for vertical starting
+			// events; the horizontal latch can then be set only at the first column.
+			vertical_drawing_latch_ |= registers_.first_row_location == (vertical_counter_ >> 1);
+			const int first_column = registers_.first_column_location;
+			if(vertical_drawing_latch_ && first_column > 0 && first_column < cycles_per_line) {
+				horizontal_drawing_latch_ = true;
+			}
+
+			// Determine the cycle upon which pixel_line_cycle_ is 0, and apply the steps that follow it.
+			int pixel_line_start = cycles_per_line;
+			if(pixel_line_cycle_ >= 0) {
+				pixel_line_start = -pixel_line_cycle_;
+			} else if(horizontal_drawing_latch_) {
+				pixel_line_start = first_column;
+				video_matrix_address_counter_ = base_video_matrix_address_counter_;
+			}
+			const auto is_in_line = [cycles_per_line] (int cycle) {
+				return cycle > 0 && cycle < cycles_per_line;
+			};
+
+			if(is_in_line(pixel_line_start + 1)) {
+				columns_this_line_ = registers_.number_of_columns;
+			}
+			if(is_in_line(pixel_line_start + 2) && rows_this_field_ < 0) {
+				rows_this_field_ = registers_.number_of_rows;
+			}
+			int fetch_start = cycles_per_line, fetch_end = cycles_per_line;
+			if(is_in_line(pixel_line_start + 3) && current_row_ < rows_this_field_) {
+				fetch_start = pixel_line_start + 3;
+				fetch_end = fetch_start + std::clamp(columns_this_line_*2, 0, cycles_per_line - fetch_start);
+				column_counter_ = fetch_end - fetch_start;
+
+				const int fetches = (fetch_end - fetch_start + 1) >> 1;
+				bus_handler_.perform_reads(
+					uint16_t(registers_.video_matrix_start_address + video_matrix_address_counter_) & 0x3fff,
+					fetches,
+					row_codes_,
+					row_colours_);
+				video_matrix_address_counter_ += fetches;
+				if(fetches && is_final_character_row()) {
+					base_video_matrix_address_counter_ = video_matrix_address_counter_;
+				}
+			}
+			if(pixel_line_start < cycles_per_line) {
+				pixel_line_cycle_ = cycles_per_line - 1 - pixel_line_start;
+			}
+
+			// Vertical sync applies either to the whole line or to one side of cycle 33.
+			const int line = vertical_counter_;
+			const bool is_sync_line =
+				(line < 3 && is_odd_frame()) ||
+				(registers_.interlaced && (line == 1 || line == 2));
+			const auto is_sync = [&] (int cycle) {
+				return
+					is_sync_line ||
+					(registers_.interlaced && ((line == 0 && cycle > 32) || (line == 3 && cycle <= 32)));
+			};
+
+			int cycle = 1;
+			while(cycle < cycles_per_line) {
+				int end = cycles_per_line;
+				for(const int boundary: {fetch_start, fetch_end, cycles_per_line - 6, cycles_per_line - 3, 33}) {
+					if(boundary > cycle && boundary < end) end = boundary;
+				}
+
+				if(is_sync(cycle)) this_state_ = State::Sync;
+				else if(cycle > cycles_per_line-4) this_state_ = State::ColourBurst;
+				else if(cycle > cycles_per_line-7) this_state_ = State::Sync;
+				else this_state_ = (cycle >= fetch_start && cycle < fetch_end) ? State::Pixels : State::Border;
+
+				set_output_state(this_state_);
+				cycles_in_state_ += end - cycle;
+
+				if(this_state_ == State::Pixels) {
+					for(int column = cycle - fetch_start; column < end - fetch_start; column++) {
+						if(column&1) {
+							uint8_t colour_data;
+							bus_handler_.perform_read(character_address() & 0x3fff, &character_value_, &colour_data);
+							output_character();
+						} else {
+							character_code_ = row_codes_[column >> 1];
+							character_colour_ = row_colours_[column >> 1];
+						}
+					}
+				}
+
+				cycle = end;
+			}
+			horizontal_counter_ = cycles_per_line - 1;
+		}
+
+		/// Ends the current output state, if it differs from @c state, and begins @c state.
+		forceinline void set_output_state(State state) {
+			if(state == output_state_) return;
+
+			switch(output_state_) {
+				case State::Sync:			crt_.output_sync(cycles_in_state_ * 4);														break;
+				case State::ColourBurst:	crt_.output_colour_burst(cycles_in_state_ * 4, (is_odd_frame_ || is_odd_line_) ? 128 : 0);	break;
+				case State::Border:			output_border(cycles_in_state_ * 4);														break;
+				case State::Pixels:			crt_.output_data(cycles_in_state_ * 4);														break;
+			}
+			output_state_ = state;
+			cycles_in_state_ = 0;
+
+			pixel_pointer = nullptr;
+			if(output_state_ == State::Pixels) {
+				pixel_pointer = reinterpret_cast<uint16_t *>(crt_.begin_data(260));
+			}
+		}
+
+		/// Outputs the eight pixels produced by the latched character data and colour.
+		forceinline void output_character() {
+			if(!pixel_pointer) return;
+
+			const uint16_t cell_colour = colours_[character_colour_ & 0x7];
+			const uint8_t *indices;
+			uint16_t colours[4];
+			if(!(character_colour_&0x8)) {
+				indices = pixel_tables_.high_resolution[character_value_];
+				if(registers_.invertedCells) {
+					colours[0] = cell_colour;
+					colours[1] = registers_.backgroundColour;
+				} else {
+					colours[0] = registers_.backgroundColour;
+					colours[1] = cell_colour;
+				}
+			} else {
+				indices = pixel_tables_.multicolour[character_value_];
+				colours[0] = registers_.backgroundColour;
+				colours[1] = registers_.borderColour;
+				colours[2] = cell_colour;
+				colours[3] = registers_.auxiliary_colour;
+			}
+			for(int c = 0; c < 8; c++) {
+				pixel_pointer[c] = colours[indices[c]];
+			}
+			pixel_pointer += 8;
+		}
+
+		uint16_t character_address() const {
+			return uint16_t(registers_.character_cell_start_address + (character_code_*(registers_.tall_characters ? 16 : 8)) + current_character_row_);
+		}
+
+		bool is_final_character_row() const {
+			return (current_character_row_ == 15) || (current_character_row_ == 7 && !registers_.tall_characters);
+		}
+
 		struct {
 			int cycles_per_line = 0;
 			int line_counter_increment_offset = 0;
@@ -11,8 +11,12 @@
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 namespace Motorola::CRTC {
 
@@ -40,6 +44,14 @@ class BusHandler {
 			having to wait until the next cycle has begun.
 		*/
 		void perform_bus_cycle_phase2(const BusState &) {}
+
+		/*!
+			Optional. If implemented, the 6845 will call this in place of @c count successive pairs of calls
+			to @c perform_bus_cycle_phase1 and @c perform_bus_cycle_phase2 whenever it can guarantee that
+			nothing other than the refresh address changes throughout; the refresh address should be
+			assumed to increment by one (modulo 0x4000) after each cycle.
+		*/
+		void perform_bus_cycles(const BusState &, int count);
 };
 
 enum Personality {
@@ -111,7 +123,21 @@ template <class T> class CRTC6845 {
 
 		void run_for(Cycles cycles) {
 			auto cyles_remaining = cycles.as_integral();
-			while(cyles_remaining--) {
+			while(cyles_remaining) {
+				// If the rest of this row is determined for a while, hand it to the bus handler in one go.
+				if constexpr (has_perform_bus_cycles<T>::value) {
+					const auto span = uneventful_characters(cyles_remaining);
+					if(span > 1) {
+						bus_state_.display_enable = character_is_visible_ && line_is_visible_;
+						bus_handler_.perform_bus_cycles(bus_state_, span);
+						bus_state_.refresh_address = (bus_state_.refresh_address + span) & 0x3fff;
+						character_counter_ = uint8_t(character_counter_ + span);
+						cyles_remaining -= span;
+						continue;
+					}
+				}
+				--cyles_remaining;
+
 				// check for end of visible characters
 				if(character_counter_ == registers_[1]) {
 					// TODO: consider skew in character_is_visible_. Or maybe defer until perform_bus_cycle?
@@ -163,7 +189,91 @@ template <class T> class CRTC6845 {
 			return bus_state_;
 		}
 
+		/*!
+			@returns The registers, counters and bus state that determine this CRTC's future behaviour,
+			packed as bytes for state hashing.
+		*/
+		std::vector<uint8_t> state_summary() const {
+			std::vector<uint8_t> summary(std::begin(registers_), std::end(registers_));
+			summary.insert(summary.end(), {
+				uint8_t(selected_register_),
+				character_counter_,
+				line_counter_,
+				uint8_t(character_is_visible_),
+				uint8_t(line_is_visible_),
+				uint8_t(hsync_counter_),
+				uint8_t(vsync_counter_),
+				uint8_t(is_in_adjustment_period_),
+				uint8_t(line_address_),
+				uint8_t(line_address_ >> 8),
+				uint8_t(end_of_line_address_),
+				uint8_t(end_of_line_address_ >> 8),
+				status_,
+				uint8_t(display_skew_mask_),
+				uint8_t(character_is_visible_shifter_),
+
+				uint8_t(bus_state_.display_enable),
+				uint8_t(bus_state_.hsync),
+				uint8_t(bus_state_.vsync),
+				uint8_t(bus_state_.cursor),
+				uint8_t(bus_state_.refresh_address),
+				uint8_t(bus_state_.refresh_address >> 8),
+				uint8_t(bus_state_.row_address),
+			});
+			return summary;
+		}
+
+		/*!
+			@returns the number of cycles until this CRTC next changes horizontal sync in a way that
+			an observer might care about: the time until the leading edge of the next horizontal sync
+			if not currently in sync, or a single cycle if in sync. Changes in vertical sync are
+			not considered.
+		*/
+		Cycles get_next_sequence_point() const {
+			if(bus_state_.hsync) return Cycles(1);
+
+			const int counter = character_counter_;
+			const int total = registers_[0];
+			const int sync_position = registers_[2];
+
+			// Counters beyond the total will wrap all the way around; don't try to predict that.
+			if(counter > total) return Cycles(1);
+
+			// Horizontal sync begins when the counter becomes equal to sync_position, either during
+			// this line or upon wrapping to the next.
+			if(counter < sync_position && sync_position <= total) return Cycles(sync_position - counter);
+			if(sync_position <= total) return Cycles(total - counter + 1 + sync_position);
+
+			// If sync will never occur, check back at the end of the line.
+			return Cycles(total - counter + 1);
+		}
+
 	private:
+		template <typename S, typename = void> struct has_perform_bus_cycles : std::false_type {};
+		template <typename S> struct has_perform_bus_cycles<S, decltype(void(std::declval<S &>().perform_bus_cycles(std::declval<const BusState &>(), 0)))> : std::true_type {};
+
+		/*!
+			@returns the number of characters, up to @c limit, that can be run from the current position
+			with no change in bus state other than to the refresh address, as determined by the current
+			row geometry. Such characters neither reach the end of the line, nor the end of the visible area,
+			nor the start of horizontal sync, and occur with display enable settled after any skew.
+		*/
+		int uneventful_characters(int limit) const {
+			if(bus_state_.hsync) return 0;
+
+			// All bits of the skew history need to match the current visibility, so that display
+			// enable is certain not to change.
+			const unsigned settled = character_is_visible_ ? 7 : 0;
+			if((character_is_visible_shifter_ & 7) != settled) return 0;
+
+			// Consider where the next per-character tests would next succeed; counting is modulo 256.
+			const int to_visible_end = uint8_t(registers_[1] - character_counter_);
+			const int to_line_end = uint8_t(registers_[0] - character_counter_);
+			const int to_sync_start = uint8_t(registers_[2] - character_counter_ - 1);
+
+			return std::min({limit, to_visible_end, to_line_end, to_sync_start});
+		}
+
 		inline void perform_bus_cycle_phase1() {
 			// Skew theory of operation: keep a history of the last three states, and apply whichever is selected.
 			character_is_visible_shifter_ = (character_is_visible_shifter_ << 1) | unsigned(character_is_visible_);
@@ -39,6 +39,11 @@ class i8272 : public Storage::Disk::MFMController {
 		void set_dma_acknowledge(bool dack);
 		void set_terminal_count(bool tc);
 
+		/// @returns @c true if any drive is currently stepping towards a sought track.
+		bool is_seeking() const {
+			return drives_seeking_;
+		}
+
 		ClockingHint::Preference preferred_clocking() const final;
 
 	protected:
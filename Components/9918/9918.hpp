@@ -11,8 +11,10 @@
 
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../Reflection/Struct.hpp"
 
 #include <cstdint>
+#include <vector>
 
 namespace TI::TMS {
 
@@ -74,6 +76,15 @@ template <Personality personality> class TMS9918: private Base<personality> {
 		/*! Gets the type of CRT display. */
 		Outputs::Display::DisplayType get_display_type() const;
 
+		/*!
+			Sets the number of frames to withhold from the scan target after each that is posted.
+			Withheld frames are output as sync and blank only, skipping all pixel generation, but
+			sprite collisions and overflow, and all interrupts, continue to be evaluated.
+
+			Not currently supported by the Yamaha VDPs, which will output every frame regardless.
+		*/
+		void set_frame_skip(int frames);
+
 		/*!
 			Runs the VDP for the number of cycles indicate; the input clock rate is implicitly assumed.
 
@@ -124,6 +135,73 @@ template <Personality personality> class TMS9918: private Base<personality> {
 			@returns @c true if the interrupt line is currently active; @c false otherwise.
 		*/
 		bool get_interrupt_line() const;
+
+		/*!
+			Nominates @c flags to receive one flag per 256 bytes of video RAM; the relevant flag is set to a
+			non-zero value upon every write to that RAM. Supply @c nullptr to stop tracking writes.
+
+			Yamaha expansion RAM is not tracked.
+		*/
+		void set_ram_dirty_flags(uint8_t *flags);
+
+		/*! @returns The video RAM, which is @c ram_size() bytes long. */
+		const uint8_t *ram() const;
+		size_t ram_size() const;
+
+		/*!
+			@returns The registers, access latches, status and raster position, packed as bytes for state
+			hashing. Video RAM is not included, nor is the progress of any Yamaha command.
+		*/
+		std::vector<uint8_t> state_summary() const;
+
+	private:
+		friend struct State;
+};
+
+/*!
+	Captures or restores the programmer-visible state of a TMS9918A, plus its position within the frame.
+
+	Fetched but not-yet-output pixels are not captured; they are instead regenerated from the restored
+	registers and video RAM.
+*/
+struct State: public Reflection::StructImpl<State> {
+	uint8_t registers[8]{};
+	std::vector<uint8_t> ram;
+
+	uint8_t status = 0;
+	uint16_t ram_pointer = 0;
+	uint8_t read_ahead_buffer = 0;
+	uint8_t queued_access = 0;
+	int minimum_access_column = 0;
+	bool write_phase = false;
+	uint8_t low_write = 0;
+
+	int row = 0;
+	int column = 0;
+	int clock_residue = 0;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(registers);
+			DeclareField(ram);
+			DeclareField(status);
+			DeclareField(ram_pointer);
+			DeclareField(read_ahead_buffer);
+			DeclareField(queued_access);
+			DeclareField(minimum_access_column);
+			DeclareField(write_phase);
+			DeclareField(low_write);
+			DeclareField(row);
+			DeclareField(column);
+			DeclareField(clock_residue);
+		}
+	}
+
+	/// Captures the state of @c source.
+	State(const TMS9918<Personality::TMS9918A> &source);
+
+	/// Applies this state to @c target, which should have been freshly constructed and given its TV standard.
+	void apply(TMS9918<Personality::TMS9918A> &target);
 };
 
 }
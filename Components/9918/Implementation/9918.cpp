@@ -8,6 +8,7 @@
 
 #include "../9918.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <cstdlib>
@@ -125,6 +126,13 @@ Outputs::Display::DisplayType TMS9918<personality>::get_display_type() const {
 	return this->crt_.get_display_type();
 }
 
+template <Personality personality>
+void TMS9918<personality>::set_frame_skip(int frames) {
+	if constexpr (!is_yamaha_vdp(personality)) {
+		this->frames_to_skip_ = std::max(frames, 0);
+	}
+}
+
 void SpriteBuffer::reset_sprite_collection() {
 	sprites_stopped = false;
 	active_sprite_slot = 0;
@@ -558,7 +566,7 @@ void TMS9918<personality>::run_for(const HalfCycles cycles) {
 					}
 				};
 
-				if(this->draw_line_buffer_->vertical_state != VerticalState::Pixels) {
+				if(this->frame_is_skipped_ || this->draw_line_buffer_->vertical_state != VerticalState::Pixels) {
 					if(
 						this->output_pointer_.row >= this->mode_timing_.first_vsync_line &&
 						this->output_pointer_.row < this->mode_timing_.first_vsync_line + 4
@@ -568,6 +576,26 @@ void TMS9918<personality>::run_for(const HalfCycles cycles) {
 						if(end_column == LineLayout<personality>::CyclesPerLine) {
 							output_sync(LineLayout<personality>::CyclesPerLine);
 						}
+					} else if(this->frame_is_skipped_) {
+						// During a skipped frame only sync and blank are posted to the CRT,
+						// but sprite collisions are still evaluated across the pixel region.
+						left_blank();
+						intersect(
+							LineLayout<personality>::EndOfLeftErase,
+							LineLayout<personality>::EndOfRightBorder,
+							output_blank(end - start));
+						right_blank();
+
+						if(this->draw_line_buffer_->vertical_state == VerticalState::Pixels) {
+							intersect(
+								this->draw_line_buffer_->first_pixel_output_column,
+								this->draw_line_buffer_->next_border_column,
+								this->draw_sprite_collisions(
+									from_internal<personality, Clock::TMSPixel>(start - this->draw_line_buffer_->first_pixel_output_column),
+									from_internal<personality, Clock::TMSPixel>(end - this->draw_line_buffer_->first_pixel_output_column)
+								);
+							);
+						}
 					} else {
 						left_blank();
 						border(LineLayout<personality>::EndOfLeftErase, LineLayout<personality>::EndOfRightBorder);
@@ -651,6 +679,13 @@ void TMS9918<personality>::run_for(const HalfCycles cycles) {
 			if(this->output_pointer_.column == LineLayout<personality>::CyclesPerLine) {
 				this->output_pointer_.column = 0;
 				this->output_pointer_.row = (this->output_pointer_.row + 1) % this->mode_timing_.total_lines;
+
+				// Decide whether the new frame will be output. Frames begin and end at the same
+				// point in the raster, so the CRT sees a continuous signal regardless.
+				if(!this->output_pointer_.row) {
+					this->frame_is_skipped_ = this->frames_skipped_ < this->frames_to_skip_;
+					this->frames_skipped_ = this->frame_is_skipped_ ? this->frames_skipped_ + 1 : 0;
+				}
 			}
 		}
 
@@ -1369,6 +1404,72 @@ void TMS9918<personality>::latch_horizontal_counter() {
 	this->latched_column_ = this->fetch_pointer_.column;
 }
 
+template <Personality personality>
+void TMS9918<personality>::set_ram_dirty_flags(uint8_t *flags) {
+	this->ram_dirty_flags_ = flags;
+}
+
+template <Personality personality>
+const uint8_t *TMS9918<personality>::ram() const {
+	return this->ram_.data();
+}
+
+template <Personality personality>
+size_t TMS9918<personality>::ram_size() const {
+	return this->ram_.size();
+}
+
+template <Personality personality>
+std::vector<uint8_t> TMS9918<personality>::state_summary() const {
+	std::vector<uint8_t> summary;
+	const auto append = [&summary](auto value, int bytes) {
+		for(int c = 0; c < bytes; c++) {
+			summary.push_back(uint8_t(uint32_t(value) >> (c * 8)));
+		}
+	};
+
+	append(this->ram_pointer_, 4);
+	append(this->read_ahead_buffer_, 1);
+	append(this->queued_access_, 1);
+	append(this->minimum_access_column_, 4);
+	append(this->status_, 1);
+	append(this->write_phase_, 1);
+	append(this->low_write_, 1);
+
+	append(this->mode1_enable_, 1);
+	append(this->mode2_enable_, 1);
+	append(this->mode3_enable_, 1);
+	append(this->blank_display_, 1);
+	append(this->sprites_16x16_, 1);
+	append(this->sprites_magnified_, 1);
+	append(this->generate_interrupts_, 1);
+	append(this->pattern_name_address_, 4);
+	append(this->colour_table_address_, 4);
+	append(this->pattern_generator_table_address_, 4);
+	append(this->sprite_attribute_table_address_, 4);
+	append(this->sprite_generator_table_address_, 4);
+	append(this->text_colour_, 1);
+	append(this->background_colour_, 1);
+	append(this->line_interrupt_target_, 1);
+	append(this->line_interrupt_counter_, 1);
+
+	append(this->fetch_pointer_.row, 4);
+	append(this->fetch_pointer_.column, 4);
+	append(this->clock_converter_.residue(), 4);
+
+	if constexpr (is_yamaha_vdp(personality)) {
+		append(Storage<personality>::mode_, 1);
+		append(Storage<personality>::selected_status_, 1);
+		append(Storage<personality>::indirect_register_, 1);
+		append(Storage<personality>::vertical_offset_, 1);
+		for(const auto colour: Storage<personality>::palette_) {
+			append(colour, 4);
+		}
+	}
+
+	return summary;
+}
+
 template class TI::TMS::TMS9918<Personality::TMS9918A>;
 template class TI::TMS::TMS9918<Personality::V9938>;
 //template class TI::TMS::TMS9918<Personality::V9958>;
@@ -1376,3 +1477,72 @@ template class TI::TMS::TMS9918<Personality::SMSVDP>;
 template class TI::TMS::TMS9918<Personality::SMS2VDP>;
 //template class TI::TMS::TMS9918<Personality::GGVDP>;
 //template class TI::TMS::TMS9918<Personality::MDVDP>;
+
+// MARK: - State.
+
+State::State(const TMS9918<Personality::TMS9918A> &source) : State() {
+	// Reconstruct the registers from their effects; bits that have no effect are zero.
+	registers[0] = source.mode2_enable_ ? 0x02 : 0x00;
+	registers[1] = uint8_t(
+		(source.blank_display_ ? 0x00 : 0x40) |
+		(source.generate_interrupts_ ? 0x20 : 0x00) |
+		(source.mode1_enable_ ? 0x10 : 0x00) |
+		(source.mode3_enable_ ? 0x08 : 0x00) |
+		(source.sprites_16x16_ ? 0x02 : 0x00) |
+		(source.sprites_magnified_ ? 0x01 : 0x00)
+	);
+	registers[2] = uint8_t(source.pattern_name_address_ >> 10);
+	registers[3] = uint8_t(source.colour_table_address_ >> 6);
+	registers[4] = uint8_t(source.pattern_generator_table_address_ >> 11);
+	registers[5] = uint8_t(source.sprite_attribute_table_address_ >> 7);
+	registers[6] = uint8_t(source.sprite_generator_table_address_ >> 11);
+	registers[7] = uint8_t((source.text_colour_ << 4) | source.background_colour_);
+
+	ram.assign(source.ram_.begin(), source.ram_.end());
+
+	status = source.status_;
+	ram_pointer = source.ram_pointer_;
+	read_ahead_buffer = source.read_ahead_buffer_;
+	queued_access = uint8_t(source.queued_access_);
+	minimum_access_column = source.minimum_access_column_;
+	write_phase = source.write_phase_;
+	low_write = source.low_write_;
+
+	row = source.fetch_pointer_.row;
+	column = source.fetch_pointer_.column;
+	clock_residue = source.clock_converter_.residue();
+}
+
+void State::apply(TMS9918<Personality::TMS9918A> &target) {
+	for(int c = 0; c < 8; c++) {
+		target.commit_register(c, registers[c]);
+	}
+	std::copy_n(ram.begin(), std::min(ram.size(), target.ram_.size()), target.ram_.begin());
+
+	// A freshly-constructed VDP doesn't consider itself to be within the pixel region until it next
+	// passes the top of the frame; correct that so that the run below fetches as the original did.
+	target.vertical_active_ = target.fetch_pointer_.row < target.mode_timing_.pixel_lines;
+
+	// Establish timing by running until the captured position is reached, which also repopulates
+	// the line buffers; run for at least a whole line first so that they're complete, and allow
+	// up to two frames in case the position is invalid.
+	constexpr int half_cycles_per_line = LineLayout<Personality::TMS9918A>::CyclesPerLine * 4 / 3;
+	target.run_for(HalfCycles(half_cycles_per_line));
+	for(
+		int c = 0;
+		c < 2 * 313 * half_cycles_per_line && (target.fetch_pointer_.row != row || target.fetch_pointer_.column != column);
+		c++
+	) {
+		target.run_for(HalfCycles(1));
+	}
+	target.clock_converter_.set_residue(clock_residue);
+
+	// Apply everything that the run above may have affected.
+	target.status_ = status;
+	target.ram_pointer_ = ram_pointer & 0x3fff;
+	target.read_ahead_buffer_ = read_ahead_buffer;
+	target.queued_access_ = MemoryAccess(std::min(queued_access, uint8_t(MemoryAccess::None)));
+	target.minimum_access_column_ = minimum_access_column;
+	target.write_phase_ = write_phase;
+	target.low_write_ = low_write;
+}
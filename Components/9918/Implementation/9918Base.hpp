@@ -102,6 +102,14 @@ template <Personality personality> struct Base: public Storage<personality> {
 	// This VDP's DRAM.
 	std::array<uint8_t, memory_size(personality)> ram_;
 
+	// Optional per-256-byte-page flags, set upon every write to ram_; cf. TMS9918::set_ram_dirty_flags.
+	uint8_t *ram_dirty_flags_ = nullptr;
+	void mark_ram_dirty(const uint8_t *ram, AddressT address) {
+		if(ram_dirty_flags_ && ram == ram_.data()) {
+			ram_dirty_flags_[address >> 8] = 1;
+		}
+	}
+
 	// State of the DRAM/CRAM-access mechanism.
 	AddressT ram_pointer_ = 0;
 	uint8_t read_ahead_buffer_ = 0;
@@ -480,6 +488,7 @@ template <Personality personality> struct Base: public Storage<personality> {
 						}
 
 						destination[address] = Storage<personality>::command_latch_;
+						mark_ram_dirty(destination, address);
 
 						Storage<personality>::command_->advance();
 						Storage<personality>::update_command_step(access_column);
@@ -496,14 +505,15 @@ template <Personality personality> struct Base: public Storage<personality> {
 						Storage<personality>::next_command_step_ = CommandStep::WriteByte;
 					} break;
 
-					case CommandStep::WriteByte:
-						destination[command_address(context.destination, context.arguments & 0x20) & destination_mask]
-							= context.latched_colour.has_value() ? context.latched_colour.colour : context.colour.colour;
+					case CommandStep::WriteByte: {
+						const auto address = command_address(context.destination, context.arguments & 0x20) & destination_mask;
+						destination[address] = context.latched_colour.has_value() ? context.latched_colour.colour : context.colour.colour;
+						mark_ram_dirty(destination, address);
 						context.latched_colour.reset();
 
 						Storage<personality>::command_->advance();
 						Storage<personality>::update_command_step(access_column);
-					break;
+					} break;
 				}
 			}
 
@@ -575,6 +585,7 @@ template <Personality personality> struct Base: public Storage<personality> {
 					}
 				}
 				ram[address & mask] = read_ahead_buffer_;
+				mark_ram_dirty(ram, address & mask);
 			break;
 			case MemoryAccess::Read:
 				read_ahead_buffer_ = ram[address & mask];
@@ -609,6 +620,12 @@ template <Personality personality> struct Base: public Storage<personality> {
 	uint32_t *pixel_target_ = nullptr, *pixel_origin_ = nullptr;
 	bool asked_for_write_area_ = false;
 
+	// Frame skipping: if frames_to_skip_ is non-zero then that many frames are output as
+	// sync and blank only after each that is output in full; sprite collisions are still evaluated.
+	int frames_to_skip_ = 0;
+	int frames_skipped_ = 0;
+	bool frame_is_skipped_ = false;
+
 	// Output serialisers.
 	template <SpriteMode mode = SpriteMode::Mode1> void draw_tms_character(int start, int end);
 	template <bool apply_blink> void draw_tms_text(int start, int end);
@@ -617,7 +634,8 @@ template <Personality personality> struct Base: public Storage<personality> {
 	template<ScreenMode mode> void draw_yamaha(uint8_t y, int start, int end);
 	void draw_yamaha(uint8_t y, int start, int end);
 
-	template <SpriteMode mode, bool double_width> void draw_sprites(uint8_t y, int start, int end, const std::array<uint32_t, 16> &palette, int *colour_buffer = nullptr);
+	template <SpriteMode mode, bool double_width, bool collisions_only = false> void draw_sprites(uint8_t y, int start, int end, const std::array<uint32_t, 16> &palette, int *colour_buffer = nullptr);
+	void draw_sprite_collisions(int start, int end);
 };
 
 }
@@ -157,6 +157,17 @@ template <Personality personality> class ClockConverter {
 			}
 		}
 
+		/// @returns The current residue in conversion from the external to the internal clock, i.e. the
+		/// phase of the external clock relative to the internal.
+		int residue() const {
+			return cycles_error_;
+		}
+
+		/// Sets the current residue in conversion from the external to the internal clock.
+		void set_residue(int residue) {
+			cycles_error_ = residue;
+		}
+
 	private:
 		// Holds current residue in conversion from the external to
 		// internal clock.
@@ -14,7 +14,7 @@ namespace TI::TMS {
 // MARK: - Sprites, as generalised.
 
 template <Personality personality>
-template <SpriteMode mode, bool double_width>
+template <SpriteMode mode, bool double_width, bool collisions_only>
 void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int end, const std::array<uint32_t, 16> &palette, int *colour_buffer) {
 	if(!draw_line_buffer_->sprites) {
 		return;
@@ -70,11 +70,13 @@ void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int
 
 		// Draw the sprite buffer onto the colour buffer, wherever the tile map doesn't have
 		// priority (or is transparent).
-		for(int c = start; c < end; ++c) {
-			if(
-				sprite_buffer[c] &&
-				(!(colour_buffer[c]&0x20) || !(colour_buffer[c]&0xf))
-			) colour_buffer[c] = sprite_buffer[c];
+		if constexpr (!collisions_only) {
+			for(int c = start; c < end; ++c) {
+				if(
+					sprite_buffer[c] &&
+					(!(colour_buffer[c]&0x20) || !(colour_buffer[c]&0xf))
+				) colour_buffer[c] = sprite_buffer[c];
+			}
 		}
 
 		if(sprite_collision) {
@@ -184,8 +186,10 @@ void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int
 				const uint8_t colour = Storage<personality>::sprite_cache_[index][x];
 
 				// Plot colour, if visible.
-				if(colour) {
-					pixel_origin_[sprite.x + x] = palette[colour & 0xf];
+				if constexpr (!collisions_only) {
+					if(colour) {
+						pixel_origin_[sprite.x + x] = palette[colour & 0xf];
+					}
 				}
 
 				// TODO: is collision location recorded in mode 1?
@@ -224,11 +228,13 @@ void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int
 				sprite_buffer[c] |= sprite_colour;
 
 				// ... but a sprite with the transparent colour won't actually be visible.
-				sprite_colour &= colour_masks[sprite.image[2] & 0xf];
+				if constexpr (!collisions_only) {
+					sprite_colour &= colour_masks[sprite.image[2] & 0xf];
 
-				pixel_origin_[c] =
-					(pixel_origin_[c] & sprite_colour_selection_masks[sprite_colour^1]) |
-					(palette[sprite.image[2] & 0xf] & sprite_colour_selection_masks[sprite_colour]);
+					pixel_origin_[c] =
+						(pixel_origin_[c] & sprite_colour_selection_masks[sprite_colour^1]) |
+						(palette[sprite.image[2] & 0xf] & sprite_colour_selection_masks[sprite_colour]);
+				}
 
 				sprite.shift_position += shift_advance;
 			}
@@ -252,6 +258,30 @@ void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int
 //	an OR mask up until I hit a non-CC sprite, at which point I composite everything out?
 //	I'm not immediately sure whether I can appropriately reuse sprite_buffer, but possibly?
 
+// MARK: - Skipped frames
+
+template <Personality personality>
+void Base<personality>::draw_sprite_collisions(int start, int end) {
+	// Sprites clip themselves upon a call with start = 0, so an empty
+	// range could cause that to happen twice.
+	if(start == end) {
+		return;
+	}
+
+	switch(draw_line_buffer_->fetch_mode) {
+		case FetchMode::SMS:
+			if constexpr (is_sega_vdp(personality)) {
+				draw_sprites<SpriteMode::MasterSystem, false, true>(0, start, end, palette());
+			}
+		break;
+		case FetchMode::Character:
+			draw_sprites<SpriteMode::Mode1, false, true>(0, start, end, palette());
+		break;
+
+		default:	break;	/* No sprites. */
+	}
+}
+
 // MARK: - TMS9918
 
 template <Personality personality>
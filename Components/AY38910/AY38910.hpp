@@ -14,6 +14,9 @@
 
 #include "../../Reflection/Struct.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace GI::AY38910 {
 
 /*!
@@ -111,6 +114,7 @@ template <bool is_stereo> class AY38910: public ::Outputs::Speaker::SampleSource
 		bool is_zero_level() const;
 		void set_sample_volume_range(std::int16_t range);
 		static constexpr bool get_is_stereo() { return is_stereo; }
+		std::size_t get_sample_period() const { return 4; }	// i.e. the internal divider; see get_samples.
 
 	private:
 		Concurrency::AsyncTaskQueue<false> &task_queue_;
@@ -208,6 +212,11 @@ struct State: public Reflection::StructImpl<State> {
 		}
 	}
 
+	template <typename AY> State(const AY &source) : State() {
+		std::copy(std::begin(source.registers_), std::end(source.registers_), std::begin(registers));
+		selected_register = uint8_t(source.selected_register_);
+	}
+
 	template <typename AY> void apply(AY &target) {
 		// Establish emulator-thread state
 		for(uint8_t c = 0; c < 16; c++) {
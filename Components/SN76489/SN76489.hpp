@@ -33,6 +33,7 @@ class SN76489: public Outputs::Speaker::SampleSource {
 		bool is_zero_level() const;
 		void set_sample_volume_range(std::int16_t range);
 		static constexpr bool get_is_stereo() { return false; }
+		std::size_t get_sample_period() const { return std::size_t(master_divider_period_); }
 
 	private:
 		int master_divider_ = 0;
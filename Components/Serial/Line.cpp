@@ -62,6 +62,7 @@ void Line<include_clock>::advance_writer(HalfCycles cycles) {
 				// the final bit if one is attached.
 				if(events_.empty()) {
 					transmission_extra_ = minimum_write_cycles_for_read_delegate_bit();
+					release_events();
 				}
 			} else {
 				events_.front().delay -= integral_cycles;
@@ -121,6 +122,24 @@ template <bool include_clock>
 void Line<include_clock>::reset_writing() {
 	remaining_delays_ = 0;
 	events_.clear();
+	release_events();
+}
+
+template <bool include_clock>
+void Line<include_clock>::set_memory_budget(size_t bytes) {
+	memory_budget_ = bytes;
+	if(events_.empty()) {
+		release_events();
+	}
+}
+
+template <bool include_clock>
+void Line<include_clock>::release_events() {
+	// Storage is retained by default so that a steady stream of writes doesn't
+	// repeatedly reallocate; discard it if it has grown beyond budget.
+	if(get_memory_usage() > memory_budget_) {
+		std::vector<Event>().swap(events_);
+	}
 }
 
 template <bool include_clock>
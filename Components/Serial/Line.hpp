@@ -9,6 +9,8 @@
 #ifndef SerialPort_hpp
 #define SerialPort_hpp
 
+#include <cstddef>
+#include <limits>
 #include <vector>
 #include "../../Storage/Storage.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
@@ -83,6 +85,15 @@ template <bool include_clock> class Line {
 		/// Eliminates all future write states, leaving the output at whatever it is now.
 		void reset_writing();
 
+		/// @returns The number of bytes currently allocated to hold enqueued writes.
+		size_t get_memory_usage() const {
+			return events_.capacity() * sizeof(Event);
+		}
+
+		/// Sets the number of bytes of storage for enqueued writes that may be retained once
+		/// all writes have been played back. Defaults to unlimited.
+		void set_memory_budget(size_t bytes);
+
 		struct ReadDelegate {
 			virtual bool serial_line_did_produce_bit(Line *line, int bit) = 0;
 		};
@@ -115,6 +126,9 @@ template <bool include_clock> class Line {
 			int delay;
 		};
 		std::vector<Event> events_;
+		size_t memory_budget_ = std::numeric_limits<size_t>::max();
+		void release_events();
+
 		HalfCycles::IntType remaining_delays_ = 0;
 		HalfCycles::IntType transmission_extra_ = 0;
 		bool level_ = true;
@@ -20,6 +20,18 @@ ReflectableEnum(Display,
 	CompositeMonochrome
 );
 
+ReflectableEnum(ProcessorSpeed,
+	Original,
+	Double,
+	Quadruple,
+	Octuple
+);
+
+/// @returns The processor clock multiplier implied by @c speed.
+constexpr int processor_speed_multiplier(ProcessorSpeed speed) {
+	return 1 << int(speed);
+}
+
 //===
 // From here downward are a bunch of templates for individual option flags.
 // Using them saves you marginally in syntax, but the primary gain is to
@@ -49,6 +61,18 @@ template <typename Owner> class QuickloadOption {
 		}
 };
 
+template <typename Owner> class ProcessorSpeedOption {
+	public:
+		Configurable::ProcessorSpeed processor_speed;
+		ProcessorSpeedOption(Configurable::ProcessorSpeed processor_speed) : processor_speed(processor_speed) {}
+
+	protected:
+		void declare_processor_speed_option() {
+			static_cast<Owner *>(this)->declare(&processor_speed, "processor_speed");
+			AnnounceEnumNS(Configurable, ProcessorSpeed);
+		}
+};
+
 template <typename Owner> class QuickbootOption {
 	public:
 		bool quickboot;
@@ -60,6 +84,28 @@ template <typename Owner> class QuickbootOption {
 		}
 };
 
+template <typename Owner> class ParallelSubsystemsOption {
+	public:
+		bool parallel_subsystems;
+		ParallelSubsystemsOption(bool parallel_subsystems) : parallel_subsystems(parallel_subsystems) {}
+
+	protected:
+		void declare_parallel_subsystems_option() {
+			static_cast<Owner *>(this)->declare(&parallel_subsystems, "parallel_subsystems");
+		}
+};
+
+template <typename Owner> class FrameSkipOption {
+	public:
+		int frame_skip;
+		FrameSkipOption(int frame_skip) : frame_skip(frame_skip) {}
+
+	protected:
+		void declare_frame_skip_option() {
+			static_cast<Owner *>(this)->declare(&frame_skip, "frame_skip");
+		}
+};
+
 }
 
 #endif /* StandardOptions_hpp */
@@ -57,6 +57,18 @@ void Executor::run_for(Cycles cycles) {
 	CachingExecutor::run_for(cycles_.divide(Cycles(4)).as<int>());
 }
 
+void Executor::run_idle_for(Cycles cycles) {
+	cycles_ += cycles;
+	const int duration = cycles_.divide(Cycles(4)).as<int>();
+	update_timers(duration);
+	cycles_since_port_handler_ += Cycles(duration);
+	port_handler_.run_ports_for(cycles_since_port_handler_.flush<Cycles>());
+}
+
+bool Executor::has_pending_timer() const {
+	return !(timer_control_ & 0x20);
+}
+
 void Executor::reset() {
 	// Just jump to the reset vector.
 	set_program_counter(uint16_t(memory_[0x1ffe] | (memory_[0x1fff] << 8)));
@@ -784,6 +796,10 @@ inline void Executor::subtract_duration(int duration) {
 	// Update count for potential port accesses.
 	cycles_since_port_handler_ += Cycles(duration);
 
+	update_timers(duration);
+}
+
+inline void Executor::update_timers(int duration) {
 	// Update timer 1 and 2 prescaler.
 	constexpr int t12_divider = 4;		// A divide by 4 has already been applied before counting instruction lengths; therefore
 										// this additional divide by 4 produces the correct net divide by 16.
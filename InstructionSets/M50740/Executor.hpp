@@ -50,6 +50,18 @@ class Executor: public CachingExecutor {
 		*/
 		void run_for(Cycles cycles);
 
+		/*!
+			Advances time by @c cycles without executing any instructions, updating only the timers and
+			the port handler; this is appropriate if the processor is known to have nothing to do.
+		*/
+		void run_idle_for(Cycles cycles);
+
+		/*!
+			@returns @c true if timer X is running; timers 1 and 2 count continuously so can't
+				indicate that the processor has work to do.
+		*/
+		bool has_pending_timer() const;
+
 	private:
 		// MARK: - CachingExecutor-facing interface.
 
@@ -150,6 +162,7 @@ class Executor: public CachingExecutor {
 		int timer_divider_ = 0;
 		Timer timers_[3], prescalers_[2];
 		inline int update_timer(Timer &timer, int count);
+		inline void update_timers(int duration);
 
 		// Interrupt and timer control.
 		uint8_t interrupt_control_ = 0, timer_control_ = 0;
@@ -13,6 +13,8 @@
 
 #include "../../Processors/68000/68000.hpp"
 
+#include "../../ClockReceiver/ProcessorClockMultiplier.hpp"
+
 #include "../../Analyser/Static/Amiga/Target.hpp"
 
 #include "../Utility/MemoryPacker.hpp"
@@ -49,6 +51,7 @@ class ConcreteMachine:
 	public MachineTypes::MouseMachine,
 	public MachineTypes::ScanProducer,
 	public MachineTypes::TimedMachine,
+	public Configurable::Device,
 	public Machine {
 	public:
 		ConcreteMachine(const Analyser::Static::Amiga::Target &target, const ROMMachine::ROMFetcher &rom_fetcher) :
@@ -83,13 +86,37 @@ class ConcreteMachine:
 		template <typename Microcycle> HalfCycles perform_bus_operation(const Microcycle &cycle, int) {
 
 			// Do a quick advance check for Chip RAM access; add a suitable delay if required.
+			//
+			// If the processor is running faster than original then its time is mapped to that of
+			// the chipset. Chip RAM accesses nevertheless remain synchronised to the chipset's slots.
+			//
+			// Anything that can't reach the chipset — e.g. fast RAM and Kickstart accesses, or idle
+			// cycles — merely accrues chipset time, which is paid off at the next access that can reach
+			// the chipset or at the chipset's next sequence point, whichever comes first.
 			HalfCycles total_length;
 			if(cycle.operation & Microcycle::NewAddress && *cycle.address < 0x20'0000) {
-				total_length = chipset_.run_until_after_cpu_slot().duration;
+				flush_chipset();
+				total_length = processor_clock_.processor_time(chipset_.run_until_after_cpu_slot().duration);
 				assert(total_length >= cycle.length);
 			} else {
 				total_length = cycle.length;
-				chipset_.run_for(total_length);
+
+				// The chipset can change only when it is run or accessed, each of which leaves no
+				// time accrued, so the sequence point needs to be obtained only at such points.
+				if(chipset_time_ == HalfCycles(0)) {
+					chipset_sequence_point_ = chipset_.get_next_sequence_point();
+				}
+				chipset_time_ += processor_clock_.machine_time(total_length);
+				if(
+					chipset_time_ >= chipset_sequence_point_ ||
+					cycle.operation & (Microcycle::Reset | Microcycle::InterruptAcknowledge) ||
+					(
+						cycle.operation & (Microcycle::NewAddress | Microcycle::SameAddress) &&
+						reaches_chipset(*cycle.address & 0xff'ffff)
+					)
+				) {
+					flush_chipset();
+				}
 			}
 			mc68000_.set_interrupt_level(chipset_.get_interrupt_level());
 
@@ -186,6 +213,20 @@ class ConcreteMachine:
 		// MARK: - Chipset.
 
 		Chipset chipset_;
+		HalfCycles chipset_time_, chipset_sequence_point_;
+
+		/// @returns @c true if an access to @c address might observe or affect chipset state — i.e. it
+		/// is to chip RAM or to anything other than plain memory.
+		bool reaches_chipset(uint32_t address) const {
+			return address < 0x20'0000 || !memory_.regions[address >> 18].read_write_mask;
+		}
+
+		/// Brings the chipset up to date with the CPU.
+		void flush_chipset() {
+			if(chipset_time_ == HalfCycles(0)) return;
+			chipset_.run_for(chipset_time_);
+			chipset_time_ = HalfCycles(0);
+		}
 
 		// MARK: - Activity Source
 
@@ -212,7 +253,8 @@ class ConcreteMachine:
 		// MARK: - MachineTypes::TimedMachine.
 
 		void run_for(const Cycles cycles) final {
-			mc68000_.run_for(cycles);
+			mc68000_.run_for(processor_clock_.processor_time(cycles));
+			flush_chipset();
 		}
 
 		void flush_output(int) final {
@@ -245,6 +287,23 @@ class ConcreteMachine:
 		void clear_all_keys() {
 			chipset_.get_keyboard().clear_all_keys();
 		}
+
+		// MARK: - Configuration options.
+
+		ProcessorClockMultiplier<HalfCycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
+
+		std::unique_ptr<Reflection::Struct> get_options() final {
+			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
+			options->processor_speed = processor_speed_;
+			return options;
+		}
+
+		void set_options(const std::unique_ptr<Reflection::Struct> &str) final {
+			const auto options = dynamic_cast<Options *>(str.get());
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
+		}
 	};
 
 }
@@ -9,6 +9,8 @@
 #ifndef Amiga_hpp
 #define Amiga_hpp
 
+#include "../../Configurable/Configurable.hpp"
+#include "../../Configurable/StandardOptions.hpp"
 #include "../../Analyser/Static/StaticAnalyser.hpp"
 #include "../ROMMachine.hpp"
 
@@ -20,6 +22,20 @@ class Machine {
 
 		/// Creates and returns an Amiga.
 		static Machine *Amiga(const Analyser::Static::Target *target, const ROMMachine::ROMFetcher &rom_fetcher);
+
+		/// Defines the runtime options available for an Amiga.
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::ProcessorSpeedOption<Options> {
+			friend Configurable::ProcessorSpeedOption<Options>;
+			public:
+				Options(Configurable::OptionsType) :
+					Configurable::ProcessorSpeedOption<Options>(Configurable::ProcessorSpeed::Original) {
+					if(needs_declare()) {
+						declare_processor_speed_option();
+					}
+				}
+		};
 };
 
 }
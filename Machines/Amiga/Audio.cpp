@@ -89,6 +89,21 @@ void Audio::set_interrupt_requests(uint16_t requests) {
 	channels_[3].interrupt_pending = requests & uint16_t(InterruptFlag::AudioChannel3);
 }
 
+bool Audio::is_idle() const {
+	for(const auto &channel: channels_) {
+		// A disabled channel will begin playing, and later interrupt, upon DMA being enabled or
+		// upon new data with no interrupt pending; cf. output<State::Disabled>.
+		if(
+			channel.state != Channel::State::Disabled ||
+			channel.dma_enabled ||
+			(!channel.wants_data && !channel.interrupt_pending)
+		) {
+			return false;
+		}
+	}
+	return true;
+}
+
 // MARK: - DMA and mixing.
 
 bool Audio::advance_dma(int channel) {
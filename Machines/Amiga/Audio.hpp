@@ -57,6 +57,10 @@ class Audio: public DMADevice<4> {
 		/// Sets which interrupt requests are currently active.
 		void set_interrupt_requests(uint16_t);
 
+		/// @returns @c true if no channel is able to post an interrupt until
+		/// further data or settings are supplied; @c false otherwise.
+		bool is_idle() const;
+
 		/// Obtains the output source.
 		Outputs::Speaker::Speaker *get_speaker() {
 			return &speaker_;
@@ -819,6 +819,45 @@ void Chipset::post_bitplanes(const BitplaneData &data) {
 	previous_bitplanes_ = next_bitplanes_;
 }
 
+HalfCycles Chipset::get_next_sequence_point() {
+	// The end of the line is where vertical blank is signalled and the CIAs' TOD counters advance.
+	HalfCycles limit((line_length_ * 4) - line_cycle_);
+
+	// The Copper could write to INTENA or INTREQ, so is relevant regardless of which interrupts are enabled.
+	constexpr auto CopperEnabled = DMAFlag::AllBelow | DMAFlag::Copper;
+	if((dma_control_ & CopperEnabled) == CopperEnabled) {
+		const auto position = uint16_t(((y_ & 0xff) << 8) | (line_cycle_ >> 2));
+		const int copper_cycle = copper_.next_write_position(position) << 2;
+		limit = std::min(limit, HalfCycles(std::max(copper_cycle - line_cycle_, 0)));
+	}
+
+	// Everything else matters only if it could produce an enabled interrupt.
+	const uint16_t enabled = (interrupt_enable_ & 0x4000) ? interrupt_enable_ : 0;
+	constexpr auto AudioInterrupts =
+		InterruptFlag::AudioChannel0 | InterruptFlag::AudioChannel1 | InterruptFlag::AudioChannel2 | InterruptFlag::AudioChannel3;
+	constexpr auto DiskInterrupts =
+		InterruptFlag::DiskBlock | InterruptFlag::DiskSyncMatch | InterruptFlag::External;	// CIA B receives the index hole.
+
+	if(
+		(enabled & InterruptFlag::Blitter && blitter_.get_status() & 0x4000) ||
+		(enabled & AudioInterrupts && !audio_.is_idle()) ||
+		(enabled & DiskInterrupts && (!disk_controller_is_sleeping_ || disk_.has_enqueued_words())) ||
+		(enabled & InterruptFlag::IOPortsAndTimers && cia_a.serial_input.write_data_time_remaining() > HalfCycles(0))
+	) {
+		return HalfCycles(0);
+	}
+
+	// CIA time is measured in E clocks, each 20 half cycles of chipset time.
+	const auto cia_limit = [&](HalfCycles e_clocks) {
+		if(e_clocks == HalfCycles::max()) return;
+		limit = std::min(limit, std::max(HalfCycles(e_clocks.as<int>() * 20) - cia_divider_, HalfCycles(0)));
+	};
+	if(enabled & InterruptFlag::IOPortsAndTimers) cia_limit(cia_a.get_next_sequence_point());
+	if(enabled & InterruptFlag::External) cia_limit(cia_b.get_next_sequence_point());
+
+	return limit;
+}
+
 void Chipset::update_interrupts() {
 	audio_.set_interrupt_requests(interrupt_requests_);
 	interrupt_level_ = 0;
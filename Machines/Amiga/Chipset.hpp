@@ -68,10 +68,23 @@ class Chipset: private ClockingHint::Observer {
 			return interrupt_level_;
 		}
 
+		/// @returns A lower bound on the time until the chipset's interrupt output might next change, absent any
+		/// intervening CPU access to the chipset: the earliest of the end of the current line, the next possible
+		/// underflow of an enabled CIA timer and the Copper's next possible register write; or no time at all if
+		/// the Blitter, audio, disk or keyboard could post an enabled interrupt. A change in interrupt level
+		/// reaches the CPU without it making any access, so it must not run beyond this point without the chipset.
+		HalfCycles get_next_sequence_point();
+
 		/// Inserts the disks provided.
 		/// @returns @c true if anything was inserted; @c false otherwise.
 		bool insert(const std::vector<std::shared_ptr<Storage::Disk::Disk>> &disks);
 
+		/// Enables or disables the satisfaction of sync-word disk DMA reads directly from the track under
+		/// the head, rather than bit by bit; they are enabled by default.
+		void set_fast_disk_reads_enabled(bool enabled) {
+			disk_controller_.set_fast_reads_enabled(enabled);
+		}
+
 		// The standard CRT set.
 		void set_scan_target(Outputs::Display::ScanTarget *scan_target);
 		Outputs::Display::ScanStatus get_scaled_scan_status() const;
@@ -303,6 +316,16 @@ class Chipset: private ClockingHint::Observer {
 
 				void enqueue(uint16_t value, bool matches_sync);
 
+				/// Writes @c count words from @c words directly to memory, exactly as if they
+				/// had been enqueued and then DMA'd. The final word of a transfer is never
+				/// written, so that it can instead be enqueued and DSKBLK signalled in its slot.
+				void deliver(const uint16_t *words, size_t count);
+
+				/// @returns @c true if words have been enqueued that are yet to be written to memory.
+				bool has_enqueued_words() const {
+					return buffer_read_ != buffer_write_;
+				}
+
 			private:
 				uint16_t length_;
 				bool dma_enable_ = false;
@@ -327,9 +350,7 @@ class Chipset: private ClockingHint::Observer {
 				void set_mtr_sel_side_dir_step(uint8_t);
 				uint8_t get_rdy_trk0_wpro_chng();
 
-				void run_for(Cycles duration) {
-					Storage::Disk::Controller::run_for(duration);
-				}
+				void run_for(Cycles duration);
 
 				bool insert(const std::shared_ptr<Storage::Disk::Disk> &disk, size_t drive);
 				void set_activity_observer(Activity::Observer *);
@@ -337,6 +358,21 @@ class Chipset: private ClockingHint::Observer {
 				void set_sync_word(uint16_t);
 				void set_control(uint16_t);
 
+				/// Attempts to satisfy a DMA read of @c length words, to begin with the next sync word,
+				/// directly from the track under the head rather than bit by bit. Words are then delivered,
+				/// and interrupts raised, at the times they would otherwise have been.
+				///
+				/// @returns @c true if the read will be satisfied in that way; @c false otherwise.
+				bool begin_fast_read(uint16_t length);
+
+				/// Cancels any fast read in progress, resuming bit-by-bit reading.
+				void end_fast_read();
+
+				/// Permits or prohibits future use of begin_fast_read.
+				void set_fast_reads_enabled(bool enabled) {
+					fast_reads_enabled_ = enabled;
+				}
+
 			private:
 				void process_input_bit(int value) final;
 				void process_index_hole() final;
@@ -350,11 +386,28 @@ class Chipset: private ClockingHint::Observer {
 				int bit_count_ = 0;
 				uint16_t sync_word_ = 0x4489;	// TODO: confirm or deny guess.
 				bool sync_with_word_ = false;
+				int bit_rate_ = 250'000;
 
 				Chipset &chipset_;
 				DiskDMA &disk_dma_;
 				CIAB &cia_;
 
+				// Fast read state; the serialisation of the most-recently fast-read track is
+				// retained, since a read is often retried.
+				const Cycles::IntType cycles_per_revolution_;
+				std::shared_ptr<Storage::Disk::Track> serialised_track_;
+				int serialised_bit_rate_ = 0;
+				std::vector<bool> serialisation_;
+
+				bool fast_reads_enabled_ = true;
+				bool is_fast_reading_ = false;
+				Cycles::IntType fast_read_time_ = 0, skipped_time_ = 0;
+				std::vector<uint16_t> fast_words_;
+				std::vector<Cycles::IntType> fast_word_times_, fast_sync_times_;
+				size_t fast_words_delivered_ = 0, fast_syncs_posited_ = 0;
+				void advance_fast_read();
+				void skip_drives();
+
 		} disk_controller_;
 		friend DiskController;
 
@@ -31,6 +31,30 @@ bool satisfies_raster(uint16_t position, uint16_t blitter_status, uint16_t *inst
 	return (position & mask) >= (instruction[0] & mask);
 }
 
+/// @returns the earliest position after @c position on the same line at which the raster test of
+/// @c instruction could be satisfied, or the final position on the line if there is none.
+/// Assumes that the raster test is not satisfied at @c position itself.
+uint16_t next_raster_position(uint16_t position, uint16_t *instruction) {
+	const uint16_t mask = 0x8000 | (instruction[1] & 0x7ffe);
+	const uint16_t line = position & 0xff00;
+
+	// Were the line's vertical position already beyond the target then the test
+	// would have been satisfied, so either it's before, in which case nowhere
+	// on this line will do, or it's equal and the horizontal test decides.
+	if((line & mask) != (instruction[0] & mask & 0xff00)) {
+		return line | 0xff;
+	}
+
+	const uint16_t horizontal_mask = mask & 0xff;
+	const uint16_t horizontal_target = instruction[0] & horizontal_mask;
+	for(uint16_t x = (position & 0xff) + 1; x < 0xff; x++) {
+		if((x & horizontal_mask) >= horizontal_target) {
+			return line | x;
+		}
+	}
+	return line | 0xff;
+}
+
 }
 
 //
@@ -79,7 +103,7 @@ bool satisfies_raster(uint16_t position, uint16_t blitter_status, uint16_t *inst
 //			b8–b14:	vertical beam comparison mask
 //			b15:	1 => don't also test whether the Blitter is finished; 0 => test.
 //
-bool Copper::advance_dma(uint16_t position, uint16_t blitter_status) {
+bool Copper::perform_dma(uint16_t position, uint16_t blitter_status) {
 	switch(state_) {
 		default: return false;
 
@@ -87,6 +111,12 @@ bool Copper::advance_dma(uint16_t position, uint16_t blitter_status) {
 			if(satisfies_raster(position, blitter_status, instruction_)) {
 				LOG("Unblocked waiting for " << PADHEX(4) << instruction_[0] << " at " << PADHEX(4) << position << " with mask " << PADHEX(4) << (instruction_[1] & 0x7ffe));
 				state_ = State::FetchFirstWord;
+			} else if(satisfies_raster(position, 0, instruction_)) {
+				// The raster test is satisfied but the Blitter is still busy; keep checking every slot.
+				wake_position_ = position;
+			} else {
+				// Sleep until the raster test might be satisfied.
+				wake_position_ = next_raster_position(position, instruction_);
 			}
 		return false;
 
@@ -133,6 +163,7 @@ bool Copper::advance_dma(uint16_t position, uint16_t blitter_status) {
 				// $FFDF,$FFFE seems to suggest evaluation will happen
 				// in the next cycle rather than this one.
 				state_ = State::Waiting;
+				wake_position_ = 0;
 				break;
 			}
 
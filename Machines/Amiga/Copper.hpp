@@ -11,6 +11,8 @@
 
 #include "DMADevice.hpp"
 
+#include <algorithm>
+
 namespace Amiga {
 
 class Copper: public DMADevice<2> {
@@ -20,7 +22,19 @@ class Copper: public DMADevice<2> {
 		/// Offers a DMA slot to the Copper, specifying the current beam position and Blitter status.
 		///
 		/// @returns @c true if the slot was used; @c false otherwise.
-		bool advance_dma(uint16_t position, uint16_t blitter_status);
+		bool advance_dma(uint16_t position, uint16_t blitter_status) {
+			// While waiting, skip all slots on the current line before the first at which
+			// the raster could possibly satisfy the WAIT. The full test is applied again
+			// from that point, or upon a change of line.
+			if(
+				state_ == State::Waiting &&
+				(position & 0xff00) == (wake_position_ & 0xff00) &&
+				position < wake_position_
+			) {
+				return false;
+			}
+			return perform_dma(position, blitter_status);
+		}
 
 		/// Forces a reload of address @c id (i.e. 0 or 1) and restarts the Copper.
 		template <int id> void reload() {
@@ -38,6 +52,24 @@ class Copper: public DMADevice<2> {
 			state_ = State::Stopped;
 		}
 
+		/// @returns The earliest horizontal position on the line of @c position, no earlier than @c position itself,
+		/// at which the Copper might write to a register; @c 0xff if it is known that it will not do so on this line.
+		uint16_t next_write_position(uint16_t position) const {
+			switch(state_) {
+				case State::Stopped:
+				return 0xff;
+
+				case State::Waiting:
+					if((position & 0xff00) == (wake_position_ & 0xff00)) {
+						return uint16_t(std::max(position & 0xff, wake_position_ & 0xff));
+					}
+				[[fallthrough]];
+
+				default:
+				return position & 0xff;
+			}
+		}
+
 	private:
 		uint32_t address_ = 0;
 		uint16_t control_ = 0;
@@ -47,6 +79,11 @@ class Copper: public DMADevice<2> {
 		} state_ = State::Stopped;
 		bool skip_next_ = false;
 		uint16_t instruction_[2]{};
+
+		/// The position, on the line last inspected, before which an ongoing WAIT cannot be satisfied.
+		uint16_t wake_position_ = 0;
+
+		bool perform_dma(uint16_t position, uint16_t blitter_status);
 };
 
 }
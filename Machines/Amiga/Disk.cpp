@@ -8,6 +8,10 @@
 
 #include "Chipset.hpp"
 
+#include "../../Storage/Disk/Track/TrackSerialiser.hpp"
+
+#include <algorithm>
+
 #ifndef NDEBUG
 #define NDEBUG
 #endif
@@ -17,6 +21,16 @@
 
 using namespace Amiga;
 
+namespace {
+
+constexpr int RevolutionsPerMinute = 300;
+
+/// The number of words at the end of a fast read that are left for the DMA slots to collect,
+/// so that the transfer ends, and DSKBLK is signalled, exactly as it would bit by bit.
+constexpr size_t SlottedWords = 4;
+
+}
+
 // MARK: - Disk DMA.
 
 void Chipset::DiskDMA::enqueue(uint16_t value, bool matches_sync) {
@@ -38,7 +52,19 @@ void Chipset::DiskDMA::set_control(uint16_t control) {
 	sync_with_word_ = control & 0x400;
 }
 
+void Chipset::DiskDMA::deliver(const uint16_t *words, size_t count) {
+	while(count-- && length_ > 1) {
+		ram_[pointer_[0] & ram_mask_] = *words;
+		++words;
+		++pointer_[0];
+		--length_;
+	}
+}
+
 void Chipset::DiskDMA::set_length(uint16_t value) {
+	// Any fast read in progress was for the previous length.
+	chipset_.disk_controller_.end_fast_read();
+
 	if(value == last_set_length_) {
 		dma_enable_ = value & 0x8000;
 		write_ = value & 0x4000;
@@ -50,6 +76,11 @@ void Chipset::DiskDMA::set_length(uint16_t value) {
 		}
 
 		state_ = sync_with_word_ ? State::WaitingForSync : State::Reading;
+
+		// Reads that begin with a sync word can be performed in one go.
+		if(dma_enable_ && !write_ && length_ && state_ == State::WaitingForSync) {
+			chipset_.disk_controller_.begin_fast_read(length_);
+		}
 	}
 
 	last_set_length_ = value;
@@ -83,14 +114,168 @@ Chipset::DiskController::DiskController(Cycles clock_rate, Chipset &chipset, Dis
 	Storage::Disk::Controller(clock_rate),
 	chipset_(chipset),
 	disk_dma_(disk_dma),
-	cia_(cia) {
+	cia_(cia),
+	cycles_per_revolution_(clock_rate.as_integral() * 60 / RevolutionsPerMinute) {
 
 	// Add four drives.
 	for(int c = 0; c < 4; c++) {
-		emplace_drive(clock_rate.as<int>(), 300, 2, Storage::Disk::Drive::ReadyType::IBMRDY);
+		emplace_drive(clock_rate.as<int>(), RevolutionsPerMinute, 2, Storage::Disk::Drive::ReadyType::IBMRDY);
+	}
+}
+
+void Chipset::DiskController::run_for(Cycles duration) {
+	if(is_fast_reading_) {
+		// Disk DMA may have been disabled since the fast read began.
+		constexpr auto DiskEnabled = DMAFlag::AllBelow | DMAFlag::Disk;
+		if((chipset_.dma_control_ & DiskEnabled) != DiskEnabled) {
+			end_fast_read();
+		}
+	}
+
+	if(!is_fast_reading_) {
+		Storage::Disk::Controller::run_for(duration);
+		return;
+	}
+
+	// Publish whatever would have arrived by now. The drives themselves need to
+	// catch up only in time to announce the next index hole.
+	fast_read_time_ += duration.as_integral();
+	skipped_time_ += duration.as_integral();
+	if(
+		Cycles::IntType(get_drive().get_rotation() * float(cycles_per_revolution_)) + skipped_time_ >= cycles_per_revolution_
+	) {
+		skip_drives();
+	}
+	advance_fast_read();
+}
+
+void Chipset::DiskController::skip_drives() {
+	const auto duration = Cycles(skipped_time_);
+	for_all_drives([duration] (Storage::Disk::Drive &drive, size_t) {
+		drive.skip_for(duration);
+	});
+	skipped_time_ = 0;
+}
+
+bool Chipset::DiskController::begin_fast_read(uint16_t length) {
+	auto &drive = get_drive();
+	constexpr auto DiskEnabled = DMAFlag::AllBelow | DMAFlag::Disk;
+	if(
+		!fast_reads_enabled_ ||
+		!sync_with_word_ ||
+		!is_reading() ||
+		!drive.get_motor_on() ||
+		(chipset_.dma_control_ & DiskEnabled) != DiskEnabled
+	) {
+		return false;
+	}
+
+	const auto track = drive.get_track();
+	if(!track) return false;
+
+	// Obtain a serialisation of the track, from the index hole onwards.
+	if(track != serialised_track_ || bit_rate_ != serialised_bit_rate_) {
+		serialised_track_ = track;
+		serialised_bit_rate_ = bit_rate_;
+		serialisation_ = Storage::Disk::track_serialisation(
+			*track,
+			Storage::Time(RevolutionsPerMinute / 60, bit_rate_)
+		).data;
+	}
+	const size_t track_length = serialisation_.size();
+	if(track_length < 16) return false;
+
+	// Run the same logic as process_input_bit across the serialisation, starting from the
+	// bit now under the head, until either the read is complete or it is clear that there
+	// is no sync word on this track.
+	const size_t start = size_t(drive.get_rotation() * float(track_length)) % track_length;
+	const auto bit_time = [&] (size_t bit) {
+		return Cycles::IntType(bit) * cycles_per_revolution_ / Cycles::IntType(track_length);
+	};
+
+	fast_words_.clear();
+	fast_word_times_.clear();
+	fast_sync_times_.clear();
+
+	uint16_t data = data_;
+	int bit_count = bit_count_;
+	for(size_t bit = 1; fast_words_.size() < length; ++bit) {
+		if(fast_sync_times_.empty() && bit > track_length + 16) {
+			return false;
+		}
+
+		data = uint16_t((data << 1) | serialisation_[(start + bit - 1) % track_length]);
+		++bit_count;
+
+		const bool sync_matches = data == sync_word_;
+		if(sync_matches) {
+			fast_sync_times_.push_back(bit_time(bit));
+			bit_count = 0;
+		}
+
+		// The first sync match starts the DMA; everything thereafter is data.
+		if(!(bit_count & 15) && !(sync_matches && fast_sync_times_.size() == 1)) {
+			if(!fast_sync_times_.empty()) {
+				fast_words_.push_back(data);
+				fast_word_times_.push_back(bit_time(bit));
+			}
+		}
+	}
+
+	LOG("Fast read of " << length << " words, completing after " << fast_word_times_.back() << " cycles");
+	is_fast_reading_ = true;
+	fast_read_time_ = 0;
+	fast_words_delivered_ = fast_syncs_posited_ = 0;
+	return true;
+}
+
+void Chipset::DiskController::advance_fast_read() {
+	while(fast_syncs_posited_ < fast_sync_times_.size() && fast_sync_times_[fast_syncs_posited_] <= fast_read_time_) {
+		chipset_.posit_interrupt(InterruptFlag::DiskSyncMatch);
+
+		// As per process_input_bit, the first sync match is what starts the DMA.
+		if(!fast_syncs_posited_) {
+			disk_dma_.enqueue(sync_word_, true);
+		}
+		++fast_syncs_posited_;
+	}
+
+	size_t arrived = fast_words_delivered_;
+	while(arrived < fast_words_.size() && fast_word_times_[arrived] <= fast_read_time_) {
+		++arrived;
+	}
+
+	// Write most words directly; enqueue the rest for the DMA slots.
+	const size_t direct = std::min(arrived, fast_words_.size() - std::min(fast_words_.size(), SlottedWords));
+	if(direct > fast_words_delivered_) {
+		disk_dma_.deliver(&fast_words_[fast_words_delivered_], direct - fast_words_delivered_);
+		fast_words_delivered_ = direct;
+	}
+	while(fast_words_delivered_ < arrived) {
+		disk_dma_.enqueue(fast_words_[fast_words_delivered_], false);
+		++fast_words_delivered_;
+	}
+
+	if(fast_words_delivered_ == fast_words_.size()) {
+		end_fast_read();
 	}
 }
 
+void Chipset::DiskController::end_fast_read() {
+	if(!is_fast_reading_) return;
+	is_fast_reading_ = false;
+	skip_drives();
+
+	// Resume bit-by-bit reading with the most recent 16 bits in the shift register;
+	// word alignment will be re-established by the next sync match.
+	const size_t track_length = serialisation_.size();
+	const size_t position = size_t(get_drive().get_rotation() * float(track_length)) + track_length;
+	for(size_t bit = 16; bit > 0; --bit) {
+		data_ = uint16_t((data_ << 1) | serialisation_[(position - bit) % track_length]);
+	}
+	bit_count_ = 0;
+}
+
 void Chipset::DiskController::process_input_bit(int value) {
 	data_ = uint16_t((data_ << 1) | value);
 	++bit_count_;
@@ -110,6 +295,7 @@ void Chipset::DiskController::process_input_bit(int value) {
 }
 
 void Chipset::DiskController::set_sync_word(uint16_t value) {
+	end_fast_read();
 	LOG("Set disk sync word to " << PADHEX(4) << value);
 	sync_word_ = value;
 }
@@ -121,11 +307,13 @@ void Chipset::DiskController::set_control(uint16_t control) {
 	// b9: 1 => sync on MSB (Disk II style, presumably?); 0 => don't.
 	// b8: 1 => 2µs per bit; 0 => 4µs.
 
+	end_fast_read();
 	sync_with_word_ = control & 0x400;
+	bit_rate_ = (control & 0x100) ? 500'000 : 250'000;
 
 	Storage::Time bit_length;
 	bit_length.length = 1;
-	bit_length.clock_rate = (control & 0x100) ? 500000 : 250000;
+	bit_length.clock_rate = unsigned(bit_rate_);
 	set_expected_bit_length(bit_length);
 
 	LOG((sync_with_word_ ? "Will" : "Won't") << " sync with word; bit length is " << ((control & 0x100) ? "short" : "long"));
@@ -152,6 +340,11 @@ void Chipset::DiskController::set_mtr_sel_side_dir_step(uint8_t value) {
 	// b1: DIR
 	// b0: /STEP
 
+	// Any change of drive, side or track ends a fast read.
+	if(value != previous_select_) {
+		end_fast_read();
+	}
+
 	// Select active drive.
 	set_drive(((value >> 3) & 0x0f) ^ 0x0f);
 
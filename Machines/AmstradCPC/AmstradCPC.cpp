@@ -12,12 +12,15 @@
 #include "FDC.hpp"
 
 #include "../../Processors/Z80/Z80.hpp"
+#include "../../Processors/Z80/State/State.hpp"
 
 #include "../../Components/6845/CRTC6845.hpp"
 #include "../../Components/8255/i8255.hpp"
 #include "../../Components/AY38910/AY38910.hpp"
 
+#include "../Utility/MemoryAccount.hpp"
 #include "../Utility/MemoryFuzzer.hpp"
+#include "../Utility/StateHasher.hpp"
 #include "../Utility/Typer.hpp"
 
 #include "../../Activity/Source.hpp"
@@ -27,6 +30,8 @@
 #include "../../Storage/Tape/Parsers/Spectrum.hpp"
 
 #include "../../ClockReceiver/ForceInline.hpp"
+#include "../../ClockReceiver/JustInTime.hpp"
+#include "../../ClockReceiver/ProcessorClockMultiplier.hpp"
 #include "../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
 #include "../../Outputs/CRT/CRT.hpp"
 
@@ -104,6 +109,11 @@ class InterruptTimer {
 			interrupt_request_ = false;
 		}
 
+		/// @returns The timer's counters and request state, packed for state hashing.
+		std::array<uint8_t, 4> state_summary() const {
+			return {uint8_t(reset_counter_), uint8_t(interrupt_request_), uint8_t(last_interrupt_request_), uint8_t(timer_)};
+		}
+
 	private:
 		int reset_counter_ = 0;
 		bool interrupt_request_ = false;
@@ -240,58 +250,86 @@ class CRTCBusHandler {
 
 			// collect some more pixels if output is ongoing
 			if(previous_output_mode_ == OutputMode::Pixels) {
-				if(!pixel_data_) {
-					pixel_pointer_ = pixel_data_ = crt_.begin_data(320, 8);
-				}
-				if(pixel_pointer_) {
-					// the CPC shuffles output lines as:
-					//	MA13 MA12	RA2 RA1 RA0		MA9 MA8 MA7 MA6 MA5 MA4 MA3 MA2 MA1 MA0		CCLK
-					// ... so form the real access address.
-					const uint16_t address =
-						uint16_t(
-							((state.refresh_address & 0x3ff) << 1) |
-							((state.row_address & 0x7) << 11) |
-							((state.refresh_address & 0x3000) << 2)
-						);
-
-					// Fetch two bytes and translate into pixels. Guaranteed: the mode can change only at
-					// hsync, so there's no risk of pixel_pointer_ overrunning 320 output pixels without
-					// exactly reaching 320 output pixels.
-					switch(mode_) {
-						case 0:
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode0_output_[ram_[address]];
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode0_output_[ram_[address+1]];
-							pixel_pointer_ += 2 * sizeof(uint16_t);
-						break;
+				fetch_pixels(state);
+			}
+		}
 
-						case 1:
-							reinterpret_cast<uint32_t *>(pixel_pointer_)[0] = mode1_output_[ram_[address]];
-							reinterpret_cast<uint32_t *>(pixel_pointer_)[1] = mode1_output_[ram_[address+1]];
-							pixel_pointer_ += 2 * sizeof(uint32_t);
-						break;
+		/*!
+			The CRTC entry function for runs of bus cycles in which only the refresh address changes;
+			this is equivalent to @c count calls to each of phase 1 and phase 2.
+		*/
+		forceinline void perform_bus_cycles(Motorola::CRTC::BusState state, int count) {
+			// Let the first cycle deal with any change in output mode or sync edges.
+			perform_bus_cycle_phase1(state);
+			perform_bus_cycle_phase2(state);
 
-						case 2:
-							reinterpret_cast<uint64_t *>(pixel_pointer_)[0] = mode2_output_[ram_[address]];
-							reinterpret_cast<uint64_t *>(pixel_pointer_)[1] = mode2_output_[ram_[address+1]];
-							pixel_pointer_ += 2 * sizeof(uint64_t);
-						break;
+			// Thereafter, all that can happen is more of the same.
+			if(previous_output_mode_ == OutputMode::Pixels) {
+				while(--count) {
+					state.refresh_address = (state.refresh_address + 1) & 0x3fff;
+					cycles_++;
+					fetch_pixels(state);
+				}
+			} else {
+				cycles_ += count - 1;
+			}
+		}
 
-						case 3:
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode3_output_[ram_[address]];
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode3_output_[ram_[address+1]];
-							pixel_pointer_ += 2 * sizeof(uint16_t);
-						break;
+		/*!
+			Fetches and serialises the two bytes indicated by @c state, posting the pixel buffer to the CRT if that fills it.
+		*/
+		forceinline void fetch_pixels(const Motorola::CRTC::BusState &state) {
+			if(!pixel_data_) {
+				pixel_pointer_ = pixel_data_ = crt_.begin_data(320, 8);
+			}
+			if(pixel_pointer_) {
+				// the CPC shuffles output lines as:
+				//	MA13 MA12	RA2 RA1 RA0		MA9 MA8 MA7 MA6 MA5 MA4 MA3 MA2 MA1 MA0		CCLK
+				// ... so form the real access address.
+				const uint16_t address =
+					uint16_t(
+						((state.refresh_address & 0x3ff) << 1) |
+						((state.row_address & 0x7) << 11) |
+						((state.refresh_address & 0x3000) << 2)
+					);
+
+				// Fetch two bytes and translate into pixels. Guaranteed: the mode can change only at
+				// hsync, so there's no risk of pixel_pointer_ overrunning 320 output pixels without
+				// exactly reaching 320 output pixels.
+				switch(mode_) {
+					case 0:
+						reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode0_output_[ram_[address]];
+						reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode0_output_[ram_[address+1]];
+						pixel_pointer_ += 2 * sizeof(uint16_t);
+					break;
+
+					case 1:
+						reinterpret_cast<uint32_t *>(pixel_pointer_)[0] = mode1_output_[ram_[address]];
+						reinterpret_cast<uint32_t *>(pixel_pointer_)[1] = mode1_output_[ram_[address+1]];
+						pixel_pointer_ += 2 * sizeof(uint32_t);
+					break;
+
+					case 2:
+						reinterpret_cast<uint64_t *>(pixel_pointer_)[0] = mode2_output_[ram_[address]];
+						reinterpret_cast<uint64_t *>(pixel_pointer_)[1] = mode2_output_[ram_[address+1]];
+						pixel_pointer_ += 2 * sizeof(uint64_t);
+					break;
+
+					case 3:
+						reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode3_output_[ram_[address]];
+						reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode3_output_[ram_[address+1]];
+						pixel_pointer_ += 2 * sizeof(uint16_t);
+					break;
 
-					}
+				}
 
-					// Flush the current buffer pixel if full; the CRTC allows many different display
-					// widths so it's not necessarily possible to predict the correct number in advance
-					// and using the upper bound could lead to inefficient behaviour.
-					if(pixel_pointer_ == pixel_data_ + 320) {
-						crt_.output_data(cycles_ * 16, size_t(cycles_ * 16 / pixel_divider_));
-						pixel_pointer_ = pixel_data_ = nullptr;
-						cycles_ = 0;
-					}
+				// Flush the current buffer pixel if full; the CRTC allows many different display
+				// widths so it's not necessarily possible to predict the correct number in advance
+				// and using the upper bound could lead to inefficient behaviour.
+				if(pixel_pointer_ == pixel_data_ + 320) {
+					crt_.output_data(cycles_ * 16, size_t(cycles_ * 16 / pixel_divider_));
+					pixel_pointer_ = pixel_data_ = nullptr;
+					cycles_ = 0;
 				}
 			}
 		}
@@ -382,6 +420,21 @@ class CRTCBusHandler {
 			}
 		}
 
+		/// @returns The current and next modes, the palette and the sync state as seen by the gate array, packed for state hashing.
+		std::vector<uint8_t> state_summary() const {
+			std::vector<uint8_t> summary(std::begin(palette_), std::end(palette_));
+			summary.insert(summary.end(), {
+				border_,
+				uint8_t(pen_),
+				uint8_t(mode_),
+				uint8_t(next_mode_),
+				uint8_t(was_hsync_),
+				uint8_t(was_vsync_),
+				uint8_t(cycles_into_hsync_),
+			});
+			return summary;
+		}
+
 	private:
 		void output_border(int length) {
 			assert(length >= 0);
@@ -580,7 +633,7 @@ class CRTCBusHandler {
 		std::array<std::vector<uint8_t>, 4> mode3_palette_hits_;
 
 		int pen_ = 0;
-		uint8_t palette_[16];
+		uint8_t palette_[16]{};
 		uint8_t border_ = 0;
 
 		InterruptTimer &interrupt_timer_;
@@ -755,8 +808,10 @@ template <bool has_fdc> class ConcreteMachine:
 	public MachineTypes::AudioProducer,
 	public MachineTypes::TimedMachine,
 	public MachineTypes::MediaTarget,
+	public MachineTypes::MemoryAccountant,
 	public MachineTypes::MappedKeyboardMachine,
 	public MachineTypes::JoystickMachine,
+	public MachineTypes::StateHashProducer,
 	public Utility::TypeRecipient<CharacterMapper>,
 	public CPU::Z80::BusHandler,
 	public ClockingHint::Observer,
@@ -768,7 +823,7 @@ template <bool has_fdc> class ConcreteMachine:
 			z80_(*this),
 			crtc_bus_handler_(ram_, interrupt_timer_),
 			crtc_(Motorola::CRTC::HD6845S, crtc_bus_handler_),
-			i8255_port_handler_(key_state_, crtc_, ay_, tape_player_),
+			i8255_port_handler_(key_state_, *crtc_.last_valid(), ay_, tape_player_),
 			i8255_(i8255_port_handler_),
 			tape_player_(8000000),
 			crtc_counter_(HalfCycles(4))	// This starts the CRTC exactly out of phase with the CPU's memory accesses
@@ -821,6 +876,7 @@ template <bool has_fdc> class ConcreteMachine:
 
 			if(has_amsdos) {
 				roms_[ROMType::AMSDOS] = roms.find(ROM::Name::AMSDOS)->second;
+				amsdos_read_sector_address_ = find_read_sector_entry(roms_[ROMType::AMSDOS]);
 			}
 			roms_[ROMType::OS] = roms.find(firmware)->second;
 			roms_[ROMType::BASIC] = roms.find(basic)->second;
@@ -833,6 +889,7 @@ template <bool has_fdc> class ConcreteMachine:
 			write_pointers_[1] = &ram_[0x4000];
 			write_pointers_[2] = &ram_[0x8000];
 			write_pointers_[3] = &ram_[0xc000];
+			update_dirty_pointers();
 
 			read_pointers_[0] = roms_[ROMType::OS].data();
 			read_pointers_[1] = write_pointers_[1];
@@ -852,17 +909,25 @@ template <bool has_fdc> class ConcreteMachine:
 
 		/// The entry point for performing a partial Z80 machine cycle.
 		forceinline HalfCycles perform_machine_cycle(const CPU::Z80::PartialMachineCycle &cycle) {
-			// Amstrad CPC timing scheme: assert WAIT for three out of four cycles
-			clock_offset_ = (clock_offset_ + cycle.length) & HalfCycles(7);
-			z80_.set_wait_line(clock_offset_ >= HalfCycles(2));
+			// If the processor is running faster than original, map its time back to that of the rest of the machine.
+			const HalfCycles length = processor_clock_.machine_time(cycle.length);
+
+			// Amstrad CPC timing scheme: assert WAIT for three out of four cycles. An accelerated
+			// processor is assumed to have uncontended access to memory, so is never held.
+			clock_offset_ = (clock_offset_ + length) & HalfCycles(7);
+			z80_.set_wait_line(processor_clock_.multiplier() == 1 && clock_offset_ >= HalfCycles(2));
 
-			// Update the CRTC once every eight half cycles; aiming for half-cycle 4 as
+			// Clock the CRTC once every eight half cycles; aiming for half-cycle 4 as
 			// per the initial seed to the crtc_counter_, but any time in the final four
 			// will do as it's safe to conclude that nobody else has touched video RAM
-			// during that whole window
-			crtc_counter_ += cycle.length;
+			// during that whole window.
+			//
+			// The CRTC is otherwise run only on demand — upon any memory write or IO access, or
+			// whenever its horizontal sync might clock the interrupt timer — so that it can
+			// usually proceed in runs of several characters.
+			crtc_counter_ += length;
 			const Cycles crtc_cycles = crtc_counter_.divide_cycles(Cycles(4));
-			if(crtc_cycles > Cycles(0)) crtc_.run_for(crtc_cycles);
+			if(crtc_cycles > Cycles(0)) crtc_ += crtc_cycles;
 
 			// Check whether that prompted a change in the interrupt line. If so then date
 			// it to whenever the cycle was triggered.
@@ -870,18 +935,18 @@ template <bool has_fdc> class ConcreteMachine:
 
 			// TODO (in the player, not here): adapt it to accept an input clock rate and
 			// run_for as HalfCycles
-			if(!tape_player_is_sleeping_) tape_player_.run_for(cycle.length.as_integral());
+			if(!tape_player_is_sleeping_) tape_player_.run_for(length.as_integral());
 
 			// Pump the AY
-			ay_.run_for(cycle.length);
+			ay_.run_for(length);
 
 			if constexpr (has_fdc) {
 				// Clock the FDC, if connected, using a lazy scale by two
-				time_since_fdc_update_ += cycle.length;
+				time_since_fdc_update_ += length;
 			}
 
 			// Update typing activity
-			if(typer_) typer_->run_for(cycle.length);
+			if(typer_) typer_->run_for(length);
 
 			// Stop now if no action is strictly required.
 			if(!cycle.is_terminal()) return HalfCycles(0);
@@ -923,8 +988,9 @@ template <bool has_fdc> class ConcreteMachine:
 							tape_crc_.add(*byte);
 							crc_value = tape_crc_.get_value();
 
-							write_pointers_[tape_crc_address >> 14][tape_crc_address & 16383] = uint8_t(crc_value);
-							write_pointers_[(tape_crc_address+1) >> 14][(tape_crc_address+1) & 16383] = uint8_t(crc_value >> 8);
+							crtc_.flush();
+							write_ram(tape_crc_address, uint8_t(crc_value));
+							write_ram(uint16_t(tape_crc_address + 1), uint8_t(crc_value >> 8));
 
 							// Indicate successful byte read.
 							z80_.set_value_of(CPU::Z80::Register::A, *byte);
@@ -940,6 +1006,16 @@ template <bool has_fdc> class ConcreteMachine:
 						*cycle.value = 0xc9;
 						break;
 					}
+
+					if(
+						use_fast_disk_ && amsdos_read_sector_address_ && address == amsdos_read_sector_address_ &&
+						upper_rom_is_paged_ && upper_rom_ == ROMType::AMSDOS &&
+						perform_fast_disk_read()
+					) {
+						// RET.
+						*cycle.value = 0xc9;
+						break;
+					}
 				[[fallthrough]];
 
 				case CPU::Z80::PartialMachineCycle::Read:
@@ -947,10 +1023,14 @@ template <bool has_fdc> class ConcreteMachine:
 				break;
 
 				case CPU::Z80::PartialMachineCycle::Write:
-					write_pointers_[address >> 14][address & 16383] = *cycle.value;
+					crtc_.flush();
+					write_ram(address, *cycle.value);
 				break;
 
 				case CPU::Z80::PartialMachineCycle::Output:
+					// Any output might affect video, so catch up.
+					crtc_.flush();
+
 					// Check for a gate array access.
 					if((address & 0xc000) == 0x4000) {
 						write_to_gate_array(*cycle.value);
@@ -967,8 +1047,8 @@ template <bool has_fdc> class ConcreteMachine:
 					// Check for a CRTC access
 					if(!(address & 0x4000)) {
 						switch((address >> 8) & 3) {
-							case 0:	crtc_.select_register(*cycle.value);	break;
-							case 1:	crtc_.set_register(*cycle.value);		break;
+							case 0:	crtc_->select_register(*cycle.value);	break;
+							case 1:	crtc_->set_register(*cycle.value);		break;
 							default: break;
 						}
 					}
@@ -982,7 +1062,15 @@ template <bool has_fdc> class ConcreteMachine:
 						// Check for an FDC access
 						if((address & 0x580) == 0x100) {
 							flush_fdc();
+							const bool was_executing = fdc_.read(0) & 0x20;
 							fdc_.write(address & 1, *cycle.value);
+
+							// AMSDOS's file routines drive the 8272 directly, so also cut out the wait
+							// for any seek or sector search begun by this write. Bytes written during
+							// the execution phase of a command are just data, and are left alone.
+							if(use_fast_disk_ && (address & 1) && !was_executing) {
+								fdc_.skip_mechanical_delays();
+							}
 						}
 
 						// Check for a disk motor access
@@ -994,6 +1082,9 @@ template <bool has_fdc> class ConcreteMachine:
 				break;
 
 				case CPU::Z80::PartialMachineCycle::Input:
+					// Inputs might observe or affect video, so catch up.
+					crtc_.flush();
+
 					// Default to nothing answering
 					*cycle.value = 0xff;
 
@@ -1014,10 +1105,10 @@ template <bool has_fdc> class ConcreteMachine:
 					// for writing via an input, and will sample whatever happens to be available
 					if(!(address & 0x4000)) {
 						switch((address >> 8) & 3) {
-							case 0:	crtc_.select_register(*cycle.value);	break;
-							case 1:	crtc_.set_register(*cycle.value);		break;
-							case 2: *cycle.value &= crtc_.get_status();		break;
-							case 3:	*cycle.value &= crtc_.get_register();	break;
+							case 0:	crtc_->select_register(*cycle.value);	break;
+							case 1:	crtc_->set_register(*cycle.value);		break;
+							case 2: *cycle.value &= crtc_->get_status();	break;
+							case 3:	*cycle.value &= crtc_->get_register();	break;
 						}
 					}
 
@@ -1085,9 +1176,41 @@ template <bool has_fdc> class ConcreteMachine:
 			return ay_.get_speaker();
 		}
 
+		// MARK: - MemoryAccountant.
+		void account_memory(Utility::MemoryAccount &account) final {
+			if constexpr (has_fdc) {
+				account.add("Disk drives", fdc_.get_memory_usage());
+			}
+		}
+
+		void set_memory_budget(size_t bytes) final {
+			fdc_.set_memory_budget(bytes);
+		}
+
+		// MARK: - StateHashProducer.
+		void hash_state(Utility::StateHasher &hasher) final {
+			crtc_.flush();
+
+			hasher.add("Z80", CPU::Z80::State(z80_));
+			hasher.add("AY", GI::AY38910::State(ay_.ay()));
+
+			const auto crtc = crtc_.last_valid()->state_summary();
+			hasher.add("CRTC", crtc.data(), crtc.size());
+
+			auto gate_array = crtc_bus_handler_.state_summary();
+			const auto timer = interrupt_timer_.state_summary();
+			gate_array.insert(gate_array.end(), timer.begin(), timer.end());
+			hasher.add("Gate array", gate_array.data(), gate_array.size());
+
+			const uint8_t paging[] = {uint8_t(upper_rom_is_paged_), uint8_t(upper_rom_)};
+			hasher.add("Paging", paging, sizeof(paging));
+			hasher.add("RAM", ram_hasher_);
+		}
+
 		/// Wires virtual-dispatched CRTMachine run_for requests to the static Z80 method.
 		void run_for(const Cycles cycles) final {
-			z80_.run_for(cycles);
+			z80_.run_for(processor_clock_.processor_time(cycles));
+			crtc_.flush();
 		}
 
 		bool insert_media(const Analyser::Static::Media &media) final {
@@ -1155,6 +1278,7 @@ template <bool has_fdc> class ConcreteMachine:
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->output = get_video_signal_configurable();
 			options->quickload = allow_fast_tape_hack_;
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
@@ -1162,7 +1286,10 @@ template <bool has_fdc> class ConcreteMachine:
 			const auto options = dynamic_cast<Options *>(str.get());
 			set_video_signal_configurable(options->output);
 			allow_fast_tape_hack_ = options->quickload;
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
 			set_use_fast_tape_hack();
+			use_fast_disk_ = has_fdc && allow_fast_tape_hack_;
 		}
 
 		// MARK: - Joysticks
@@ -1207,6 +1334,7 @@ template <bool has_fdc> class ConcreteMachine:
 						}
 #undef RAM_CONFIG
 #undef RAM_BANK
+						update_dirty_pointers();
 						if(adjust_low_read_pointer) read_pointers_[0] = write_pointers_[0];
 						read_pointers_[1] = write_pointers_[1];
 						read_pointers_[2] = write_pointers_[2];
@@ -1219,7 +1347,7 @@ template <bool has_fdc> class ConcreteMachine:
 		CPU::Z80::Processor<ConcreteMachine, false, true> z80_;
 
 		CRTCBusHandler crtc_bus_handler_;
-		Motorola::CRTC::CRTC6845<CRTCBusHandler> crtc_;
+		JustInTimeActor<Motorola::CRTC::CRTC6845<CRTCBusHandler>, Cycles> crtc_;
 
 		AYDeferrer ay_;
 		i8255PortHandler i8255_port_handler_;
@@ -1248,10 +1376,70 @@ template <bool has_fdc> class ConcreteMachine:
 		CRC::CCITT tape_crc_;
 		bool use_fast_tape_hack_ = false;
 		bool allow_fast_tape_hack_ = false;
+
+		ProcessorClockMultiplier<HalfCycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
 		void set_use_fast_tape_hack() {
 			use_fast_tape_hack_ = allow_fast_tape_hack_ && tape_player_.has_tape();
 		}
 
+		bool use_fast_disk_ = false;
+		uint16_t amsdos_read_sector_address_ = 0;
+
+		/*!
+			Locates AMSDOS's jumpblock entry for its BIOS READ SECTOR command, ^H84. As with any expansion
+			ROM, a pointer to the table of command names is at 0xc004 and the jumpblock begins at 0xc006,
+			the nth name corresponding to the nth entry.
+
+			@returns The address of the entry, or 0 if none was found.
+		*/
+		static uint16_t find_read_sector_entry(const std::vector<uint8_t> &rom) {
+			if(rom.size() < 16384) return 0;
+
+			uint16_t name = uint16_t(rom[4] | (rom[5] << 8));
+			for(uint16_t entry = 0xc006; entry < 0xc100 && name >= 0xc000; entry += 3) {
+				// The table ends with a zero; each name ends with a byte that has bit 7 set.
+				const uint8_t first = rom[name & 16383];
+				if(!first) break;
+				if(first == 0x84) {
+					// Expect a JP.
+					return rom[entry & 16383] == 0xc3 ? entry : 0;
+				}
+
+				while(name >= 0xc000 && !(rom[name & 16383] & 0x80)) ++name;
+				++name;
+			}
+			return 0;
+		}
+
+		/*!
+			Attempts to satisfy a call to BIOS READ SECTOR directly from the disk image: HL is the destination,
+			E the drive, D the track and C the sector ID. On success A is zero and carry is set.
+
+			@returns @c true if the call has been fully performed and the caller should return; @c false if
+				it should be left to AMSDOS, e.g. to report an error.
+		*/
+		bool perform_fast_disk_read() {
+			using Register = CPU::Z80::Register;
+			const uint16_t drive_track = z80_.value_of(Register::DE);
+			if(drive_track & 0xff) return false;		// Only drive A is connected.
+
+			uint8_t sector[512];
+			if(!fdc_.read_sector(drive_track >> 8, uint8_t(z80_.value_of(Register::C)), sector)) {
+				return false;
+			}
+
+			crtc_.flush();
+			const uint16_t destination = z80_.value_of(Register::HL);
+			for(int c = 0; c < 512; c++) {
+				write_ram(uint16_t(destination + c), sector[c]);
+			}
+
+			z80_.set_value_of(Register::A, 0);
+			z80_.set_value_of(Register::Flags, z80_.value_of(Register::Flags) | CPU::Z80::Flag::Carry);
+			return true;
+		}
+
 		HalfCycles clock_offset_;
 		HalfCycles crtc_counter_;
 		HalfCycles half_cycles_since_ay_update_;
@@ -1276,6 +1464,24 @@ template <bool has_fdc> class ConcreteMachine:
 
 		bool has_run_ = false;
 		uint8_t ram_[128 * 1024];
+
+		static constexpr int PagesPerBank = 16384 >> Utility::PagedMemoryHasher::PageShift;
+		Utility::PagedMemoryHasher ram_hasher_{ram_, sizeof(ram_)};
+		uint8_t *dirty_pointers_[4]{};
+
+		/// Points each of @c dirty_pointers_ at the hasher's flags for whichever RAM bank is currently paged for writing.
+		void update_dirty_pointers() {
+			for(int bank = 0; bank < 4; bank++) {
+				dirty_pointers_[bank] =
+					&ram_hasher_.dirty_flags()[(write_pointers_[bank] - ram_) >> Utility::PagedMemoryHasher::PageShift] - bank*PagesPerBank;
+			}
+		}
+
+		/// Writes @c value to @c address via the current write pointers, noting the page it falls within as dirty.
+		forceinline void write_ram(uint16_t address, uint8_t value) {
+			write_pointers_[address >> 14][address & 16383] = value;
+			dirty_pointers_[address >> 14][address >> Utility::PagedMemoryHasher::PageShift] = 1;
+		}
 };
 
 }
@@ -32,18 +32,22 @@ class Machine {
 		class Options:
 			public Reflection::StructImpl<Options>,
 			public Configurable::DisplayOption<Options>,
-			public Configurable::QuickloadOption<Options>
+			public Configurable::QuickloadOption<Options>,
+			public Configurable::ProcessorSpeedOption<Options>
 		{
 			friend Configurable::DisplayOption<Options>;
 			friend Configurable::QuickloadOption<Options>;
+			friend Configurable::ProcessorSpeedOption<Options>;
 			public:
 				Options(Configurable::OptionsType type) :
 					Configurable::DisplayOption<Options>(Configurable::Display::RGB),
-					Configurable::QuickloadOption<Options>(type == Configurable::OptionsType::UserFriendly)
+					Configurable::QuickloadOption<Options>(type == Configurable::OptionsType::UserFriendly),
+					Configurable::ProcessorSpeedOption<Options>(Configurable::ProcessorSpeed::Original)
 				{
 					if(needs_declare()) {
 						declare_display_option();
 						declare_quickload_option();
+						declare_processor_speed_option();
 						limit_enum(&output, Configurable::Display::RGB, Configurable::Display::CompositeColour, -1);
 					}
 				}
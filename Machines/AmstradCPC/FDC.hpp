@@ -10,6 +10,7 @@
 #define FDC_h
 
 #include "../../Components/8272/i8272.hpp"
+#include "../../Storage/Disk/Controller/SectorReader.hpp"
 
 namespace Amstrad {
 
@@ -44,6 +45,30 @@ class FDC: public Intel::i8272::i8272 {
 		void set_activity_observer(Activity::Observer *observer) {
 			get_drive().set_activity_observer(observer, "Drive 1", true);
 		}
+
+		/// Runs the 8272 until it next awaits the processor with no seek outstanding, so that
+		/// a seek or search for a sector that has just been commanded completes immediately
+		/// from the processor's point of view. Gives up after two seconds of 8272 time, e.g.
+		/// if the motor is off.
+		void skip_mechanical_delays() {
+			// Step in 2µs increments, well within the 32µs that the processor has to collect
+			// each byte once it is available.
+			constexpr int Step = 16;
+			constexpr int Limit = 16'000'000;
+			for(int c = 0; c < Limit; c += Step) {
+				if((read(0) & 0x80) && !is_seeking()) return;
+				run_for(Cycles(Step));
+			}
+		}
+
+		/// Reads the 512-byte sector with ID @c sector from physical @c track of the first side of the
+		/// disk into @c target, without involving the 8272.
+		///
+		/// @returns @c true if the sector was found and read without error; @c false otherwise.
+		bool read_sector(int track, uint8_t sector, uint8_t *target) {
+			Storage::Disk::SectorReader reader(get_drive());
+			return reader.read(0, track, sector, target, 512) == Storage::Disk::SectorReader::Result::Success;
+		}
 };
 
 }
@@ -10,11 +10,21 @@
 
 using namespace Apple::ADB;
 
-Bus::Bus(HalfCycles clock_speed) : half_cycles_to_microseconds_(1'000'000.0 / clock_speed.as<double>()) {}
+Bus::Bus(HalfCycles clock_speed) : clock_speed_(clock_speed), half_cycles_to_microseconds_(1'000'000.0 / clock_speed.as<double>()) {}
 
 void Bus::run_for(HalfCycles duration) {
 	time_in_state_ += duration;
 	time_since_get_state_ += duration;
+	relay_time_ += duration;
+
+	// A listen's data packet is complete once the line has been idle for longer than any gap within it.
+	if(relay_has_listen_ && !relay_listen_data_.empty() && data_level_ && time_in_state_ > microseconds(200)) {
+		complete_listen();
+	}
+}
+
+HalfCycles Bus::microseconds(int count) const {
+	return HalfCycles(clock_speed_.as_integral() * count / 1'000'000);
 }
 
 void Bus::set_device_output(size_t device_id, bool output) {
@@ -42,13 +52,9 @@ void Bus::set_device_output(size_t device_id, bool output) {
 			//	50–72 µs		0
 			//	300 µs			service request
 			if(low_microseconds > 1040.0) {
-				for(auto device: devices_) {
-					device->adb_bus_did_observe_event(Event::Reset);
-				}
+				post_event(Event::Reset);
 			} else if(low_microseconds >= 560.0) {
-				for(auto device: devices_) {
-					device->adb_bus_did_observe_event(Event::Attention);
-				}
+				post_event(Event::Attention);
 				shift_register_ = 1;
 				start_target_ = 9;		// Consume the stop bit before posting the next byte.
 				phase_ = Phase::AttentionCapture;
@@ -57,13 +63,9 @@ void Bus::set_device_output(size_t device_id, bool output) {
 			} else if(low_microseconds < 72.0) {
 				shift(0);
 			} else if(low_microseconds >= 291.0 && low_microseconds <= 309.0) {
-				for(auto device: devices_) {
-					device->adb_bus_did_observe_event(Event::ServiceRequest);
-				}
+				post_event(Event::ServiceRequest);
 			} else {
-				for(auto device: devices_) {
-					device->adb_bus_did_observe_event(Event::Unrecognised);
-				}
+				post_event(Event::Unrecognised);
 			}
 		}
 
@@ -78,9 +80,7 @@ void Bus::shift(unsigned int value) {
 	//	* a 'start bit' hits bit 8; or
 	//	* if this was a command byte, wait for the stop bit (i.e. the start bit hits 9).
 	if(shift_register_ & (1 << start_target_)) {
-		for(auto device: devices_) {
-			device->adb_bus_did_observe_event(Event::Byte, uint8_t(shift_register_ >> (start_target_ - 8)));
-		}
+		post_event(Event::Byte, uint8_t(shift_register_ >> (start_target_ - 8)));
 
 		// Expect a real start bit only if moving from attention capture to packet
 		// capture. Otherwise adopt an implied start bit.
@@ -90,7 +90,25 @@ void Bus::shift(unsigned int value) {
 	}
 }
 
+void Bus::post_event(Event event, uint8_t value) {
+	if(relays_transactions_) {
+		relay(event, value);
+		return;
+	}
+
+	for(auto device: devices_) {
+		device->adb_bus_did_observe_event(event, value);
+	}
+}
+
 bool Bus::get_state() const {
+	if(relays_transactions_) {
+		while(relay_edge_ < relay_edges_.size() && relay_edges_[relay_edge_] <= relay_time_) {
+			++relay_edge_;
+		}
+		return bus_state_.all() && !(relay_edge_ & 1);
+	}
+
 	const auto microseconds = time_since_get_state_.as<double>() * half_cycles_to_microseconds_;
 	time_since_get_state_ = HalfCycles(0);
 
@@ -111,3 +129,130 @@ size_t Bus::add_device(Device *device) {
 	devices_.push_back(device);
 	return add_device();
 }
+
+std::vector<uint8_t> Bus::perform_transaction(uint8_t command, const std::vector<uint8_t> &listen_data) {
+	const Command decoded = decode_command(command);
+	std::vector<uint8_t> response;
+	for(auto device: devices_) {
+		std::vector<uint8_t> device_response;
+		device->adb_bus_did_perform_transaction(decoded, listen_data, device_response);
+
+		// Only one device should respond to a talk; if multiple do then the first
+		// is preferred, much as a collision would cause all but one to back off.
+		if(response.empty()) {
+			response = std::move(device_response);
+		}
+	}
+	return response;
+}
+
+bool Bus::has_service_request(uint8_t command) const {
+	const Command decoded = decode_command(command);
+	for(auto device: devices_) {
+		if(device->adb_bus_has_service_request(decoded)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool Bus::has_pending_service_request() const {
+	// Addresses are four bits, so a command to device 16 addresses nobody.
+	const Command unaddressed(Command::Type::Reserved, 16);
+	for(auto device: devices_) {
+		if(device->adb_bus_has_service_request(unaddressed)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool Bus::is_active() const {
+	return
+		!bus_state_.all() ||
+		(relay_has_listen_ && !relay_listen_data_.empty()) ||
+		(!relay_edges_.empty() && relay_time_ < relay_edges_.back());
+}
+
+// MARK: - Transaction relaying.
+
+void Bus::set_relays_transactions(bool relay) {
+	relays_transactions_ = relay;
+	relay_awaiting_command_ = relay_has_listen_ = false;
+	relay_edges_.clear();
+	relay_edge_ = 0;
+}
+
+void Bus::relay(Event event, uint8_t value) {
+	switch(event) {
+		default: break;
+
+		case Event::Reset:
+			relay_has_listen_ = relay_awaiting_command_ = false;
+		break;
+
+		case Event::Attention:
+			complete_listen();
+			relay_awaiting_command_ = true;
+		break;
+
+		case Event::Byte:
+			if(relay_awaiting_command_) {
+				relay_awaiting_command_ = false;
+
+				// Devices signal service requests during the command's stop bit, so before any
+				// listen data is sent or the command is performed.
+				const bool service_request = has_service_request(value);
+				if(decode_command(value).type == Command::Type::Listen) {
+					relay_has_listen_ = true;
+					relay_listen_command_ = value;
+					relay_listen_data_.clear();
+					signal(service_request, {});
+				} else {
+					signal(service_request, perform_transaction(value));
+				}
+			} else if(relay_has_listen_) {
+				relay_listen_data_.push_back(value);
+			}
+		break;
+	}
+}
+
+void Bus::complete_listen() {
+	if(!relay_has_listen_) return;
+	relay_has_listen_ = false;
+	perform_transaction(relay_listen_command_, relay_listen_data_);
+}
+
+void Bus::signal(bool service_request, const std::vector<uint8_t> &response) {
+	relay_edges_.clear();
+	relay_edge_ = 0;
+	relay_time_ = HalfCycles(0);
+
+	// Timings are as per ReactiveDevice: a service request holds the line low for 240µs, then
+	// a response begins 150µs after the line is released, with a bit cell of 100µs that is
+	// low for 33µs to signal a 1 or 66µs to signal a 0.
+	int time = 0;
+	const auto low = [&](int duration) {
+		relay_edges_.push_back(microseconds(time));
+		relay_edges_.push_back(microseconds(time + duration));
+	};
+	if(service_request) {
+		low(240);
+		time += 240;
+	}
+	if(response.empty()) return;
+
+	time += 150;
+	const auto bit = [&](int value) {
+		low(value ? 33 : 66);
+		time += 100;
+	};
+	bit(1);
+	for(const auto byte: response) {
+		for(int c = 7; c >= 0; c--) {
+			bit((byte >> c) & 1);
+		}
+	}
+	bit(0);
+}
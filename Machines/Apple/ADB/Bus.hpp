@@ -92,6 +92,13 @@ inline Command decode_command(uint8_t code) {
 		* reactive devices, which use @c add_device(Device*) and then merely react to
 		@c adb_bus_did_observe_event and @c advance_state in order to
 		update @c set_device_output.
+
+	Separately, a host that implements the ADB protocol at a higher level than signal
+	timing can use @c perform_transaction and @c has_service_request to communicate with
+	reactive devices one whole command at a time, without any bit-level activity.
+
+	A bit-level host can also have its commands relayed to reactive devices in that form;
+	see @c set_relays_transactions.
 */
 class Bus {
 	public:
@@ -137,16 +144,70 @@ class Bus {
 			/// to reevaluate its current level. It cannot reliably be used to track the timing between
 			/// observed events.
 			virtual void advance_state(double microseconds, bool current_level) = 0;
+
+			/// Performs @c command as a complete transaction, bypassing bit-level signalling. If this is
+			/// a listen then @c listen_data provides the bytes sent by the host. If this is a talk then
+			/// any bytes posted in response should be stored to @c talk_response.
+			///
+			/// @returns @c true if this device was addressed by the command; @c false otherwise.
+			virtual bool adb_bus_did_perform_transaction(const Command &, const std::vector<uint8_t> &listen_data, std::vector<uint8_t> &talk_response) {
+				(void)listen_data;
+				(void)talk_response;
+				return false;
+			}
+
+			/// @returns @c true if this device would signal a service request during @c command, i.e. if
+			/// it is currently seeking service and is not addressed by @c command; @c false otherwise.
+			virtual bool adb_bus_has_service_request(const Command &) const {
+				return false;
+			}
 		};
 		/*!
 			Adds a device.
 		*/
 		size_t add_device(Device *);
 
+		/*!
+			Performs a complete transaction at the protocol level: @c command is decoded and
+			delivered to all devices, with @c listen_data as the data bytes if it is a listen.
+
+			@returns Any bytes that were posted in response to a talk; if no device responded
+				then the result is empty.
+		*/
+		std::vector<uint8_t> perform_transaction(uint8_t command, const std::vector<uint8_t> &listen_data = {});
+
+		/*!
+			@returns @c true if any device would signal a service request during @c command; @c false otherwise.
+		*/
+		bool has_service_request(uint8_t command) const;
+
+		/*!
+			If @c relay is @c true then reactive devices no longer observe bit-level activity. Instead the
+			bus decodes each command sent by the host, delivers it via @c perform_transaction and then itself
+			signals any service request and any response.
+
+			The host sees the same signals as it otherwise would, but sampling the bus no longer involves any
+			per-device work.
+		*/
+		void set_relays_transactions(bool relay);
+
+		/*!
+			@returns @c true if the data line is currently held low, or if relayed listen data or a relayed
+				response is yet to complete; @c false otherwise.
+		*/
+		bool is_active() const;
+
+		/*!
+			@returns @c true if any device would signal a service request during a command that didn't
+				address it; @c false otherwise.
+		*/
+		bool has_pending_service_request() const;
+
 	private:
 		HalfCycles time_in_state_;
 		mutable HalfCycles time_since_get_state_;
 
+		const HalfCycles clock_speed_;
 		double half_cycles_to_microseconds_ = 1.0;
 		std::vector<Device *> devices_;
 		unsigned int shift_register_ = 0;
@@ -163,6 +224,25 @@ class Bus {
 			PacketCapture,
 			AttentionCapture
 		} phase_ = Phase::AttentionCapture;
+
+		void post_event(Event, uint8_t value = 0xff);
+
+		// Transaction relaying: a listen is performed only once its data has been received; any
+		// service request and response are signalled as a list of alternating falling and rising edges.
+		bool relays_transactions_ = false;
+		bool relay_awaiting_command_ = false;
+		bool relay_has_listen_ = false;
+		uint8_t relay_listen_command_ = 0;
+		std::vector<uint8_t> relay_listen_data_;
+
+		std::vector<HalfCycles> relay_edges_;
+		mutable size_t relay_edge_ = 0;
+		HalfCycles relay_time_;
+
+		void relay(Event, uint8_t);
+		void complete_listen();
+		void signal(bool service_request, const std::vector<uint8_t> &response);
+		HalfCycles microseconds(int) const;
 };
 
 }
@@ -26,7 +26,7 @@ class Mouse: public ReactiveDevice, public Inputs::Mouse {
 		void set_button_pressed(int index, bool is_pressed) override;
 		void reset_all_buttons() override;
 
-		std::atomic<int16_t> delta_x_, delta_y_;
+		std::atomic<int16_t> delta_x_ = 0, delta_y_ = 0;
 		std::atomic<int> button_flags_ = 0;
 		uint16_t last_posted_reg0_ = 0;
 };
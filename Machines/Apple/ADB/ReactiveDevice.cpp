@@ -21,6 +21,11 @@ ReactiveDevice::ReactiveDevice(Apple::ADB::Bus &bus, uint8_t adb_device_id) :
 }
 
 void ReactiveDevice::post_response(const std::vector<uint8_t> &&response) {
+	if(transaction_response_) {
+		*transaction_response_ = std::move(response);
+		return;
+	}
+
 	response_ = std::move(response);
 	microseconds_at_bit_ = 0.0;
 	bit_offset_ = -2;
@@ -111,13 +116,7 @@ void ReactiveDevice::adb_bus_did_observe_event(Bus::Event event, uint8_t value)
 		content_.push_back(value);
 		if(content_.size() == expected_content_size_) {
 			phase_ = Phase::AwaitingAttention;
-
-			if(command_.reg == 3) {
-				register3_ = uint16_t((content_[0] << 8) | content_[1]);
-			} else {
-				did_receive_data(command_, content_);
-			}
-			content_.clear();
+			did_receive_content();
 		}
 	}
 
@@ -129,7 +128,7 @@ void ReactiveDevice::adb_bus_did_observe_event(Bus::Event event, uint8_t value)
 
 		// If this command doesn't apply here, but a service request is requested,
 		// post a service request.
-		if(command_.device != Command::AllDevices && command_.device != ((register3_ >> 8) & 0xf)) {
+		if(!is_addressed(command_)) {
 			if(service_desired_) {
 				service_desired_ = false;
 				stop_has_begin_ = false;
@@ -139,32 +138,82 @@ void ReactiveDevice::adb_bus_did_observe_event(Bus::Event event, uint8_t value)
 			return;
 		}
 
-		// Handle reset and register 3 here automatically; pass everything else along.
-		switch(command_.type) {
-			case Command::Type::Reset:
-				reset();
-			[[fallthrough]];
-			default:
-				perform_command(command_);
-			break;
-
-			case Command::Type::Listen:
-			case Command::Type::Talk:
-				if(command_.reg == 3) {
-					if(command_.type == Command::Type::Talk) {
-						post_response({uint8_t(register3_ >> 8), uint8_t(register3_ & 0xff)});
-					} else {
-						receive_bytes(2);
-					}
+		perform_addressed_command();
+	}
+}
+
+bool ReactiveDevice::adb_bus_did_perform_transaction(const Command &command, const std::vector<uint8_t> &listen_data, std::vector<uint8_t> &talk_response) {
+	// Service requests aren't signalled here; the host is expected
+	// to poll has_service_request instead.
+	if(!is_addressed(command)) {
+		return false;
+	}
+
+	// Abandon any bit-level activity that might have been in progress.
+	phase_ = Phase::AwaitingAttention;
+	response_.clear();
+
+	command_ = command;
+	transaction_response_ = &talk_response;
+	perform_addressed_command();
+	transaction_response_ = nullptr;
+
+	// If the command was a listen, supply the data immediately. Ignore an
+	// incomplete listen, as if the host had stopped transmitting partway.
+	if(phase_ == Phase::AwaitingContent) {
+		phase_ = Phase::AwaitingAttention;
+		if(listen_data.size() >= expected_content_size_) {
+			content_.assign(listen_data.begin(), listen_data.begin() + ptrdiff_t(expected_content_size_));
+			did_receive_content();
+		}
+	}
+
+	return true;
+}
+
+bool ReactiveDevice::adb_bus_has_service_request(const Command &command) const {
+	return service_desired_ && !is_addressed(command);
+}
+
+bool ReactiveDevice::is_addressed(const Command &command) const {
+	return command.device == Command::AllDevices || command.device == ((register3_ >> 8) & 0xf);
+}
+
+void ReactiveDevice::perform_addressed_command() {
+	// Handle reset and register 3 here automatically; pass everything else along.
+	switch(command_.type) {
+		case Command::Type::Reset:
+			reset();
+		[[fallthrough]];
+		default:
+			perform_command(command_);
+		break;
+
+		case Command::Type::Listen:
+		case Command::Type::Talk:
+			if(command_.reg == 3) {
+				if(command_.type == Command::Type::Talk) {
+					post_response({uint8_t(register3_ >> 8), uint8_t(register3_ & 0xff)});
 				} else {
-					service_desired_ = false;
-					perform_command(command_);
+					receive_bytes(2);
 				}
-			break;
-		}
+			} else {
+				service_desired_ = false;
+				perform_command(command_);
+			}
+		break;
 	}
 }
 
+void ReactiveDevice::did_receive_content() {
+	if(command_.reg == 3) {
+		register3_ = uint16_t((content_[0] << 8) | content_[1]);
+	} else {
+		did_receive_data(command_, content_);
+	}
+	content_.clear();
+}
+
 void ReactiveDevice::receive_bytes(size_t count) {
 	content_.clear();
 	expected_content_size_ = count;
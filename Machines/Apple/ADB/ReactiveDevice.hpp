@@ -31,6 +31,8 @@ class ReactiveDevice: public Bus::Device {
 	private:
 		void advance_state(double microseconds, bool current_level) override;
 		void adb_bus_did_observe_event(Bus::Event event, uint8_t value) override;
+		bool adb_bus_did_perform_transaction(const Command &, const std::vector<uint8_t> &, std::vector<uint8_t> &) override;
+		bool adb_bus_has_service_request(const Command &) const override;
 
 	private:
 		Bus &bus_;
@@ -56,7 +58,14 @@ class ReactiveDevice: public Bus::Device {
 
 		std::atomic<bool> service_desired_ = false;
 
+		// Non-null only while performing a transaction; captures anything
+		// posted by post_response in lieu of bit-level output.
+		std::vector<uint8_t> *transaction_response_ = nullptr;
+
 		void reset();
+		bool is_addressed(const Command &) const;
+		void perform_addressed_command();
+		void did_receive_content();
 };
 
 }
@@ -29,6 +29,7 @@
 
 #include "../../../Analyser/Static/AppleII/Target.hpp"
 #include "../../../ClockReceiver/ForceInline.hpp"
+#include "../../../ClockReceiver/ProcessorClockMultiplier.hpp"
 #include "../../../Configurable/StandardOptions.hpp"
 
 #include "../../../Storage/MassStorage/SCSI/SCSI.hpp"
@@ -419,6 +420,10 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 		// MARK: - Joysticks.
 		JoystickPair joysticks_;
 
+		// MARK: - Processor speed.
+		ProcessorClockMultiplier<Cycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
+
 	public:
 		ConcreteMachine(const Analyser::Static::AppleII::Target &target, const ROMMachine::ROMFetcher &rom_fetcher):
 			m6502_(*this),
@@ -549,9 +554,14 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 		}
 
 		forceinline Cycles perform_bus_operation(const CPU::MOS6502::BusOperation operation, const uint16_t address, uint8_t *const value) {
-			++ cycles_since_video_update_;
-			++ cycles_since_card_update_;
-			cycles_since_audio_update_ += Cycles(7);
+			// If the processor is running faster than original then only some of its
+			// cycles will coincide with a cycle of the rest of the machine.
+			const Cycles machine_cycles = processor_clock_.machine_time(Cycles(1));
+			const bool is_machine_cycle = machine_cycles > Cycles(0);
+
+			cycles_since_video_update_ += machine_cycles;
+			cycles_since_card_update_ += machine_cycles;
+			cycles_since_audio_update_ += machine_cycles * Cycles(7);
 
 			// The Apple II has a slightly weird timing pattern: every 65th CPU cycle is stretched
 			// by an extra 1/7th. That's because one cycle lasts 3.5 NTSC colour clocks, so after
@@ -559,8 +569,10 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 			// signal approximation that produces colour needs to be in phase, so a stretch of exactly
 			// 0.5 further colour cycles is added. The video class handles that implicitly, but it
 			// needs to be accumulated here for the audio.
-			cycles_into_current_line_ = (cycles_into_current_line_ + 1) % 65;
-			const bool is_stretched_cycle = !cycles_into_current_line_;
+			if(is_machine_cycle) {
+				cycles_into_current_line_ = (cycles_into_current_line_ + 1) % 65;
+			}
+			const bool is_stretched_cycle = is_machine_cycle && !cycles_into_current_line_;
 			if(is_stretched_cycle) {
 				++ cycles_since_audio_update_;
 				++ stretched_cycles_since_card_update_;
@@ -805,7 +817,7 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 					// Update all the every-cycle cards regardless, but send them a ::None select if they're
 					// not the one actually selected.
 					for(const auto &card: every_cycle_cards_) {
-						card->run_for(Cycles(1), is_stretched_cycle);
+						card->run_for(machine_cycles, is_stretched_cycle);
 						card->perform_bus_operation(
 							(card == target) ? select : Apple::II::Card::None,
 							is_read, address, value);
@@ -818,7 +830,7 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 				// Update all every-cycle cards and give them the cycle.
 				const bool is_read = isReadOperation(operation);
 				for(const auto &card: every_cycle_cards_) {
-					card->run_for(Cycles(1), is_stretched_cycle);
+					card->run_for(machine_cycles, is_stretched_cycle);
 					card->perform_bus_operation(Apple::II::Card::None, is_read, address, value);
 				}
 			}
@@ -849,7 +861,9 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 			}
 
 			// Update analogue charge level.
-			joysticks_.update_charge();
+			if(is_machine_cycle) {
+				joysticks_.update_charge();
+			}
 
 			return Cycles(1);
 		}
@@ -867,7 +881,7 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 		}
 
 		void run_for(const Cycles cycles) final {
-			m6502_.run_for(cycles);
+			m6502_.run_for(processor_clock_.processor_time(cycles));
 		}
 
 		bool prefers_logical_input() final {
@@ -892,6 +906,7 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->output = get_video_signal_configurable();
 			options->use_square_pixels = video_.get_use_square_pixels();
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
@@ -899,6 +914,8 @@ template <Analyser::Static::AppleII::Target::Model model> class ConcreteMachine:
 			const auto options = dynamic_cast<Options *>(str.get());
 			set_video_signal_configurable(options->output);
 			video_.set_use_square_pixels(options->use_square_pixels);
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
 		}
 
 		// MARK: MediaTarget
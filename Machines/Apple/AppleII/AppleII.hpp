@@ -26,15 +26,22 @@ class Machine {
 		static Machine *AppleII(const Analyser::Static::Target *target, const ROMMachine::ROMFetcher &rom_fetcher);
 
 		/// Defines the runtime options available for an Apple II.
-		class Options: public Reflection::StructImpl<Options>, public Configurable::DisplayOption<Options> {
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::DisplayOption<Options>,
+			public Configurable::ProcessorSpeedOption<Options> {
 			friend Configurable::DisplayOption<Options>;
+			friend Configurable::ProcessorSpeedOption<Options>;
 			public:
 				bool use_square_pixels = false;
 
-				Options(Configurable::OptionsType) : Configurable::DisplayOption<Options>(Configurable::Display::CompositeColour) {
+				Options(Configurable::OptionsType) :
+					Configurable::DisplayOption<Options>(Configurable::Display::CompositeColour),
+					Configurable::ProcessorSpeedOption<Options>(Configurable::ProcessorSpeed::Original) {
 					if(needs_declare()) {
 						DeclareField(use_square_pixels);
 						declare_display_option();
+						declare_processor_speed_option();
 						limit_enum(&output, Configurable::Display::CompositeMonochrome, Configurable::Display::CompositeColour, -1);
 					}
 				}
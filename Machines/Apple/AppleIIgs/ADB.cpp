@@ -47,7 +47,11 @@ GLU::GLU() :
 	bus_(HalfCycles(1'789'772)),
 	controller_id_(bus_.add_device()),
 	mouse_(bus_),
-	keyboard_(bus_) {}
+	keyboard_(bus_) {
+	// The microcontroller signals at the bit level, but the keyboard and mouse
+	// needn't; have the bus relay whole commands to them.
+	bus_.set_relays_transactions(true);
+}
 
 // MARK: - External interface.
 
@@ -160,7 +164,26 @@ void GLU::set_microcontroller_rom(const std::vector<uint8_t> &rom) {
 }
 
 void GLU::run_for(Cycles cycles) {
-	executor_.run_for(cycles);
+	// The microcontroller spends almost all of its time polling for work. So clock it only while there
+	// is some, and for long enough afterwards to complete any resulting autopoll and post the results;
+	// otherwise merely advance its timers and the bus.
+	if(has_work()) {
+		cycles_since_work_ = Cycles(0);
+	}
+	if(cycles_since_work_ < IdleThreshold) {
+		cycles_since_work_ += cycles;
+		executor_.run_for(cycles);
+	} else {
+		executor_.run_idle_for(cycles);
+	}
+}
+
+bool GLU::has_work() const {
+	return
+		(registers_[4] & uint8_t(MicrocontrollerFlags::CommandRegisterFull)) ||
+		executor_.has_pending_timer() ||
+		bus_.is_active() ||
+		bus_.has_pending_service_request();
 }
 
 // MARK: - M50470 port handler
@@ -57,6 +57,13 @@ class GLU: public InstructionSet::M50740::PortHandler {
 	private:
 		InstructionSet::M50740::Executor executor_;
 
+		// The microcontroller is clocked only while there is work to do, i.e. a command from the host,
+		// a running timer, bus activity or a device seeking service, and for IdleThreshold afterwards;
+		// that's 20ms at the GLU's 3.58Mhz clock, which is longer than the ADB autopoll interval.
+		static constexpr Cycles IdleThreshold = Cycles(71'591);
+		Cycles cycles_since_work_;
+		bool has_work() const;
+
 		void run_ports_for(Cycles) override;
 		void set_port_output(int port, uint8_t value) override;
 		uint8_t get_port_input(int port) override;
@@ -188,6 +188,7 @@ namespace IIgs {
 class ConcreteMachine:
 	public Activity::Source,
 	public Apple::IIgs::Machine,
+	public Configurable::Device,
 	public MachineTypes::AudioProducer,
 	public MachineTypes::JoystickMachine,
 	public MachineTypes::MappedKeyboardMachine,
@@ -201,6 +202,7 @@ class ConcreteMachine:
 		ConcreteMachine(const Analyser::Static::AppleIIgs::Target &target, const ROMMachine::ROMFetcher &rom_fetcher) :
 			m65816_(*this),
 			memory_(target.model >= Analyser::Static::AppleIIgs::Target::Model::ROM03),
+			adb_glu_(Cycles(CLOCK_RATE / 1000)),
 			iwm_(CLOCK_RATE / 2),
 			drives35_{
 				{CLOCK_RATE / 2, true},
@@ -381,6 +383,19 @@ class ConcreteMachine:
 			drives525_[1].set_activity_observer(observer, "Second 5.25\" Drive", true);
 		}
 
+		// MARK: Configurable::Device.
+		std::unique_ptr<Reflection::Struct> get_options() final {
+			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
+			options->parallel_subsystems = parallel_subsystems_;
+			return options;
+		}
+
+		void set_options(const std::unique_ptr<Reflection::Struct> &str) final {
+			const auto options = dynamic_cast<Options *>(str.get());
+			parallel_subsystems_ = options->parallel_subsystems;
+			adb_glu_.set_is_asynchronous(parallel_subsystems_);
+		}
+
 		// MARK: BusHandler.
 		uint64_t total = 0;
 		forceinline Cycles perform_bus_operation(const CPU::WDC65816::BusOperation operation, const uint32_t address, uint8_t *const value) {
@@ -1084,7 +1099,8 @@ class ConcreteMachine:
 				update_interrupts();
 
 				const bool is_vertical_blank = video_.last_valid()->get_is_vertical_blank(video_.time_since_flush());
-				if(is_vertical_blank != adb_glu_.last_valid()->get_vertical_blank()) {
+				if(is_vertical_blank != adb_vertical_blank_) {
+					adb_vertical_blank_ = is_vertical_blank;
 					adb_glu_->set_vertical_blank(is_vertical_blank);
 				}
 			}
@@ -1105,16 +1121,21 @@ class ConcreteMachine:
 			return &keyboard_mapper_;
 		}
 
+		// Input is posted to the ADB GLU in sequence with any time it is running ahead on another thread.
 		void set_key_state(uint16_t key, bool is_pressed) final {
-			adb_glu_.last_valid()->keyboard().set_key_pressed(Apple::ADB::Key(key), is_pressed);
+			adb_glu_.perform([key, is_pressed] (Apple::IIgs::ADB::GLU &glu) {
+				glu.keyboard().set_key_pressed(Apple::ADB::Key(key), is_pressed);
+			});
 		}
 
 		void clear_all_keys() final {
-			adb_glu_.last_valid()->keyboard().clear_all_keys();
+			adb_glu_.perform([] (Apple::IIgs::ADB::GLU &glu) {
+				glu.keyboard().clear_all_keys();
+			});
 		}
 
 		Inputs::Mouse &get_mouse() final {
-			return adb_glu_.last_valid()->get_mouse();
+			return mouse_;
 		}
 
 		const std::vector<std::unique_ptr<Inputs::Joystick>> &get_joysticks() final {
@@ -1132,6 +1153,7 @@ class ConcreteMachine:
 
 		uint8_t speed_register_ = 0x40;	// i.e. Power-on status. (TODO: only if ROM03?)
 		uint8_t motor_flags_ = 0x80;
+		bool parallel_subsystems_ = false;
 
 		// MARK: - Memory storage.
 
@@ -1143,7 +1165,37 @@ class ConcreteMachine:
 
 		Apple::Clock::ParallelClock clock_;
 		JustInTimeActor<Apple::IIgs::Video::Video, Cycles, 1, 2> video_;	// i.e. run video at 7Mhz.
-		JustInTimeActor<Apple::IIgs::ADB::GLU, Cycles, 1, 4> adb_glu_;		// i.e. 3,579,545Mhz.
+		AsyncJustInTimeActor<Apple::IIgs::ADB::GLU, Cycles, 1, 4> adb_glu_;	// i.e. 3,579,545Mhz; may run ahead on another thread.
+		bool adb_vertical_blank_ = false;
+
+		struct Mouse: public Inputs::Mouse {
+			Mouse(decltype(adb_glu_) &glu) : glu_(glu) {}
+
+			void move(int x, int y) final {
+				glu_.perform([x, y] (Apple::IIgs::ADB::GLU &glu) {
+					glu.get_mouse().move(x, y);
+				});
+			}
+
+			int get_number_of_buttons() final {
+				return glu_.last_valid()->get_mouse().get_number_of_buttons();
+			}
+
+			void set_button_pressed(int index, bool is_pressed) final {
+				glu_.perform([index, is_pressed] (Apple::IIgs::ADB::GLU &glu) {
+					glu.get_mouse().set_button_pressed(index, is_pressed);
+				});
+			}
+
+			void reset_all_buttons() final {
+				glu_.perform([] (Apple::IIgs::ADB::GLU &glu) {
+					glu.get_mouse().reset_all_buttons();
+				});
+			}
+
+			private:
+				decltype(adb_glu_) &glu_;
+		} mouse_{adb_glu_};
 		Zilog::SCC::z8530 scc_;
 		JustInTimeActor<Apple::IWM, Cycles, 1, 2> iwm_;
 		Cycles cycles_since_clock_tick_;
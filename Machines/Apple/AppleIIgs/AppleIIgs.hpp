@@ -24,6 +24,20 @@ class Machine {
 
 		/// Creates and returns an AppleIIgs.
 		static Machine *AppleIIgs(const Analyser::Static::Target *target, const ROMMachine::ROMFetcher &rom_fetcher);
+
+		/// Defines the runtime options available for an Apple IIgs.
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::ParallelSubsystemsOption<Options> {
+			friend Configurable::ParallelSubsystemsOption<Options>;
+			public:
+				Options(Configurable::OptionsType) :
+					Configurable::ParallelSubsystemsOption<Options>(false) {
+					if(needs_declare()) {
+						declare_parallel_subsystems_option();
+					}
+				}
+		};
 };
 
 }
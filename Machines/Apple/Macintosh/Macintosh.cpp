@@ -24,6 +24,7 @@
 
 #include "../../../ClockReceiver/JustInTime.hpp"
 #include "../../../ClockReceiver/ClockingHintSource.hpp"
+#include "../../../ClockReceiver/ProcessorClockMultiplier.hpp"
 #include "../../../Configurable/StandardOptions.hpp"
 
 //#define LOG_TRACE
@@ -43,6 +44,7 @@
 
 #include "../../../Analyser/Static/Macintosh/Target.hpp"
 
+#include "../../Utility/MemoryAccount.hpp"
 #include "../../Utility/MemoryPacker.hpp"
 #include "../../Utility/MemoryFuzzer.hpp"
 
@@ -71,6 +73,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 	public MachineTypes::ScanProducer,
 	public MachineTypes::AudioProducer,
 	public MachineTypes::MediaTarget,
+	public MachineTypes::MemoryAccountant,
 	public MachineTypes::MouseMachine,
 	public MachineTypes::MappedKeyboardMachine,
 	public CPU::MC68000::BusHandler,
@@ -188,7 +191,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 		}
 
 		void run_for(const Cycles cycles) final {
-			mc68000_.run_for(cycles);
+			mc68000_.run_for(processor_clock_.processor_time(cycles));
 		}
 
 		using Microcycle = CPU::MC68000::Microcycle;
@@ -344,7 +347,9 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 					// only every other access slot is available during the period of video
 					// output. I believe this to be correct for the 128k, 512k and Plus.
 					// More research to do on other models.
-					if(video_is_outputting() && ram_subcycle_ < 8) {
+					//
+					// An accelerated processor is assumed to have uncontended access.
+					if(processor_clock_.multiplier() == 1 && video_is_outputting() && ram_subcycle_ < 8) {
 						delay = HalfCycles(8 - ram_subcycle_);
 						advance_time(delay);
 					}
@@ -491,6 +496,20 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 			}
 		}
 
+		// MARK: - MemoryAccountant
+		void account_memory(Utility::MemoryAccount &account) final {
+			account.add("Internal drive", drives_[0].get_memory_usage());
+			account.add("External drive", drives_[1].get_memory_usage());
+
+			const auto &storage = hard_drive_->get_storage();
+			account.add("SCSI drive", storage ? storage->get_memory_usage() : 0);
+		}
+
+		void set_memory_budget(size_t bytes) final {
+			drives_[0].set_memory_budget(bytes);
+			drives_[1].set_memory_budget(bytes);
+		}
+
 		// MARK: - Activity Source
 		void set_activity_observer(Activity::Observer *observer) final {
 			iwm_->set_activity_observer(observer);
@@ -504,6 +523,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 		std::unique_ptr<Reflection::Struct> get_options() final {
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->quickboot = quickboot_;
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
@@ -514,6 +534,9 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 			const auto options = dynamic_cast<Options *>(str.get());
 			quickboot_ = options->quickboot;
 
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
+
 			using Model = Analyser::Static::Macintosh::Target::Model;
 			const bool is_plus_rom = model == Model::Mac512ke || model == Model::MacPlus;
 			if(quickboot_ && is_plus_rom) {
@@ -529,6 +552,9 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 	private:
 		bool quickboot_ = false;
 
+		ProcessorClockMultiplier<HalfCycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
+
 		void set_component_prefers_clocking(ClockingHint::Source *, ClockingHint::Preference) final {
 			scsi_bus_is_clocked_ = scsi_bus_.preferred_clocking() != ClockingHint::Preference::None;
 		}
@@ -548,8 +574,9 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 			cycle.set_value16(0xffff);
 		}
 
-		/// Advances all non-CPU components by @c duration half cycles.
-		forceinline void advance_time(HalfCycles duration) {
+		/// Advances all non-CPU components by the time equivalent to @c processor_duration half cycles of the 68000.
+		forceinline void advance_time(HalfCycles processor_duration) {
+			const HalfCycles duration = processor_clock_.machine_time(processor_duration);
 			time_since_video_update_ += duration;
 			iwm_ += duration;
 			ram_subcycle_ = (ram_subcycle_ + duration.as_integral()) & 15;
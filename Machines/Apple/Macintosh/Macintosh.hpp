@@ -23,13 +23,19 @@ class Machine {
 		/// Creates and returns a Macintosh.
 		static Machine *Macintosh(const Analyser::Static::Target *target, const ROMMachine::ROMFetcher &rom_fetcher);
 
-		class Options: public Reflection::StructImpl<Options>, public Configurable::QuickbootOption<Options> {
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::QuickbootOption<Options>,
+			public Configurable::ProcessorSpeedOption<Options> {
 			friend Configurable::QuickbootOption<Options>;
+			friend Configurable::ProcessorSpeedOption<Options>;
 			public:
 				Options(Configurable::OptionsType type) :
-					Configurable::QuickbootOption<Options>(type == Configurable::OptionsType::UserFriendly) {
+					Configurable::QuickbootOption<Options>(type == Configurable::OptionsType::UserFriendly),
+					Configurable::ProcessorSpeedOption<Options>(Configurable::ProcessorSpeed::Original) {
 					if(needs_declare()) {
 						declare_quickboot_option();
+						declare_processor_speed_option();
 					}
 				}
 		};
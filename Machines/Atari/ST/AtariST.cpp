@@ -25,6 +25,7 @@
 
 #include "../../../ClockReceiver/JustInTime.hpp"
 #include "../../../ClockReceiver/ForceInline.hpp"
+#include "../../../ClockReceiver/ProcessorClockMultiplier.hpp"
 #include "../../../Configurable/StandardOptions.hpp"
 
 #include "../../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
@@ -32,6 +33,7 @@
 #define LOG_PREFIX "[ST] "
 #include "../../../Outputs/Log.hpp"
 
+#include "../../Utility/MemoryAccount.hpp"
 #include "../../Utility/MemoryPacker.hpp"
 #include "../../Utility/MemoryFuzzer.hpp"
 
@@ -53,6 +55,7 @@ class ConcreteMachine:
 	public MachineTypes::JoystickMachine,
 	public MachineTypes::MappedKeyboardMachine,
 	public MachineTypes::MediaTarget,
+	public MachineTypes::MemoryAccountant,
 	public ClockingHint::Observer,
 	public Motorola::ACIA::ACIA::InterruptDelegate,
 	public Motorola::MFP68901::MFP68901::InterruptDelegate,
@@ -170,7 +173,7 @@ class ConcreteMachine:
 				ikbd_.run_for(HalfCycles(0));
 			}
 
-			mc68000_.run_for(cycles);
+			mc68000_.run_for(processor_clock_.processor_time(cycles));
 		}
 
 		// MARK: MC68000::BusHandler
@@ -231,8 +234,9 @@ class ConcreteMachine:
 				}
 
 				// DTack delay rule: if accessing RAM or the shifter, align with the two cycles next available
-				// for the CPU to access that side of the bus.
-				if(address < ram_.size() || (address == 0xff8260)) {
+				// for the CPU to access that side of the bus. An accelerated processor is assumed to have
+				// uncontended access.
+				if(processor_clock_.multiplier() == 1 && (address < ram_.size() || (address == 0xff8260))) {
 					// DTack will be implicit; work out how long until that should be,
 					// and apply bus error constraints.
 					const int i_phase = bus_phase_.as<int>() & 7;
@@ -446,7 +450,10 @@ class ConcreteMachine:
 		}
 
 	private:
-		forceinline void advance_time(HalfCycles length) {
+		forceinline void advance_time(HalfCycles processor_length) {
+			// If the processor is running faster than original, map its time back to that of the rest of the machine.
+			HalfCycles length = processor_clock_.machine_time(processor_length);
+
 			// Advance the relevant counters.
 			cycles_since_audio_update_ += length;
 			mfp_ += length;
@@ -677,6 +684,27 @@ class ConcreteMachine:
 			dma_->set_activity_observer(observer);
 		}
 
+		// MARK: - MemoryAccountant
+		void account_memory(Utility::MemoryAccount &account) final {
+			account.add("Internal drive", dma_.last_valid()->get_floppy_drive(0).get_memory_usage());
+			account.add("External drive", dma_.last_valid()->get_floppy_drive(1).get_memory_usage());
+			account.add("Keyboard ACIA", acia_memory_usage(*keyboard_acia_.last_valid()));
+			account.add("MIDI ACIA", acia_memory_usage(*midi_acia_.last_valid()));
+		}
+
+		void set_memory_budget(size_t bytes) final {
+			dma_.last_valid()->get_floppy_drive(0).set_memory_budget(bytes);
+			dma_.last_valid()->get_floppy_drive(1).set_memory_budget(bytes);
+			for(auto acia: {keyboard_acia_.last_valid(), midi_acia_.last_valid()}) {
+				acia->transmit.set_memory_budget(bytes);
+				acia->receive.set_memory_budget(bytes);
+			}
+		}
+
+		static size_t acia_memory_usage(const Motorola::ACIA::ACIA &acia) {
+			return acia.transmit.get_memory_usage() + acia.receive.get_memory_usage();
+		}
+
 		// MARK: - Video Range
 		Video::Range video_range_;
 		void video_did_change_access_range(Video *video) final {
@@ -687,13 +715,20 @@ class ConcreteMachine:
 		std::unique_ptr<Reflection::Struct> get_options() final {
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->output = get_video_signal_configurable();
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
 		void set_options(const std::unique_ptr<Reflection::Struct> &str) final {
 			const auto options = dynamic_cast<Options *>(str.get());
 			set_video_signal_configurable(options->output);
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
 		}
+
+		// MARK: - Processor speed.
+		ProcessorClockMultiplier<HalfCycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
 };
 
 }
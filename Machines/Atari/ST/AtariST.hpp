@@ -24,13 +24,20 @@ class Machine {
 
 		static Machine *AtariST(const Analyser::Static::Target *target, const ROMMachine::ROMFetcher &rom_fetcher);
 
-		class Options: public Reflection::StructImpl<Options>, public Configurable::DisplayOption<Options> {
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::DisplayOption<Options>,
+			public Configurable::ProcessorSpeedOption<Options> {
 			friend Configurable::DisplayOption<Options>;
+			friend Configurable::ProcessorSpeedOption<Options>;
 			public:
-				Options(Configurable::OptionsType type) : Configurable::DisplayOption<Options>(
-					type == Configurable::OptionsType::UserFriendly ? Configurable::Display::RGB : Configurable::Display::CompositeColour) {
+				Options(Configurable::OptionsType type) :
+					Configurable::DisplayOption<Options>(
+						type == Configurable::OptionsType::UserFriendly ? Configurable::Display::RGB : Configurable::Display::CompositeColour),
+					Configurable::ProcessorSpeedOption<Options>(Configurable::ProcessorSpeed::Original) {
 					if(needs_declare()) {
 						declare_display_option();
+						declare_processor_speed_option();
 						limit_enum(&output, Configurable::Display::RGB, Configurable::Display::CompositeColour, -1);
 					}
 				}
@@ -129,6 +129,10 @@ void DMAController::set_floppy_disk(std::shared_ptr<Storage::Disk::Disk> disk, s
 	fdc_.set_disk(disk, drive);
 }
 
+Storage::Disk::Drive &DMAController::get_floppy_drive(size_t drive) {
+	return fdc_.get_floppy_drive(drive);
+}
+
 void DMAController::run_for(HalfCycles duration) {
 	running_time_ += duration;
 	fdc_.run_for(duration.flush<Cycles>());
@@ -40,6 +40,7 @@ class DMAController: public WD::WD1770::Delegate, public ClockingHint::Source, p
 
 		void set_floppy_drive_selection(bool drive1, bool drive2, bool side2);
 		void set_floppy_disk(std::shared_ptr<Storage::Disk::Disk> disk, size_t drive);
+		Storage::Disk::Drive &get_floppy_drive(size_t drive);
 
 		struct Delegate {
 			virtual void dma_controller_did_change_output(DMAController *) = 0;
@@ -85,6 +86,10 @@ class DMAController: public WD::WD1770::Delegate, public ClockingHint::Source, p
 				get_drive(drive).set_disk(disk);
 			}
 
+			Storage::Disk::Drive &get_floppy_drive(size_t drive) {
+				return get_drive(drive);
+			}
+
 		} fdc_;
 
 		void wd1770_did_change_output(WD::WD1770 *) final;
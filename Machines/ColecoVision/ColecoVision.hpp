@@ -21,13 +21,19 @@ class Machine {
 		virtual ~Machine();
 		static Machine *ColecoVision(const Analyser::Static::Target *target, const ROMMachine::ROMFetcher &rom_fetcher);
 
-		class Options: public Reflection::StructImpl<Options>, public Configurable::DisplayOption<Options> {
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::DisplayOption<Options>,
+			public Configurable::FrameSkipOption<Options> {
 			friend Configurable::DisplayOption<Options>;
+			friend Configurable::FrameSkipOption<Options>;
 			public:
 				Options(Configurable::OptionsType type) :
-					Configurable::DisplayOption<Options>(type == Configurable::OptionsType::UserFriendly ? Configurable::Display::SVideo : Configurable::Display::CompositeColour) {
+					Configurable::DisplayOption<Options>(type == Configurable::OptionsType::UserFriendly ? Configurable::Display::SVideo : Configurable::Display::CompositeColour),
+					Configurable::FrameSkipOption<Options>(0) {
 					if(needs_declare()) {
 						declare_display_option();
+						declare_frame_skip_option();
 						limit_enum(&output, Configurable::Display::SVideo, Configurable::Display::CompositeColour, -1);
 					}
 				}
@@ -18,6 +18,7 @@
 #include "../../../Components/6522/6522.hpp"
 
 #include "../../../ClockReceiver/ForceInline.hpp"
+#include "../../../ClockReceiver/ProcessorClockMultiplier.hpp"
 #include "../../../Outputs/Log.hpp"
 
 #include "../../../Storage/Tape/Parsers/Commodore.hpp"
@@ -228,6 +229,26 @@ class Vic6560BusHandler {
 			*colour_data = colour_memory[address & 0x03ff];
 		}
 
+		/// Performs @c count consecutive reads on behalf of the 6560, a kilobyte segment at a time.
+		void perform_reads(uint16_t address, int count, uint8_t *pixel_data, uint8_t *colour_data) {
+			while(count) {
+				const int offset = address & 0x3ff;
+				const int length = std::min(count, 0x400 - offset);
+				const uint8_t *const segment = video_memory_map[address >> 10];
+				if(segment) {
+					std::copy(&segment[offset], &segment[offset + length], pixel_data);
+				} else {
+					std::fill(pixel_data, pixel_data + length, 0xff);
+				}
+				std::copy(&colour_memory[offset], &colour_memory[offset + length], colour_data);
+
+				pixel_data += length;
+				colour_data += length;
+				count -= length;
+				address = (address + length) & 0x3fff;
+			}
+		}
+
 		// It is assumed that these pointers have been filled in by the machine.
 		uint8_t *video_memory_map[16];	// Segments video memory into 1kb portions.
 		uint8_t *colour_memory;			// Colour memory must be contiguous.
@@ -500,8 +521,12 @@ class ConcreteMachine:
 
 		// to satisfy CPU::MOS6502::Processor
 		forceinline Cycles perform_bus_operation(CPU::MOS6502::BusOperation operation, uint16_t address, uint8_t *value) {
+			// if the processor is running faster than original then only some of its
+			// cycles will coincide with a cycle of the rest of the machine
+			const Cycles machine_cycles = processor_clock_.machine_time(Cycles(1));
+
 			// run the phase-1 part of this cycle, in which the VIC accesses memory
-			cycles_since_mos6560_update_++;
+			cycles_since_mos6560_update_ += machine_cycles;
 
 			// run the phase-2 part of the cycle, which is whatever the 6502 said it should be
 			if(isReadOperation(operation)) {
@@ -588,7 +613,9 @@ class ConcreteMachine:
 			} else {
 				uint8_t *ram = processor_write_memory_map_[address >> 10];
 				if(ram) {
-					update_video();
+					// Bring the 6560 up to date only if it might see this write; otherwise it
+					// can continue to run whole lines in bulk.
+					if(is_video_visible(address)) update_video();
 					ram[address & 0x3ff] = *value;
 				}
 				// Anything between 0x9000 and 0x9400 is the IO area.
@@ -605,16 +632,16 @@ class ConcreteMachine:
 				}
 			}
 
-			user_port_via_.run_for(Cycles(1));
-			keyboard_via_.run_for(Cycles(1));
+			user_port_via_.run_for(machine_cycles);
+			keyboard_via_.run_for(machine_cycles);
 			if(typer_ && address == 0xeb1e && operation == CPU::MOS6502::BusOperation::ReadOpcode) {
 				if(!typer_->type_next_character()) {
 					clear_all_keys();
 					typer_.reset();
 				}
 			}
-			if(!tape_is_sleeping_ && !hold_tape_) tape_->run_for(Cycles(1));
-			if(c1540_) c1540_->run_for(Cycles(1));
+			if(!tape_is_sleeping_ && !hold_tape_) tape_->run_for(machine_cycles);
+			if(c1540_) c1540_->run_for(machine_cycles);
 
 			return Cycles(1);
 		}
@@ -629,7 +656,7 @@ class ConcreteMachine:
 		}
 
 		void run_for(const Cycles cycles) final {
-			m6502_.run_for(cycles);
+			m6502_.run_for(processor_clock_.processor_time(cycles));
 		}
 
 		void set_scan_target(Outputs::Display::ScanTarget *scan_target) final {
@@ -678,6 +705,7 @@ class ConcreteMachine:
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->output = get_video_signal_configurable();
 			options->quickload = allow_fast_tape_hack_;
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
@@ -686,6 +714,8 @@ class ConcreteMachine:
 
 			set_video_signal_configurable(options->output);
 			allow_fast_tape_hack_ = options->quickload;
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
 			set_use_fast_tape();
 		}
 
@@ -716,6 +746,12 @@ class ConcreteMachine:
 
 		uint8_t *processor_read_memory_map_[64];
 		uint8_t *processor_write_memory_map_[64];
+
+		/// @returns @c true if @c address is within memory that the 6560 can see: the first 1kb and the
+		/// 4kb from 0x1000 of internal RAM, or colour RAM.
+		static constexpr bool is_video_visible(uint16_t address) {
+			return address < 0x0400 || (address >= 0x1000 && address < 0x2000) || (address & 0xfc00) == 0x9400;
+		}
 		void write_to_map(uint8_t **map, uint8_t *area, uint16_t address, uint16_t length) {
 			address >>= 10;
 			length >>= 10;
@@ -740,6 +776,10 @@ class ConcreteMachine:
 		MOS::MOS6522::MOS6522<UserPortVIA> user_port_via_;
 		MOS::MOS6522::MOS6522<KeyboardVIA> keyboard_via_;
 
+		// Processor speed
+		ProcessorClockMultiplier<Cycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
+
 		// Tape
 		std::shared_ptr<Storage::Tape::BinaryTapePlayer> tape_;
 		bool use_fast_tape_hack_ = false;
@@ -28,16 +28,23 @@ class Machine {
 		/// Creates and returns a Vic-20.
 		static Machine *Vic20(const Analyser::Static::Target *target, const ROMMachine::ROMFetcher &rom_fetcher);
 
-		class Options: public Reflection::StructImpl<Options>, public Configurable::DisplayOption<Options>, public Configurable::QuickloadOption<Options> {
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::DisplayOption<Options>,
+			public Configurable::QuickloadOption<Options>,
+			public Configurable::ProcessorSpeedOption<Options> {
 			friend Configurable::DisplayOption<Options>;
 			friend Configurable::QuickloadOption<Options>;
+			friend Configurable::ProcessorSpeedOption<Options>;
 			public:
 				Options(Configurable::OptionsType type) :
 					Configurable::DisplayOption<Options>(type == Configurable::OptionsType::UserFriendly ? Configurable::Display::SVideo : Configurable::Display::CompositeColour),
-					Configurable::QuickloadOption<Options>(type == Configurable::OptionsType::UserFriendly) {
+					Configurable::QuickloadOption<Options>(type == Configurable::OptionsType::UserFriendly),
+					Configurable::ProcessorSpeedOption<Options>(Configurable::ProcessorSpeed::Original) {
 					if(needs_declare()) {
 						declare_display_option();
 						declare_quickload_option();
+						declare_processor_speed_option();
 						limit_enum(&output, Configurable::Display::SVideo, Configurable::Display::CompositeColour, -1);
 					}
 				}
@@ -26,6 +26,7 @@
 #include "../../Analyser/Static/Acorn/Target.hpp"
 
 #include "../../ClockReceiver/JustInTime.hpp"
+#include "../../ClockReceiver/ProcessorClockMultiplier.hpp"
 
 #include "Interrupts.hpp"
 #include "Keyboard.hpp"
@@ -227,7 +228,11 @@ template <bool has_scsi_bus> class ConcreteMachine:
 
 				// For the entire frame, RAM is accessible only on odd cycles; in modes below 4
 				// it's also accessible only outside of the pixel regions.
-				cycles += video_.last_valid()->get_cycles_until_next_ram_availability(video_.time_since_flush().template as<int>() + 1);
+				//
+				// An accelerated processor is assumed to have uncontended access to RAM.
+				if(processor_clock_.multiplier() == 1) {
+					cycles += video_.last_valid()->get_cycles_until_next_ram_availability(video_.time_since_flush().template as<int>() + 1);
+				}
 			} else {
 				switch(address & 0xff0f) {
 					case 0xfe00:
@@ -472,18 +477,21 @@ template <bool has_scsi_bus> class ConcreteMachine:
 				}
 			}
 
-			if(video_ += Cycles(int(cycles))) {
+			// If the processor is running faster than original, map its time back to that of the rest of the machine.
+			const Cycles machine_cycles = processor_clock_.machine_time(Cycles(int(cycles)));
+
+			if(video_ += machine_cycles) {
 				signal_interrupt(video_.last_valid()->get_interrupts());
 			}
 
-			cycles_since_audio_update_ += Cycles(int(cycles));
+			cycles_since_audio_update_ += machine_cycles;
 			if(cycles_since_audio_update_ > Cycles(16384)) update_audio();
-			tape_.run_for(Cycles(int(cycles)));
+			tape_.run_for(machine_cycles);
 
-			if(typer_) typer_->run_for(Cycles(int(cycles)));
-			if(plus3_) plus3_->run_for(Cycles(4*int(cycles)));
+			if(typer_) typer_->run_for(machine_cycles);
+			if(plus3_) plus3_->run_for(machine_cycles * Cycles(4));
 			if(shift_restart_counter_) {
-				shift_restart_counter_ -= cycles;
+				shift_restart_counter_ -= machine_cycles.as<int>();
 				if(shift_restart_counter_ <= 0) {
 					shift_restart_counter_ = 0;
 					m6502_.set_power_on(true);
@@ -494,7 +502,7 @@ template <bool has_scsi_bus> class ConcreteMachine:
 
 			if constexpr (has_scsi_bus) {
 				if(scsi_is_clocked_) {
-					scsi_bus_.run_for(Cycles(int(cycles)));
+					scsi_bus_.run_for(machine_cycles);
 				}
 			}
 
@@ -532,7 +540,7 @@ template <bool has_scsi_bus> class ConcreteMachine:
 		}
 
 		void run_for(const Cycles cycles) final {
-			m6502_.run_for(cycles);
+			m6502_.run_for(processor_clock_.processor_time(cycles));
 		}
 
 		void scsi_bus_did_change(SCSI::Bus *, SCSI::BusState new_state, double) final {
@@ -596,6 +604,7 @@ template <bool has_scsi_bus> class ConcreteMachine:
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->output = get_video_signal_configurable();
 			options->quickload = allow_fast_tape_hack_;
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
@@ -604,6 +613,8 @@ template <bool has_scsi_bus> class ConcreteMachine:
 
 			set_video_signal_configurable(options->output);
 			allow_fast_tape_hack_ = options->quickload;
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
 			set_use_fast_tape_hack();
 		}
 
@@ -738,6 +749,9 @@ template <bool has_scsi_bus> class ConcreteMachine:
 		Tape tape_;
 		bool use_fast_tape_hack_ = false;
 		bool allow_fast_tape_hack_ = false;
+
+		ProcessorClockMultiplier<Cycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
 		void set_use_fast_tape_hack() {
 			use_fast_tape_hack_ = allow_fast_tape_hack_ && tape_.has_tape();
 		}
@@ -0,0 +1,108 @@
+//
+//  InputEvent.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef InputEvent_h
+#define InputEvent_h
+
+#include "../ClockReceiver/TimeTypes.hpp"
+#include "../Inputs/Joystick.hpp"
+#include "../Inputs/Keyboard.hpp"
+
+#include <cstddef>
+
+namespace MachineTypes {
+
+/*!
+	Describes a single keyboard, joystick or mouse action together with the time at which
+	it should occur, relative to the start of the run period that it accompanies.
+
+	See TimedMachine::run_for(Time::Seconds, const std::vector<InputEvent> &).
+*/
+struct InputEvent {
+	enum class Type {
+		/// Applies @c key and @c symbol as per KeyboardMachine::apply_key, with @c is_active as the pressed state.
+		Key,
+		/// Sets digital input @c input() of joystick @c index to @c is_active.
+		JoystickDigital,
+		/// Sets analogue input @c input() of joystick @c index to @c value.
+		JoystickAnalogue,
+		/// Moves the mouse by (@c x, @c y).
+		MouseMotion,
+		/// Sets mouse button @c index to @c is_active.
+		MouseButton,
+	};
+	Type type;
+
+	/// The time since the start of the run period at which this event occurs.
+	Time::Seconds offset = 0.0;
+
+	Inputs::Keyboard::Key key = Inputs::Keyboard::Key::Help;
+	char symbol = 0;
+	bool is_active = false;
+
+	size_t index = 0;
+	Inputs::Joystick::Input::Type input_type = Inputs::Joystick::Input::Fire;
+	Inputs::Joystick::Input::Info input_info{};
+	float value = 0.0f;
+
+	int x = 0, y = 0;
+
+	/// @returns The joystick input described by @c input_type and @c input_info.
+	Inputs::Joystick::Input input() const {
+		Inputs::Joystick::Input input(input_type);
+		input.info = input_info;
+		return input;
+	}
+
+	static InputEvent key_event(Time::Seconds offset, Inputs::Keyboard::Key key, char symbol, bool is_pressed) {
+		InputEvent event(Type::Key, offset);
+		event.key = key;
+		event.symbol = symbol;
+		event.is_active = is_pressed;
+		return event;
+	}
+
+	static InputEvent joystick_event(Time::Seconds offset, size_t joystick, const Inputs::Joystick::Input &input, bool is_active) {
+		InputEvent event(Type::JoystickDigital, offset);
+		event.index = joystick;
+		event.input_type = input.type;
+		event.input_info = input.info;
+		event.is_active = is_active;
+		return event;
+	}
+
+	static InputEvent joystick_event(Time::Seconds offset, size_t joystick, const Inputs::Joystick::Input &input, float value) {
+		InputEvent event(Type::JoystickAnalogue, offset);
+		event.index = joystick;
+		event.input_type = input.type;
+		event.input_info = input.info;
+		event.value = value;
+		return event;
+	}
+
+	static InputEvent mouse_motion_event(Time::Seconds offset, int x, int y) {
+		InputEvent event(Type::MouseMotion, offset);
+		event.x = x;
+		event.y = y;
+		return event;
+	}
+
+	static InputEvent mouse_button_event(Time::Seconds offset, int button, bool is_pressed) {
+		InputEvent event(Type::MouseButton, offset);
+		event.index = size_t(button);
+		event.is_active = is_pressed;
+		return event;
+	}
+
+	private:
+		InputEvent(Type type, Time::Seconds offset) : type(type), offset(offset) {}
+};
+
+}
+
+#endif /* InputEvent_h */
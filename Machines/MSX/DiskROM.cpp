@@ -8,6 +8,10 @@
 
 #include "DiskROM.hpp"
 
+#include "../../Storage/Disk/Controller/SectorReader.hpp"
+
+#include <algorithm>
+
 using namespace MSX;
 
 DiskROM::DiskROM(MSX::MemorySlot &slot) :
@@ -29,7 +33,8 @@ void DiskROM::write(uint16_t address, uint8_t value, bool) {
 			});
 		} break;
 		case 0x7ffd: {
-			set_drive(1 << (value & 1));
+			selected_drive_ = value & 1;
+			set_drive(1 << selected_drive_);
 
 			const bool drive_motor = value & 0x80;
 			for_all_drives([drive_motor] (Storage::Disk::Drive &drive, size_t) {
@@ -62,6 +67,30 @@ void DiskROM::set_disk(std::shared_ptr<Storage::Disk::Disk> disk, size_t drive)
 	get_drive(drive).set_disk(disk);
 }
 
+int DiskROM::read_sectors(size_t drive, uint8_t media, uint16_t first_sector, int count, uint8_t *target, uint8_t &error) {
+	// Media descriptors F8–FF: bit 0 indicates double sided, bit 1 indicates eight rather than nine sectors per track.
+	const int sectors_per_track = (media & 2) ? 8 : 9;
+	const int sides = (media & 1) ? 2 : 1;
+
+	Storage::Disk::SectorReader reader(get_drive(drive));
+	for(int c = 0; c < count; c++) {
+		const int sector = first_sector + c;
+		const int track = sector / (sectors_per_track * sides);
+		const int head = (sector / sectors_per_track) % sides;
+
+		using Result = Storage::Disk::SectorReader::Result;
+		switch(reader.read(head, track, uint8_t(1 + (sector % sectors_per_track)), &target[c * 512], 512)) {
+			case Result::Success:	break;
+			case Result::NoDisk:	error = 2;	return c;	// Not ready.
+			case Result::CRCError:	error = 4;	return c;	// Data error.
+			case Result::NotFound:
+			case Result::WrongSize:	error = 8;	return c;	// Record not found.
+		}
+	}
+
+	return count;
+}
+
 void DiskROM::set_head_load_request(bool head_load) {
 	// Magic!
 	set_head_loaded(head_load);
@@ -72,3 +101,24 @@ void DiskROM::set_activity_observer(Activity::Observer *observer) {
 		drive.set_activity_observer(observer, "Drive " + std::to_string(index), true);
 	});
 }
+
+// MARK: - State.
+
+DiskROM::State::State(DiskROM &source) : State() {
+	controller = WD::State(source);
+	drive_a = Storage::Disk::Drive::State(source.get_drive(0));
+	drive_b = Storage::Disk::Drive::State(source.get_drive(1));
+	selected_drive = source.selected_drive_;
+	controller_cycles = source.controller_cycles_;
+}
+
+void DiskROM::State::apply(DiskROM &target) {
+	if(selected_drive >= 0) {
+		target.selected_drive_ = selected_drive & 1;
+		target.set_drive(1 << target.selected_drive_);
+	}
+	drive_a.apply(target.get_drive(0));
+	drive_b.apply(target.get_drive(1));
+	controller.apply(target);
+	target.controller_cycles_ = long(std::clamp(controller_cycles, int64_t(0), int64_t(715908)));
+}
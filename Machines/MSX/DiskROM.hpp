@@ -32,10 +32,52 @@ class DiskROM: public MemorySlotHandler, public WD::WD1770 {
 		void set_disk(std::shared_ptr<Storage::Disk::Disk> disk, size_t drive);
 		void set_activity_observer(Activity::Observer *observer);
 
+		/*!
+			Provides the read half of the disk ROM's PHYDIO entry point without involving the 1793:
+			reads @c count 512-byte sectors, starting at logical sector @c first_sector, from @c drive
+			into @c target. The disk is assumed to have the geometry implied by MSX-DOS media
+			descriptor @c media.
+
+			@returns The number of sectors successfully read. If this is fewer than @c count then
+				@c error will have been set to the MSX-DOS error code that PHYDIO should return.
+		*/
+		int read_sectors(size_t drive, uint8_t media, uint16_t first_sector, int count, uint8_t *target, uint8_t &error);
+
+		/*!
+			Captures or restores the state of the disk cartridge: its 1793, both drives and the drive selection.
+			As per WD::State, states should be captured only while the 1793 is idle.
+		*/
+		struct State: public Reflection::StructImpl<State> {
+			WD::State controller;
+			Storage::Disk::Drive::State drive_a;
+			Storage::Disk::Drive::State drive_b;
+
+			// The most recent drive selected via 0x7ffd, or -1 if none has been.
+			int selected_drive = -1;
+			int64_t controller_cycles = 0;
+
+			State() {
+				if(needs_declare()) {
+					DeclareField(controller);
+					DeclareField(drive_a);
+					DeclareField(drive_b);
+					DeclareField(selected_drive);
+					DeclareField(controller_cycles);
+				}
+			}
+
+			/// Captures the state of @c source.
+			State(DiskROM &source);
+
+			/// Applies this state to @c target, which should have the same disks inserted as @c source did.
+			void apply(DiskROM &target);
+		};
+
 	private:
 		const std::vector<uint8_t> &rom_;
 
 		long int controller_cycles_ = 0;
+		int selected_drive_ = -1;
 
 		void set_head_load_request(bool head_load) final;
 };
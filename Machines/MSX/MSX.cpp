@@ -9,10 +9,13 @@
 #include "MSX.hpp"
 
 #include <algorithm>
+#include <array>
+#include <optional>
 
 #include "DiskROM.hpp"
 #include "Keyboard.hpp"
 #include "MemorySlotHandler.hpp"
+#include "State.hpp"
 
 #include "../../Analyser/Static/MSX/Cartridge.hpp"
 #include "Cartridges/ASCII8kb.hpp"
@@ -21,6 +24,7 @@
 #include "Cartridges/KonamiWithSCC.hpp"
 
 #include "../../Processors/Z80/Z80.hpp"
+#include "../../Processors/Z80/State/State.hpp"
 
 #include "../../Components/1770/1770.hpp"
 #include "../../Components/8255/i8255.hpp"
@@ -46,9 +50,13 @@
 #include "../../Configurable/StandardOptions.hpp"
 #include "../../ClockReceiver/ForceInline.hpp"
 #include "../../ClockReceiver/JustInTime.hpp"
+#include "../../ClockReceiver/ProcessorClockMultiplier.hpp"
 
 #include "../../Analyser/Static/MSX/Target.hpp"
 
+#include "../Utility/MemoryAccount.hpp"
+#include "../Utility/StateHasher.hpp"
+
 namespace MSX {
 
 class AYPortHandler: public GI::AY38910::PortHandler {
@@ -180,8 +188,11 @@ class ConcreteMachine:
 	public MachineTypes::AudioProducer,
 	public MachineTypes::ScanProducer,
 	public MachineTypes::MediaTarget,
+	public MachineTypes::MemoryAccountant,
 	public MachineTypes::MappedKeyboardMachine,
 	public MachineTypes::JoystickMachine,
+	public MachineTypes::StateHashProducer,
+	public MachineTypes::StateProducer,
 	public Configurable::Device,
 	public ClockingHint::Observer,
 	public Activity::Source,
@@ -312,6 +323,8 @@ class ConcreteMachine:
 			bios_slot().map(0, 0, 32768);
 
 			ram_slot().resize_source(RAMSize);
+			ram_hasher_.emplace(ram(), RAMSize);
+			vdp_.last_valid()->set_ram_dirty_flags(vram_hasher_.dirty_flags());
 			ram_slot().template map<MemorySlot::AccessType::ReadWrite>(0, 0, 65536);
 
 			if constexpr (model == Target::Model::MSX2) {
@@ -353,6 +366,28 @@ class ConcreteMachine:
 
 			// Establish default paging.
 			page_primary(0);
+
+			// Install state if supplied; states are produced only by an MSX 1 without MSX-MUSIC.
+			if constexpr (model == Target::Model::MSX1 && !has_opll) {
+				if(target.state) {
+					const auto state = static_cast<State *>(target.state.get());
+					state->vdp.apply(*vdp_.last_valid());
+					state->z80.apply(z80_);
+					state->ay.apply(speaker_.ay);
+					std::copy_n(state->ram.begin(), std::min(state->ram.size(), RAMSize), ram());
+
+					i8255_.write(0xab, state->ppi_control);
+					i8255_.write(0xa8, state->primary_slots);
+					i8255_.write(0xaa, state->ppi_port_c);
+
+					if(DiskROM *const handler = disk_handler()) {
+						state->disk.apply(*handler);
+					}
+
+					// Use -> to ensure that the VDP's next sequence point reflects its new state.
+					z80_.set_interrupt_line(vdp_->get_interrupt_line());
+				}
+			}
 		}
 
 		~ConcreteMachine() {
@@ -379,8 +414,67 @@ class ConcreteMachine:
 			return &speaker_.speaker;
 		}
 
+		// MARK: - MemoryAccountant.
+		void account_memory(Utility::MemoryAccount &account) final {
+			if(DiskROM *const handler = disk_handler()) {
+				account.add("Disk drives", handler->get_memory_usage());
+			}
+		}
+
+		void set_memory_budget(size_t bytes) final {
+			if(DiskROM *const handler = disk_handler()) {
+				handler->set_memory_budget(bytes);
+			}
+		}
+
+		// MARK: - StateHashProducer.
+		void hash_state(Utility::StateHasher &hasher) final {
+			vdp_.flush();
+
+			hasher.add("Z80", CPU::Z80::State(z80_));
+			hasher.add("AY", GI::AY38910::State(speaker_.ay));
+
+			const auto vdp = vdp_.last_valid()->state_summary();
+			hasher.add("VDP", vdp.data(), vdp.size());
+			hasher.add("VRAM", vram_hasher_);
+
+			const uint8_t paging[] = {primary_slots_, ram_mapper_[0], ram_mapper_[1], ram_mapper_[2], ram_mapper_[3]};
+			hasher.add("Paging", paging, sizeof(paging));
+			hasher.add("RAM", *ram_hasher_);
+		}
+
+		// MARK: - StateProducer.
+		std::unique_ptr<Reflection::Struct> get_state() final {
+			if constexpr (model != Target::Model::MSX1 || has_opll) {
+				return nullptr;
+			} else {
+				// The disk controller's state can be captured only between commands; bring it up to date to check.
+				DiskROM *const handler = disk_handler();
+				if(handler) {
+					handler->run_for(disk_primary().cycles_since_update.template flush<HalfCycles>());
+					if(handler->get_is_busy()) {
+						return nullptr;
+					}
+				}
+				vdp_.flush();
+
+				auto state = std::make_unique<State>();
+				state->z80 = CPU::Z80::State(z80_);
+				state->vdp = TI::TMS::State(*vdp_.last_valid());
+				state->ay = GI::AY38910::State(speaker_.ay);
+				state->ram.assign(ram(), ram() + RAMSize);
+				state->ppi_control = i8255_.read(0xab);
+				state->primary_slots = primary_slots_;
+				state->ppi_port_c = i8255_.read(0xaa);
+				if(handler) {
+					state->disk = DiskROM::State(*handler);
+				}
+				return state;
+			}
+		}
+
 		void run_for(const Cycles cycles) final {
-			z80_.run_for(cycles);
+			z80_.run_for(processor_clock_.processor_time(cycles));
 		}
 
 		float get_confidence() final {
@@ -487,6 +581,15 @@ class ConcreteMachine:
 				read_pointers_[c+1] = slot.read_pointer(c+1);
 				write_pointers_[c+1] = slot.write_pointer(c+1);
 			}
+
+			// Writes to anything other than RAM are collected by scratch_dirty_.
+			for(int c = 0; c < 8; c++) {
+				const bool is_ram = ram_hasher_ && write_pointers_[c] >= ram() && write_pointers_[c] < ram() + RAMSize;
+				dirty_pointers_[c] =
+					(is_ram ?
+						&ram_hasher_->dirty_flags()[(write_pointers_[c] - ram()) >> Utility::PagedMemoryHasher::PageShift] :
+						scratch_dirty_.data()) - c*PagesPerSegment;
+			}
 			set_use_fast_tape();
 		}
 
@@ -494,10 +597,13 @@ class ConcreteMachine:
 		forceinline HalfCycles perform_machine_cycle(const CPU::Z80::PartialMachineCycle &cycle) {
 			// Per the best information I currently have, the MSX inserts an extra cycle into each opcode read,
 			// but otherwise runs without pause.
+			//
+			// If the processor is running faster than original, map its time back to that of the rest of the machine.
 			const HalfCycles addition((cycle.operation == CPU::Z80::PartialMachineCycle::ReadOpcode) ? 2 : 0);
-			const HalfCycles total_length = addition + cycle.length;
+			const HalfCycles length = processor_clock_.machine_time(cycle.length);
+			const HalfCycles total_length = length + processor_clock_.machine_time(addition);
 			if(vdp_ += total_length) {
-				z80_.set_interrupt_line(vdp_->get_interrupt_line(), vdp_.last_sequence_point_overrun());
+				z80_.set_interrupt_line(vdp_->get_interrupt_line(), processor_clock_.processor_time(vdp_.last_sequence_point_overrun()));
 			}
 			time_since_ay_update_ += total_length;
 			memory_slots_[0].cycles_since_update += total_length;
@@ -531,6 +637,7 @@ class ConcreteMachine:
 								if(new_speed) {
 									ram()[0xfca4] = new_speed->minimum_start_bit_duration;
 									ram()[0xfca5] = new_speed->low_high_disrimination_duration;
+									ram_hasher_->mark_dirty(0xfca4);
 									z80_.set_value_of(CPU::Z80::Register::Flags, 0);
 								} else {
 									z80_.set_value_of(CPU::Z80::Register::Flags, 1);
@@ -568,6 +675,15 @@ class ConcreteMachine:
 							}
 						}
 
+						if(use_fast_disk_ && address == 0x4010 && disk_rom_is_paged(1)) {
+							// PHYDIO, in the disk ROM.
+							if(perform_fast_disk_read()) {
+								// RET.
+								*cycle.value = 0xc9;
+								break;
+							}
+						}
+
 						if(!address) {
 							pc_zero_accesses_++;
 						}
@@ -612,6 +728,7 @@ class ConcreteMachine:
 								read_pointers_[pc_address_ >> 13] != memory_slots_[0].read_pointer(pc_address_ >> 13));
 						} else {
 							write_pointers_[address >> 13][address & 8191] = *cycle.value;
+							dirty_pointers_[address >> 13][address >> Utility::PagedMemoryHasher::PageShift] = 1;
 						}
 					} break;
 
@@ -753,6 +870,7 @@ class ConcreteMachine:
 								const int next_write_address = (write_address + 1) % buffer_size;
 								if(next_write_address == read_address) break;
 								ram()[write_address + buffer_start] = uint8_t(input_text_[characters_written]);
+								ram_hasher_->mark_dirty(size_t(write_address + buffer_start));
 								++characters_written;
 								write_address = next_write_address;
 							}
@@ -762,6 +880,7 @@ class ConcreteMachine:
 							write_address += buffer_start;
 							ram()[0xf3f8] = uint8_t(write_address);
 							ram()[0xf3f9] = uint8_t(write_address >> 8);
+							ram_hasher_->mark_dirty(0xf3f8);
 						}
 					break;
 
@@ -770,7 +889,7 @@ class ConcreteMachine:
 			}
 
 			if(!tape_player_is_sleeping_)
-				tape_player_.run_for(int(cycle.length.as_integral()));
+				tape_player_.run_for(int(length.as_integral()));
 
 			return addition;
 		}
@@ -812,6 +931,7 @@ class ConcreteMachine:
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->output = get_video_signal_configurable();
 			options->quickload = allow_fast_tape_;
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
@@ -819,7 +939,10 @@ class ConcreteMachine:
 			const auto options = dynamic_cast<Options *>(str.get());
 			set_video_signal_configurable(options->output);
 			allow_fast_tape_ = options->quickload;
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
 			set_use_fast_tape();
+			use_fast_disk_ = allow_fast_tape_ && disk_handler();
 		}
 
 		// MARK: - Sleeper
@@ -909,11 +1032,15 @@ class ConcreteMachine:
 
 		CPU::Z80::Processor<ConcreteMachine, false, false> z80_;
 		JustInTimeActor<TI::TMS::TMS9918<vdp_model()>> vdp_;
+		Utility::PagedMemoryHasher vram_hasher_{vdp_.last_valid()->ram(), vdp_.last_valid()->ram_size()};
 		Intel::i8255::i8255<i8255PortHandler> i8255_;
 
 		Storage::Tape::BinaryTapePlayer tape_player_;
 		bool tape_player_is_sleeping_ = false;
 		bool allow_fast_tape_ = false;
+
+		ProcessorClockMultiplier<HalfCycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
 		bool use_fast_tape_ = false;
 		void set_use_fast_tape() {
 			use_fast_tape_ =
@@ -924,6 +1051,68 @@ class ConcreteMachine:
 				!(memory_slots_[0].secondary_paging() & 3);
 		}
 
+		bool use_fast_disk_ = false;
+
+		/// @returns @c true if the disk ROM is currently visible in 16kb page @c page, i.e. if both the disk
+		/// cartridge's primary slot and, within that, the disk ROM's secondary slot are selected there.
+		bool disk_rom_is_paged(int page) {
+			return
+				((primary_slots_ >> (page * 2)) & 3) == 2 &&
+				!((disk_primary().secondary_paging() >> (page * 2)) & 3);
+		}
+
+		/*!
+			Attempts to satisfy a call to the disk ROM's PHYDIO entry point directly from the disk image.
+
+			Only reads into non-handled memory outside of any page in which the disk ROM is visible are supported;
+			anything else is left to the ROM.
+
+			@returns @c true if the call has been fully performed and the caller should return; @c false otherwise.
+		*/
+		bool perform_fast_disk_read() {
+			using Register = CPU::Z80::Register;
+			const uint16_t flags = z80_.value_of(Register::Flags);
+			if(flags & CPU::Z80::Flag::Carry) return false;		// i.e. this is a write.
+
+			const uint16_t drive = z80_.value_of(Register::A);
+			const int count = z80_.value_of(Register::B);
+			const uint16_t destination = z80_.value_of(Register::HL);
+			const int end = destination + count * 512;
+			if(drive > 1 || !count || end > 0x10000) return false;
+
+			for(int page = destination >> 13; page <= (end - 1) >> 13; ++page) {
+				if(
+					disk_rom_is_paged(page >> 1) ||
+					!write_pointers_[page] ||
+					memory_slots_[(primary_slots_ >> ((page >> 1) * 2)) & 3].handler
+				) return false;
+			}
+
+			std::vector<uint8_t> sectors(size_t(count) * 512);
+			uint8_t error = 0;
+			const int sectors_read = disk_handler()->read_sectors(
+				drive,
+				uint8_t(z80_.value_of(Register::C)),
+				z80_.value_of(Register::DE),
+				count,
+				sectors.data(),
+				error);
+
+			for(int c = 0; c < sectors_read * 512; c++) {
+				const int address = destination + c;
+				write_pointers_[address >> 13][address & 8191] = sectors[size_t(c)];
+				dirty_pointers_[address >> 13][address >> Utility::PagedMemoryHasher::PageShift] = 1;
+			}
+
+			// Report the number of sectors not read and, if that's non-zero, the error.
+			z80_.set_value_of(Register::B, uint16_t(count - sectors_read));
+			if(sectors_read < count) {
+				z80_.set_value_of(Register::A, error);
+				z80_.set_value_of(Register::Flags, flags | CPU::Z80::Flag::Carry);
+			}
+			return true;
+		}
+
 		i8255PortHandler i8255_port_handler_;
 		Speaker<has_opll> speaker_;
 		AYPortHandler ay_port_handler_;
@@ -938,6 +1127,12 @@ class ConcreteMachine:
 		uint8_t *write_pointers_[8];
 		uint8_t ram_mapper_[4]{};
 
+		// Parallels write_pointers_ with pointers into the flags of ram_hasher_, offset so as to be indexed by address.
+		static constexpr int PagesPerSegment = 8192 >> Utility::PagedMemoryHasher::PageShift;
+		std::optional<Utility::PagedMemoryHasher> ram_hasher_;
+		std::array<uint8_t, PagesPerSegment> scratch_dirty_;
+		uint8_t *dirty_pointers_[8];
+
 		/// Optionally attaches non-default logic to any of the four things selectable
 		/// via the primary slot register.
 		///
@@ -0,0 +1,59 @@
+//
+//  State.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef MSX_State_hpp
+#define MSX_State_hpp
+
+#include "../../Reflection/Struct.hpp"
+#include "../../Processors/Z80/State/State.hpp"
+
+#include "../../Components/9918/9918.hpp"
+#include "../../Components/AY38910/AY38910.hpp"
+
+#include "DiskROM.hpp"
+
+namespace MSX {
+
+/*!
+	The state of an MSX 1 without MSX-MUSIC; cartridges and disks are media, so aren't included.
+*/
+struct State: public Reflection::StructImpl<State> {
+	CPU::Z80::State z80;
+	TI::TMS::State vdp;
+	GI::AY38910::State ay;
+
+	// 64kb of RAM, in linear order.
+	std::vector<uint8_t> ram;
+
+	// The 8255 PPI's control register, and its port A and C outputs; port A selects
+	// the primary slot for each 16kb page and port C the keyboard line, cassette motor
+	// and keyboard click.
+	uint8_t ppi_control = 0x82;
+	uint8_t primary_slots = 0;
+	uint8_t ppi_port_c = 0x50;
+
+	// The disk cartridge, if the machine has a disk drive.
+	DiskROM::State disk;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(z80);
+			DeclareField(vdp);
+			DeclareField(ay);
+			DeclareField(ram);
+			DeclareField(ppi_control);
+			DeclareField(primary_slots);
+			DeclareField(ppi_port_c);
+			DeclareField(disk);
+		}
+	}
+};
+
+}
+
+#endif /* MSX_State_hpp */
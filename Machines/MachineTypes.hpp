@@ -18,8 +18,10 @@
 #include "JoystickMachine.hpp"
 #include "KeyboardMachine.hpp"
 #include "MediaTarget.hpp"
+#include "MemoryAccountant.hpp"
 #include "MouseMachine.hpp"
 #include "ScanProducer.hpp"
+#include "StateHashProducer.hpp"
 #include "StateProducer.hpp"
 #include "TimedMachine.hpp"
 
@@ -424,12 +424,16 @@ template <Analyser::Static::Sega::Target::Model model> class ConcreteMachine:
 		std::unique_ptr<Reflection::Struct> get_options() final {
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
 			options->output = get_video_signal_configurable();
+			options->frame_skip = frame_skip_;
 			return options;
 		}
 
 		void set_options(const std::unique_ptr<Reflection::Struct> &str) final {
 			const auto options = dynamic_cast<Options *>(str.get());
 			set_video_signal_configurable(options->output);
+
+			frame_skip_ = options->frame_skip;
+			vdp_->set_frame_skip(frame_skip_);
 		}
 
 	private:
@@ -487,6 +491,7 @@ template <Analyser::Static::Sega::Target::Model model> class ConcreteMachine:
 		const Target::PagingScheme paging_scheme_;
 		CPU::Z80::Processor<ConcreteMachine, false, false> z80_;
 		JustInTimeActor<TI::TMS::TMS9918<tms_personality()>> vdp_;
+		int frame_skip_ = 0;
 
 		Concurrency::AsyncTaskQueue<false> audio_queue_;
 		TI::SN76489 sn76489_;
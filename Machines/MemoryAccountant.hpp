@@ -0,0 +1,40 @@
+//
+//  MemoryAccountant.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef MemoryAccountant_h
+#define MemoryAccountant_h
+
+#include <cstddef>
+
+namespace Utility {
+class MemoryAccount;
+}
+
+namespace MachineTypes {
+
+/*!
+	A MemoryAccountant can report the memory held by those of its structures that may grow
+	over the course of a run — track caches, write queues and the like — and can cap them.
+*/
+struct MemoryAccountant {
+	/*!
+		Adds the current size, in bytes, of each of this machine's growable structures to @c account.
+	*/
+	virtual void account_memory(Utility::MemoryAccount &account) = 0;
+
+	/*!
+		Sets the number of bytes that each growable structure may retain beyond whatever is
+		necessary for correct emulation, e.g. unwritten changes to a disk. Anything in excess
+		will be discarded as soon as it safely can be.
+	*/
+	virtual void set_memory_budget(size_t bytes) = 0;
+};
+
+}
+
+#endif /* MemoryAccountant_h */
@@ -12,12 +12,14 @@
 
 #include "../../../Components/AY38910/AY38910.hpp"
 #include "../../../Processors/Z80/Z80.hpp"
+#include "../../../Processors/Z80/State/State.hpp"
 #include "../../../Storage/Tape/Tape.hpp"
 #include "../../../Storage/Tape/Parsers/ZX8081.hpp"
 
 #include "../../../ClockReceiver/ForceInline.hpp"
 
 #include "../../Utility/MemoryFuzzer.hpp"
+#include "../../Utility/StateHasher.hpp"
 #include "../../Utility/Typer.hpp"
 
 #include "../../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
@@ -30,6 +32,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace {
@@ -57,6 +60,7 @@ template<bool is_zx81> class ConcreteMachine:
 	public MachineTypes::AudioProducer,
 	public MachineTypes::MediaTarget,
 	public MachineTypes::MappedKeyboardMachine,
+	public MachineTypes::StateHashProducer,
 	public Configurable::Device,
 	public Utility::TypeRecipient<CharacterMapper>,
 	public CPU::Z80::BusHandler,
@@ -102,6 +106,7 @@ template<bool is_zx81> class ConcreteMachine:
 				break;
 			}
 			Memory::Fuzz(ram_);
+			ram_hasher_.emplace(ram_.data(), ram_.size());
 
 			// Ensure valid initial key state.
 			clear_all_keys();
@@ -237,6 +242,7 @@ template<bool is_zx81> class ConcreteMachine:
 						if(next_byte != -1) {
 							const uint16_t hl = z80_.value_of(CPU::Z80::Register::HL);
 							ram_[hl & ram_mask_] = uint8_t(next_byte);
+							ram_hasher_->mark_dirty(hl & ram_mask_);
 							*cycle.value = 0x00;
 							z80_.set_value_of(CPU::Z80::Register::ProgramCounter, tape_return_address_ - 1);
 
@@ -282,6 +288,7 @@ template<bool is_zx81> class ConcreteMachine:
 				case CPU::Z80::PartialMachineCycle::Write:
 					if(address >= ram_base_) {
 						ram_[address & ram_mask_] = *cycle.value;
+						ram_hasher_->mark_dirty(address & ram_mask_);
 					}
 				break;
 
@@ -317,6 +324,12 @@ template<bool is_zx81> class ConcreteMachine:
 			return is_zx81 ? &speaker_ : nullptr;
 		}
 
+		// MARK: - StateHashProducer.
+		void hash_state(Utility::StateHasher &hasher) final {
+			hasher.add("Z80", CPU::Z80::State(z80_));
+			hasher.add("RAM", *ram_hasher_);
+		}
+
 		void run_for(const Cycles cycles) final {
 			z80_.run_for(cycles);
 		}
@@ -422,6 +435,7 @@ template<bool is_zx81> class ConcreteMachine:
 
 		std::vector<uint8_t> ram_;
 		uint16_t ram_mask_, ram_base_;
+		std::optional<Utility::PagedMemoryHasher> ram_hasher_;
 
 		std::vector<uint8_t> rom_;
 		uint16_t rom_mask_;
@@ -265,7 +265,7 @@ template <Timing timing> class Video {
 			return HalfCycles(timings.half_cycles_per_line * timings.lines_per_frame);
 		}
 
-		HalfCycles time_since_interrupt() {
+		HalfCycles time_since_interrupt() const {
 			const auto timings = get_timings();
 			if(time_into_frame_ >= timings.interrupt_time) {
 				return HalfCycles(time_into_frame_ - timings.interrupt_time);
@@ -284,13 +284,13 @@ template <Timing timing> class Video {
 			if(target == now) return;
 
 			// Is the time within this frame?
-			if(time > now) {
-				run_for(target - time);
+			if(target > now) {
+				run_for(target - now);
 				return;
 			}
 
 			// Then it's necessary to finish this frame and run into the next.
-			run_for(frame_duration() - now + time);
+			run_for(frame_duration() - now + target);
 		}
 
 	public:
@@ -482,11 +482,12 @@ struct State: public Reflection::StructImpl<State> {
 	}
 
 	template <typename Video> void apply(Video &target) {
+		// Establish timing first, as advancing the video may update the flash and line state.
+		target.set_time_since_interrupt(HalfCycles(half_cycles_since_interrupt));
 		target.set_border_colour(border_colour);
 		target.flash_mask_ = flash ? 0xff : 0x00;
 		target.flash_counter_ = flash_counter;
 		target.is_alternate_line_ = is_alternate_line;
-		target.set_time_since_interrupt(HalfCycles(half_cycles_since_interrupt));
 	}
 };
 
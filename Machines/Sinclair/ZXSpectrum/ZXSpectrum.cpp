@@ -36,10 +36,13 @@
 
 #include "../../../Analyser/Static/ZXSpectrum/Target.hpp"
 
+#include "../../Utility/MemoryAccount.hpp"
 #include "../../Utility/MemoryFuzzer.hpp"
+#include "../../Utility/StateHasher.hpp"
 #include "../../Utility/Typer.hpp"
 
 #include "../../../ClockReceiver/JustInTime.hpp"
+#include "../../../ClockReceiver/ProcessorClockMultiplier.hpp"
 
 #include <array>
 
@@ -127,7 +130,10 @@ template<Model model> class ConcreteMachine:
 	public MachineTypes::JoystickMachine,
 	public MachineTypes::MappedKeyboardMachine,
 	public MachineTypes::MediaTarget,
+	public MachineTypes::MemoryAccountant,
 	public MachineTypes::ScanProducer,
+	public MachineTypes::StateHashProducer,
+	public MachineTypes::StateProducer,
 	public MachineTypes::TimedMachine,
 	public Utility::TypeRecipient<CharacterMapper> {
 	public:
@@ -249,7 +255,7 @@ template<Model model> class ConcreteMachine:
 		// MARK: - TimedMachine.
 
 		void run_for(const Cycles cycles) override {
-			z80_.run_for(cycles);
+			z80_.run_for(processor_clock_.processor_time(cycles));
 
 			// Use this very broad timing base for the automatic enter depression.
 			// It's not worth polluting the main loop.
@@ -303,11 +309,14 @@ template<Model model> class ConcreteMachine:
 
 			const uint16_t address = cycle.address ? *cycle.address : 0x0000;
 
-			// Apply contention if necessary.
+			// Apply contention if necessary. An accelerated processor is assumed to have
+			// uncontended access to memory and ports.
+			const bool is_original_speed = processor_clock_.multiplier() == 1;
 			if constexpr (model >= Model::Plus2a) {
 				// Model applied: the trigger for the ULA inserting a delay is the falling edge
 				// of MREQ, which is always half a cycle into a read or write.
 				if(
+					is_original_speed &&
 					is_contended_[address >> 14] &&
 					cycle.operation >= PartialMachineCycle::ReadOpcodeStart &&
 					cycle.operation <= PartialMachineCycle::WriteStart) {
@@ -316,7 +325,7 @@ template<Model model> class ConcreteMachine:
 					advance(cycle.length + delay);
 					return delay;
 				}
-			} else {
+			} else if(is_original_speed) {
 				switch(cycle.operation) {
 					case CPU::Z80::PartialMachineCycle::Input:
 					case CPU::Z80::PartialMachineCycle::Output:
@@ -444,6 +453,7 @@ template<Model model> class ConcreteMachine:
 					}
 
 					write_pointers_[address >> 14][address] = *cycle.value;
+					dirty_pointers_[address >> 14][address >> Utility::PagedMemoryHasher::PageShift] = 1;
 
 					if constexpr (model >= Model::Plus2a) {
 						// Fill the floating bus buffer if this write is within the contended area.
@@ -612,12 +622,13 @@ template<Model model> class ConcreteMachine:
 		}
 
 	private:
-		void advance(HalfCycles duration) {
+		void advance(HalfCycles processor_duration) {
+			const HalfCycles duration = processor_clock_.machine_time(processor_duration);
 			time_since_audio_update_ += duration;
 
 			video_ += duration;
 			if(video_.did_flush()) {
-				z80_.set_interrupt_line(video_.last_valid()->get_interrupt_line(), video_.last_sequence_point_overrun());
+				z80_.set_interrupt_line(video_.last_valid()->get_interrupt_line(), processor_clock_.processor_time(video_.last_sequence_point_overrun()));
 			}
 
 			if(!tape_player_is_sleeping_) tape_player_.run_for(duration.as_integral());
@@ -726,6 +737,7 @@ template<Model model> class ConcreteMachine:
 			options->automatic_tape_motor_control = use_automatic_tape_motor_control_;
 			options->quickload = allow_fast_tape_hack_;
 			options->output = get_video_signal_configurable();
+			options->processor_speed = processor_speed_;
 			return options;
 		}
 
@@ -734,6 +746,8 @@ template<Model model> class ConcreteMachine:
 			set_video_signal_configurable(options->output);
 			set_use_automatic_tape_motor_control(options->automatic_tape_motor_control);
 			allow_fast_tape_hack_ = options->quickload;
+			processor_speed_ = options->processor_speed;
+			processor_clock_.set_multiplier(Configurable::processor_speed_multiplier(processor_speed_));
 			set_use_fast_tape();
 		}
 
@@ -743,6 +757,56 @@ template<Model model> class ConcreteMachine:
 			return &speaker_;
 		}
 
+		// MARK: - MemoryAccountant.
+		void account_memory(Utility::MemoryAccount &account) final {
+			if constexpr (model == Model::Plus3) {
+				account.add("Disk drives", fdc_->get_memory_usage());
+			}
+		}
+
+		void set_memory_budget(size_t bytes) final {
+			if constexpr (model == Model::Plus3) {
+				fdc_->set_memory_budget(bytes);
+			}
+		}
+
+		// MARK: - StateHashProducer.
+		void hash_state(Utility::StateHasher &hasher) final {
+			video_.flush();
+
+			hasher.add("Z80", CPU::Z80::State(z80_));
+			hasher.add("Video", Video::State(*video_.last_valid()));
+			hasher.add("AY", GI::AY38910::State(ay_));
+
+			const uint8_t paging[] = {port7ffd_, port1ffd_, uint8_t(disable_paging_)};
+			hasher.add("Paging", paging, sizeof(paging));
+			hasher.add("RAM", ram_hasher_);
+		}
+
+		// MARK: - StateProducer.
+		std::unique_ptr<Reflection::Struct> get_state() final {
+			video_.flush();
+
+			auto state = std::make_unique<State>();
+			state->z80 = CPU::Z80::State(z80_);
+			state->video = Video::State(*video_.last_valid());
+			state->ay = GI::AY38910::State(ay_);
+
+			// Mirror the constructor: 16kb and 48kb machines describe their RAM in linear order,
+			// others as a full set of banks plus the paging registers.
+			if constexpr (model <= Model::FortyEightK) {
+				state->ram.resize(model == Model::SixteenK ? 16*1024 : 48*1024);
+				for(size_t c = 0; c < state->ram.size() >> 14; c++) {
+					memcpy(&state->ram[c * 0x4000], &read_pointers_[c + 1][(c+1) * 0x4000], 0x4000);
+				}
+			} else {
+				state->ram.assign(ram_.begin(), ram_.end());
+				state->last_1ffd = port1ffd_;
+				state->last_7ffd = port7ffd_;
+			}
+			return state;
+		}
+
 		// MARK: - Activity Source.
 		void set_activity_observer(Activity::Observer *observer) override {
 			if constexpr (model == Model::Plus3) fdc_->set_activity_observer(observer);
@@ -752,6 +816,10 @@ template<Model model> class ConcreteMachine:
 	private:
 		CPU::Z80::Processor<ConcreteMachine, false, false> z80_;
 
+		// MARK: - Processor speed.
+		ProcessorClockMultiplier<HalfCycles> processor_clock_;
+		Configurable::ProcessorSpeed processor_speed_ = Configurable::ProcessorSpeed::Original;
+
 		// MARK: - Memory.
 		std::array<uint8_t, 64*1024> rom_;
 		std::array<uint8_t, 128*1024> ram_;
@@ -763,6 +831,13 @@ template<Model model> class ConcreteMachine:
 		bool is_contended_[4];
 		bool is_video_[4];
 
+		// Dirty flags for RAM, maintained in parallel with the write pointers; writes to ROM
+		// mark a scratch area instead.
+		static constexpr size_t PagesPerBank = 16384 / Utility::PagedMemoryHasher::PageSize;
+		Utility::PagedMemoryHasher ram_hasher_{ram_.data(), ram_.size()};
+		std::array<uint8_t, PagesPerBank> scratch_dirty_;
+		uint8_t *dirty_pointers_[4];
+
 		uint8_t port1ffd_ = 0;
 		uint8_t port7ffd_ = 0;
 		bool disable_paging_ = false;
@@ -833,6 +908,8 @@ template<Model model> class ConcreteMachine:
 
 			read_pointers_[bank] = read - offset;
 			write_pointers_[bank] = ((source < 0x80) ? read : scratch_.data()) - offset;
+			dirty_pointers_[bank] =
+				((source < 0x80) ? &ram_hasher_.dirty_flags()[source * PagesPerBank] : scratch_dirty_.data()) - bank*PagesPerBank;
 		}
 
 		void set_video_address() {
@@ -934,6 +1011,7 @@ template<Model model> class ConcreteMachine:
 				}
 
 				write_pointers_[target >> 14][target] = *next;
+				dirty_pointers_[target >> 14][target >> Utility::PagedMemoryHasher::PageShift] = 1;
 				parity ^= *next;
 				++target;
 			}
@@ -26,21 +26,28 @@ class Machine {
 		virtual void set_tape_is_playing(bool is_playing) = 0;
 		virtual bool get_tape_is_playing() = 0;
 
-		class Options: public Reflection::StructImpl<Options>, public Configurable::DisplayOption<Options>, public Configurable::QuickloadOption<Options> {
+		class Options:
+			public Reflection::StructImpl<Options>,
+			public Configurable::DisplayOption<Options>,
+			public Configurable::QuickloadOption<Options>,
+			public Configurable::ProcessorSpeedOption<Options> {
 			friend Configurable::DisplayOption<Options>;
 			friend Configurable::QuickloadOption<Options>;
+			friend Configurable::ProcessorSpeedOption<Options>;
 			public:
 				bool automatic_tape_motor_control = true;
 
 				Options(Configurable::OptionsType type) :
 					Configurable::DisplayOption<Options>(type == Configurable::OptionsType::UserFriendly ? Configurable::Display::RGB : Configurable::Display::CompositeColour),
 					Configurable::QuickloadOption<Options>(type == Configurable::OptionsType::UserFriendly),
+					Configurable::ProcessorSpeedOption<Options>(Configurable::ProcessorSpeed::Original),
 					automatic_tape_motor_control(type == Configurable::OptionsType::UserFriendly)
 				{
 					if(needs_declare()) {
 						DeclareField(automatic_tape_motor_control);
 						declare_display_option();
 						declare_quickload_option();
+						declare_processor_speed_option();
 					}
 				}
 		};
@@ -0,0 +1,34 @@
+//
+//  StateHashProducer.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef StateHashProducer_h
+#define StateHashProducer_h
+
+namespace Utility {
+class StateHasher;
+}
+
+namespace MachineTypes {
+
+/*!
+	A StateHashProducer can summarise its current state as a series of named component hashes,
+	allowing two runs of a machine to be compared cheaply, e.g. frame by frame.
+
+	Hashes are a debugging aid only; they have no meaning beyond the lifetime of a single process.
+*/
+struct StateHashProducer {
+	/*!
+		Adds a hash of every significant component of this machine — processor registers,
+		support chips, memory, etc — to @c hasher, in a stable order.
+	*/
+	virtual void hash_state(Utility::StateHasher &hasher) = 0;
+};
+
+}
+
+#endif /* StateHashProducer_h */
@@ -10,15 +10,23 @@
 #define State_h
 
 #include <memory>
-#include "../Analyser/Static/StaticAnalyser.hpp"
+#include "../Reflection/Struct.hpp"
 
 namespace MachineTypes {
 
+/*!
+	A StateProducer can capture its complete current state, in the same form that it accepts
+	via Analyser::Static::Target::state.
+
+	Supplying that state to a target otherwise identical to the one this machine was created from
+	produces an equivalent machine; media and anything else that the target describes are not included.
+*/
 struct StateProducer {
-	// TODO.
-//	virtual bool get_state(Analyser::Static::State *, [[maybe_unused]] bool advance_to_simple = false) {
-//		return false;
-//	}
+	/*!
+		@returns A description of this machine's current state, or @c nullptr if the machine's
+		configuration is one for which state can't be captured.
+	*/
+	virtual std::unique_ptr<Reflection::Struct> get_state() = 0;
 };
 
 };
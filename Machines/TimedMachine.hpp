@@ -13,9 +13,15 @@
 #include "../ClockReceiver/TimeTypes.hpp"
 
 #include "AudioProducer.hpp"
+#include "InputEvent.hpp"
+#include "JoystickMachine.hpp"
+#include "KeyboardMachine.hpp"
+#include "MouseMachine.hpp"
 #include "ScanProducer.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace MachineTypes {
 
@@ -33,6 +39,38 @@ class TimedMachine {
 			run_for(Cycles(int(cycles)));
 		}
 
+		/*!
+			Runs the machine for @c duration seconds, applying each of @c events at the
+			cycle nearest to its offset into that period.
+
+			@c events should be sorted by offset; any event with an offset earlier than its
+			predecessor is applied immediately after that predecessor, and any with an offset
+			beyond @c duration is applied at the end of the period.
+
+			This allows a host to supply a whole period's worth of input without needing to
+			subdivide its own calls to run_for.
+		*/
+		virtual void run_for(Time::Seconds duration, const std::vector<InputEvent> &events) {
+			const double rate = clock_rate_ * speed_multiplier_;
+			const double cycles = (duration * rate) + clock_conversion_error_;
+			const int total = int(cycles);
+
+			int elapsed = 0;
+			for(const auto &event: events) {
+				const int target = std::clamp(int((event.offset * rate) + clock_conversion_error_), elapsed, total);
+				if(target > elapsed) {
+					run_for(Cycles(target - elapsed));
+					elapsed = target;
+				}
+				apply_input_event(event);
+			}
+
+			clock_conversion_error_ = std::fmod(cycles, 1.0);
+			if(total > elapsed) {
+				run_for(Cycles(total - elapsed));
+			}
+		}
+
 		/*!
 			Sets a speed multiplier to apply to this machine; e.g. a multiplier of 1.5 will cause the
 			emulated machine to run 50% faster than a real machine. This speed-up is an emulation
@@ -89,6 +127,44 @@ class TimedMachine {
 			return clock_rate_;
 		}
 
+		/// Applies @c event to whichever of this machine's keyboard, joysticks or mouse it
+		/// describes; events for inputs that this machine does not have are ignored.
+		virtual void apply_input_event(const InputEvent &event) {
+			switch(event.type) {
+				case InputEvent::Type::Key:
+					if(auto keyboard_machine = dynamic_cast<KeyboardMachine *>(this)) {
+						keyboard_machine->apply_key(event.key, event.symbol, event.is_active, false);
+					}
+				break;
+
+				case InputEvent::Type::JoystickDigital:
+				case InputEvent::Type::JoystickAnalogue:
+					if(auto joystick_machine = dynamic_cast<JoystickMachine *>(this)) {
+						const auto &joysticks = joystick_machine->get_joysticks();
+						if(event.index >= joysticks.size()) break;
+
+						if(event.type == InputEvent::Type::JoystickDigital) {
+							joysticks[event.index]->set_input(event.input(), event.is_active);
+						} else {
+							joysticks[event.index]->set_input(event.input(), event.value);
+						}
+					}
+				break;
+
+				case InputEvent::Type::MouseMotion:
+					if(auto mouse_machine = dynamic_cast<MouseMachine *>(this)) {
+						mouse_machine->get_mouse().move(event.x, event.y);
+					}
+				break;
+
+				case InputEvent::Type::MouseButton:
+					if(auto mouse_machine = dynamic_cast<MouseMachine *>(this)) {
+						mouse_machine->get_mouse().set_button_pressed(int(event.index), event.is_active);
+					}
+				break;
+			}
+		}
+
 	private:
 		// Give the ScanProducer access to this machine's clock rate.
 		friend class ScanProducer;
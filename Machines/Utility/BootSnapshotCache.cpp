@@ -0,0 +1,179 @@
+//
+//  BootSnapshotCache.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "BootSnapshotCache.hpp"
+
+#include "MachineForTarget.hpp"
+#include "StateHasher.hpp"
+
+#include "../../Storage/Disk/Track/PCMTrack.hpp"
+
+#include <cstdio>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+using namespace Machine;
+
+namespace {
+
+/// Identifies the format of stored snapshots, including that of every machine's state; increment this whenever
+/// a change to either, or to emulation of any machine's boot, would make existing snapshots invalid.
+constexpr uint32_t SnapshotFormat = 2;
+
+bool read(const std::string &path, Reflection::Struct &state) {
+	FILE *const file = std::fopen(path.c_str(), "rb");
+	if(!file) return false;
+
+	std::vector<uint8_t> contents;
+	uint8_t buffer[4096];
+	size_t length;
+	while((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+		contents.insert(contents.end(), buffer, buffer + length);
+	}
+	std::fclose(file);
+
+	return !contents.empty() && state.deserialise(contents);
+}
+
+bool write(const std::string &path, const std::vector<uint8_t> &contents) {
+	// Write to a temporary file and then rename it, so that concurrent launches never see a partial snapshot.
+	const std::string temporary_path = path + "." + std::to_string(std::random_device()()) + ".tmp";
+	FILE *const file = std::fopen(temporary_path.c_str(), "wb");
+	if(!file) return false;
+
+	const bool did_write = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+	if(std::fclose(file) || !did_write || std::rename(temporary_path.c_str(), path.c_str())) {
+		std::remove(temporary_path.c_str());
+		return false;
+	}
+	return true;
+}
+
+}
+
+BootSnapshotCache::BootSnapshotCache(const std::string &directory, const ROMMachine::ROMFetcher &rom_fetcher) :
+	directory_(directory.empty() || directory.back() == '/' ? directory : directory + '/'),
+	rom_fetcher_(rom_fetcher) {}
+
+ROMMachine::ROMFetcher BootSnapshotCache::rom_fetcher() {
+	return [this] (const ROM::Request &request) {
+		auto roms = rom_fetcher_(request);
+		for(const auto &rom: roms) {
+			roms_[rom.first] = rom.second;
+		}
+		return roms;
+	};
+}
+
+std::string BootSnapshotCache::path(DynamicMachine &machine, const Analyser::Static::Target &target, Time::Seconds boot_duration) const {
+	using Hasher = Utility::StateHasher;
+	Hasher::Hash key = Hasher::hash(nullptr, 0);
+	const auto add = [&key] (const void *data, size_t size) {
+		key = Hasher::hash(data, size, key);
+	};
+	auto add_bytes = [&add] (const std::vector<uint8_t> &bytes) {
+		const uint64_t size = bytes.size();
+		add(&size, sizeof(size));
+		add(bytes.data(), bytes.size());
+	};
+
+	add(&SnapshotFormat, sizeof(SnapshotFormat));
+	add(&target.machine, sizeof(target.machine));
+	add(&boot_duration, sizeof(boot_duration));
+
+	// Construction and runtime options.
+	if(const auto reflectable_target = dynamic_cast<const Reflection::Struct *>(&target)) {
+		add_bytes(reflectable_target->serialise());
+	}
+	if(const auto configurable = machine.configurable_device()) {
+		add_bytes(configurable->get_options()->serialise());
+	}
+
+	// ROMs, in the map's stable order.
+	for(const auto &rom: roms_) {
+		add(&rom.first, sizeof(rom.first));
+		add_bytes(rom.second);
+	}
+
+	// Disks, by the content of each whole track; disks with tracks other than PCM tracks can't be cached.
+	for(const auto &disk: target.media.disks) {
+		const int heads = disk->get_head_count();
+		const auto maximum = disk->get_maximum_head_position();
+		add(&heads, sizeof(heads));
+
+		for(int head = 0; head < heads; head++) {
+			for(int position = 0; Storage::Disk::HeadPosition(position) < maximum; position++) {
+				const auto track = disk->get_track_at_position(Storage::Disk::Track::Address(head, Storage::Disk::HeadPosition(position)));
+				size_t hash = 0;
+				if(track) {
+					const auto pcm_track = dynamic_cast<Storage::Disk::PCMTrack *>(track.get());
+					if(!pcm_track) return std::string();
+					hash = pcm_track->content_hash();
+				}
+				add(&hash, sizeof(hash));
+			}
+		}
+	}
+
+	std::stringstream name;
+	name << directory_ << ShortNameForTargetMachine(target.machine) << '-';
+	name << std::hex << std::setw(16) << std::setfill('0') << key;
+	name << ".bson";
+	return name.str();
+}
+
+BootSnapshotCache::Outcome BootSnapshotCache::boot(std::unique_ptr<DynamicMachine> &machine, Analyser::Static::TargetList &targets, Time::Seconds boot_duration) {
+	// Media isn't part of a machine's state and may well affect boot, so only a single machine
+	// with no media other than disks, which are keyed by content, can be cached.
+	if(targets.size() != 1 || !machine->state_producer()) {
+		return Outcome::Unsupported;
+	}
+	auto &target = *targets.front();
+	const auto &media = target.media;
+	if(!media.tapes.empty() || !media.cartridges.empty() || !media.mass_storage_devices.empty()) {
+		return Outcome::Unsupported;
+	}
+	auto state = StateForMachine(target.machine);
+	if(!state || !machine->state_producer()->get_state()) {
+		return Outcome::Unsupported;
+	}
+
+	const std::string snapshot_path = path(*machine, target, boot_duration);
+	if(snapshot_path.empty()) {
+		return Outcome::Unsupported;
+	}
+
+	// Attempt to restore; a snapshot that can't be read or used is just replaced below.
+	if(read(snapshot_path, *state)) {
+		Error error;
+		target.state = std::move(state);
+		std::unique_ptr<DynamicMachine> restored(MachineForTargets(targets, rom_fetcher(), error));
+		target.state.reset();
+
+		if(restored) {
+			const auto configurable = machine->configurable_device();
+			const auto restored_configurable = restored->configurable_device();
+			if(configurable && restored_configurable) {
+				restored_configurable->set_options(configurable->get_options());
+			}
+
+			machine = std::move(restored);
+			return Outcome::Restored;
+		}
+	}
+
+	machine->timed_machine()->run_for(boot_duration);
+
+	// A boot that wrote to disk can't be reproduced from the disks as they were, so isn't stored.
+	if(!media.disks.empty() && path(*machine, target, boot_duration) != snapshot_path) {
+		return Outcome::NotStored;
+	}
+	const auto boot_state = machine->state_producer()->get_state();
+	return boot_state && write(snapshot_path, boot_state->serialise()) ? Outcome::Stored : Outcome::NotStored;
+}
@@ -0,0 +1,76 @@
+//
+//  BootSnapshotCache.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef BootSnapshotCache_hpp
+#define BootSnapshotCache_hpp
+
+#include "../DynamicMachine.hpp"
+#include "../ROMMachine.hpp"
+#include "../../Analyser/Static/StaticAnalyser.hpp"
+#include "../../ClockReceiver/TimeTypes.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Machine {
+
+/*!
+	Maintains a directory of machine states captured at the end of boot, so that later launches of
+	an identically-configured machine can resume from there rather than emulating boot again.
+
+	Snapshots are keyed by everything that affects boot: the snapshot format, the machine's construction
+	options, its runtime options, the contents of every ROM it loaded and the contents of any disks. To allow
+	ROM contents to be known, machines must be created via this cache's @c rom_fetcher().
+
+	Only machines that are StateProducers, that can produce state in their current configuration and
+	that have no media other than disks can be cached. Disks must consist of PCM tracks, and a boot that
+	writes to disk isn't stored.
+*/
+class BootSnapshotCache {
+	public:
+		/// Creates a cache that stores snapshots in @c directory, which should already exist, and that
+		/// obtains ROMs from @c rom_fetcher.
+		BootSnapshotCache(const std::string &directory, const ROMMachine::ROMFetcher &rom_fetcher);
+
+		/// @returns A ROM fetcher that defers to the one supplied at construction, noting the contents of
+		/// everything it supplies.
+		ROMMachine::ROMFetcher rom_fetcher();
+
+		enum class Outcome {
+			/// @c machine has been replaced with one restored from a snapshot.
+			Restored,
+			/// @c machine has been run through boot and a snapshot of it stored.
+			Stored,
+			/// @c machine has been run through boot but a snapshot of it could not be stored.
+			NotStored,
+			/// @c machine can't be cached, so has been left untouched.
+			Unsupported,
+		};
+
+		/*!
+			Brings @c machine, as created from @c targets via @c rom_fetcher() and with all runtime
+			options applied, to the end of boot.
+
+			If a snapshot exists for this configuration then @c machine is replaced with a new machine
+			created from it, with the same runtime options. Otherwise @c machine is run for
+			@c boot_duration and a snapshot of its state then stored.
+		*/
+		Outcome boot(std::unique_ptr<DynamicMachine> &machine, Analyser::Static::TargetList &targets, Time::Seconds boot_duration = 5.0);
+
+	private:
+		const std::string directory_;
+		const ROMMachine::ROMFetcher rom_fetcher_;
+		ROM::Map roms_;
+
+		/// @returns The path of the snapshot for this configuration, or an empty string if it can't be keyed.
+		std::string path(DynamicMachine &, const Analyser::Static::Target &, Time::Seconds boot_duration) const;
+};
+
+}
+
+#endif /* BootSnapshotCache_hpp */
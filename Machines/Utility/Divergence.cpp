@@ -0,0 +1,58 @@
+//
+//  Divergence.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "Divergence.hpp"
+
+#include "StateHasher.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace Machine;
+
+Divergence Machine::find_divergence(DynamicMachine &reference, DynamicMachine &candidate, int frames) {
+	const auto reference_producer = reference.state_hash_producer();
+	const auto candidate_producer = candidate.state_hash_producer();
+	assert(reference_producer && candidate_producer);
+
+	Utility::StateHasher reference_hasher, candidate_hasher;
+	Divergence result;
+	for(result.frame = 0; result.frame < frames; result.frame++) {
+		// Use the reference machine's idea of a frame, falling back on
+		// a 50Hz guess for machines that don't yet know.
+		Time::Seconds duration = 0.0;
+		if(const auto scan_producer = reference.scan_producer()) {
+			duration = scan_producer->get_scan_status().field_duration;
+		}
+		if(duration <= 0.0) duration = 1.0 / 50.0;
+
+		reference.timed_machine()->run_for(duration);
+		candidate.timed_machine()->run_for(duration);
+
+		reference_hasher.reset();
+		candidate_hasher.reset();
+		reference_producer->hash_state(reference_hasher);
+		candidate_producer->hash_state(candidate_hasher);
+
+		const auto &lhs = reference_hasher.components();
+		const auto &rhs = candidate_hasher.components();
+		const auto mismatch = std::mismatch(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		if(mismatch.first != lhs.end()) {
+			result.found = true;
+			result.component = mismatch.first->first;
+			return result;
+		}
+		if(mismatch.second != rhs.end()) {
+			result.found = true;
+			result.component = mismatch.second->first;
+			return result;
+		}
+	}
+
+	return result;
+}
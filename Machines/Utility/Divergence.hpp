@@ -0,0 +1,42 @@
+//
+//  Divergence.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef Divergence_hpp
+#define Divergence_hpp
+
+#include "../DynamicMachine.hpp"
+
+#include <string>
+
+namespace Machine {
+
+/*!
+	Describes the first point of divergence found by @c find_divergence.
+*/
+struct Divergence {
+	/// @c true if the two machines diverged within the frames tested.
+	bool found = false;
+	/// The frame at the end of which the machines were first seen to differ, counting from 0.
+	int frame = 0;
+	/// The name of the first component to differ.
+	std::string component;
+};
+
+/*!
+	Runs @c reference and @c candidate side by side for up to @c frames frames, comparing their
+	state hashes at the end of each, and reports the first frame and component at which they differ.
+
+	Frame length is taken from the reference machine's scan status.
+
+	Both machines must be StateHashProducers.
+*/
+Divergence find_divergence(DynamicMachine &reference, DynamicMachine &candidate, int frames);
+
+}
+
+#endif /* Divergence_hpp */
@@ -0,0 +1,155 @@
+//
+//  InputScript.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "InputScript.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+using namespace Machine;
+
+namespace {
+
+using Key = Inputs::Keyboard::Key;
+
+// Names for every Inputs::Keyboard::Key, in declaration order.
+constexpr const char *KeyNames[] = {
+	"Escape", "F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8", "F9", "F10", "F11", "F12", "PrintScreen", "ScrollLock", "Pause",
+	"BackTick", "k1", "k2", "k3", "k4", "k5", "k6", "k7", "k8", "k9", "k0", "Hyphen", "Equals", "Backspace",
+	"Tab", "Q", "W", "E", "R", "T", "Y", "U", "I", "O", "P", "OpenSquareBracket", "CloseSquareBracket", "Backslash",
+	"CapsLock", "A", "S", "D", "F", "G", "H", "J", "K", "L", "Semicolon", "Quote", "Hash", "Enter",
+	"LeftShift", "Z", "X", "C", "V", "B", "N", "M", "Comma", "FullStop", "ForwardSlash", "RightShift",
+	"LeftControl", "LeftOption", "LeftMeta", "Space", "RightMeta", "RightOption", "RightControl",
+	"Left", "Right", "Up", "Down",
+	"Insert", "Home", "PageUp", "Delete", "End", "PageDown",
+	"NumLock", "KeypadSlash", "KeypadAsterisk", "KeypadDelete",
+	"Keypad7", "Keypad8", "Keypad9", "KeypadPlus",
+	"Keypad4", "Keypad5", "Keypad6", "KeypadMinus",
+	"Keypad1", "Keypad2", "Keypad3", "KeypadEnter",
+	"Keypad0", "KeypadDecimalPoint", "KeypadEquals",
+	"Help",
+};
+static_assert(std::size(KeyNames) == size_t(Key::Max) + 1);
+
+bool parse_key(const std::string &name, Key &key) {
+	const auto found = std::find(std::begin(KeyNames), std::end(KeyNames), name);
+	if(found == std::end(KeyNames)) return false;
+	key = Key(found - std::begin(KeyNames));
+	return true;
+}
+
+bool parse_joystick_input(const std::string &name, Inputs::Joystick::Input::Type &type) {
+	using Type = Inputs::Joystick::Input::Type;
+	if(name == "fire")	{	type = Type::Fire;	return true;	}
+	if(name == "up")	{	type = Type::Up;	return true;	}
+	if(name == "down")	{	type = Type::Down;	return true;	}
+	if(name == "left")	{	type = Type::Left;	return true;	}
+	if(name == "right")	{	type = Type::Right;	return true;	}
+	return false;
+}
+
+bool parse_state(const std::string &name, bool &is_active) {
+	if(name == "down")	{	is_active = true;	return true;	}
+	if(name == "up")	{	is_active = false;	return true;	}
+	return false;
+}
+
+}
+
+InputScript::InputScript(std::istream &source) {
+	using InputEvent = MachineTypes::InputEvent;
+
+	std::string line;
+	int line_number = 0;
+	while(std::getline(source, line)) {
+		++line_number;
+		line = line.substr(0, line.find('#'));
+
+		std::istringstream fields(line);
+		Time::Seconds time;
+		if(!(fields >> time)) {
+			// Permit lines that are empty other than whitespace.
+			std::string remainder;
+			fields.clear();
+			if(fields >> remainder) {
+				error_ = "Line " + std::to_string(line_number) + ": expected a time";
+				break;
+			}
+			continue;
+		}
+
+		std::string type;
+		fields >> type;
+
+		bool is_valid = false;
+		if(type == "key") {
+			std::string name, state;
+			Key key;
+			bool is_pressed;
+			if(fields >> name >> state && parse_key(name, key) && parse_state(state, is_pressed)) {
+				events_.push_back(InputEvent::key_event(time, key, 0, is_pressed));
+				is_valid = true;
+			}
+		} else if(type == "joystick") {
+			size_t index;
+			std::string name, state;
+			Inputs::Joystick::Input::Type input;
+			bool is_active;
+			if(fields >> index >> name >> state && parse_joystick_input(name, input) && parse_state(state, is_active)) {
+				events_.push_back(InputEvent::joystick_event(time, index, Inputs::Joystick::Input(input), is_active));
+				is_valid = true;
+			}
+		} else if(type == "mouse-move") {
+			int x, y;
+			if(fields >> x >> y) {
+				events_.push_back(InputEvent::mouse_motion_event(time, x, y));
+				is_valid = true;
+			}
+		} else if(type == "mouse-button") {
+			int index;
+			std::string state;
+			bool is_pressed;
+			if(fields >> index >> state && parse_state(state, is_pressed)) {
+				events_.push_back(InputEvent::mouse_button_event(time, index, is_pressed));
+				is_valid = true;
+			}
+		}
+
+		// Reject trailing fields too.
+		std::string remainder;
+		if(!is_valid || fields >> remainder || time < 0.0) {
+			error_ = "Line " + std::to_string(line_number) + ": could not parse '" + line + "'";
+			break;
+		}
+	}
+
+	if(!error_.empty()) {
+		events_.clear();
+		return;
+	}
+
+	// Sort by time, retaining the listed order of simultaneous events.
+	std::stable_sort(events_.begin(), events_.end(), [](const InputEvent &lhs, const InputEvent &rhs) {
+		return lhs.offset < rhs.offset;
+	});
+}
+
+std::vector<MachineTypes::InputEvent> InputScript::next(Time::Seconds duration) {
+	const auto end = time_ + duration;
+
+	std::vector<MachineTypes::InputEvent> result;
+	while(next_ < events_.size() && events_[next_].offset < end) {
+		result.push_back(events_[next_]);
+		result.back().offset = std::max(0.0, result.back().offset - time_);
+		++next_;
+	}
+
+	time_ = end;
+	return result;
+}
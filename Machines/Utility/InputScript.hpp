@@ -0,0 +1,66 @@
+//
+//  InputScript.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef InputScript_hpp
+#define InputScript_hpp
+
+#include "../InputEvent.hpp"
+#include "../../ClockReceiver/TimeTypes.hpp"
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace Machine {
+
+/*!
+	Holds a list of input events, each timed relative to the start of a run, and doles them out
+	in batches suitable for TimedMachine::run_for(Time::Seconds, const std::vector<InputEvent> &).
+
+	Scripts are text, one event per line, in any of the forms:
+
+		<seconds> key <name> down|up
+		<seconds> joystick <index> fire|up|down|left|right down|up
+		<seconds> mouse-move <x> <y>
+		<seconds> mouse-button <index> down|up
+
+	Key names are those of Inputs::Keyboard::Key, e.g. @c A, @c k1, @c Enter or @c LeftShift.
+	Blank lines and anything following a @c # are ignored. Events need not be listed in time order.
+*/
+class InputScript {
+	public:
+		/// Parses a script from @c source; if any line is malformed then @c error() will describe it
+		/// and the script will be empty.
+		InputScript(std::istream &source);
+
+		/// @returns A description of the first malformed line, or an empty string if there was none.
+		const std::string &error() const {
+			return error_;
+		}
+
+		/// @returns @c true if every event has been returned by @c next.
+		bool empty() const {
+			return next_ == events_.size();
+		}
+
+		/*!
+			@returns All events that fall within the next @c duration seconds, with offsets relative
+			to the start of that period, and advances the script's current time by @c duration.
+		*/
+		std::vector<MachineTypes::InputEvent> next(Time::Seconds duration);
+
+	private:
+		std::vector<MachineTypes::InputEvent> events_;
+		std::size_t next_ = 0;
+		Time::Seconds time_ = 0.0;
+		std::string error_;
+};
+
+}
+
+#endif /* InputScript_hpp */
@@ -45,6 +45,10 @@
 #include "../../Analyser/Static/ZX8081/Target.hpp"
 #include "../../Analyser/Static/ZXSpectrum/Target.hpp"
 
+// Sources for state.
+#include "../MSX/State.hpp"
+#include "../Sinclair/ZXSpectrum/State.hpp"
+
 #include "../../Analyser/Dynamic/MultiMachine/MultiMachine.hpp"
 #include "TypedDynamicMachine.hpp"
 
@@ -92,7 +96,7 @@ Machine::DynamicMachine *Machine::MachineForTarget(const Analyser::Static::Targe
 	return machine;
 }
 
-Machine::DynamicMachine *Machine::MachineForTargets(const Analyser::Static::TargetList &targets, const ROMMachine::ROMFetcher &rom_fetcher, Error &error) {
+Machine::DynamicMachine *Machine::MachineForTargets(const Analyser::Static::TargetList &targets, const ROMMachine::ROMFetcher &rom_fetcher, Error &error, const Analyser::Dynamic::MultiMachineEvaluationPolicy &policy) {
 	// Zero targets implies no machine.
 	if(targets.empty()) {
 		error = Error::NoTargets;
@@ -113,10 +117,10 @@ Machine::DynamicMachine *Machine::MachineForTargets(const Analyser::Static::Targ
 
 		// If a multimachine would just instantly collapse the list to a single machine, do
 		// so without the ongoing baggage of a multimachine.
-		if(Analyser::Dynamic::MultiMachine::would_collapse(machines)) {
+		if(Analyser::Dynamic::MultiMachine::would_collapse(machines, policy)) {
 			return machines.front().release();
 		} else {
-			return new Analyser::Dynamic::MultiMachine(std::move(machines));
+			return new Analyser::Dynamic::MultiMachine(std::move(machines), policy);
 		}
 	}
 
@@ -208,8 +212,10 @@ std::map<std::string, std::unique_ptr<Reflection::Struct>> Machine::AllOptionsBy
 #define Emplace(machine, class)	\
 	options.emplace(std::make_pair(LongNameForTargetMachine(Analyser::Machine::machine), std::make_unique<class::Options>(Configurable::OptionsType::UserFriendly)));
 
+	Emplace(Amiga, Amiga::Machine);
 	Emplace(AmstradCPC, AmstradCPC::Machine);
 	Emplace(AppleII, Apple::II::Machine);
+	Emplace(AppleIIgs, Apple::IIgs::Machine);
 	Emplace(AtariST, Atari::ST::Machine);
 	Emplace(ColecoVision, Coleco::Vision::Machine);
 	Emplace(Electron, Electron::Machine);
@@ -259,3 +265,11 @@ std::map<std::string, std::unique_ptr<Analyser::Static::Target>> Machine::Target
 
 	return options;
 }
+
+std::unique_ptr<Reflection::Struct> Machine::StateForMachine(Analyser::Machine machine) {
+	switch(machine) {
+		case Analyser::Machine::MSX:		return std::make_unique<MSX::State>();
+		case Analyser::Machine::ZXSpectrum:	return std::make_unique<Sinclair::ZXSpectrum::State>();
+		default:							return nullptr;
+	}
+}
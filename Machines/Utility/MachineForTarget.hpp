@@ -9,6 +9,7 @@
 #ifndef MachineForTarget_hpp
 #define MachineForTarget_hpp
 
+#include "../../Analyser/Dynamic/MultiMachine/MultiMachine.hpp"
 #include "../../Analyser/Static/StaticAnalyser.hpp"
 #include "../../Reflection/Struct.hpp"
 
@@ -44,8 +45,11 @@ enum class Error {
 	Allocates an instance of DynamicMachine holding a machine that can
 	receive the supplied static analyser result. The machine has been allocated
 	on the heap. It is the caller's responsibility to delete the class when finished.
+
+	If there is more than one target then the result may be a MultiMachine, which will
+	pick between them as per @c policy.
 */
-DynamicMachine *MachineForTargets(const Analyser::Static::TargetList &targets, const ::ROMMachine::ROMFetcher &rom_fetcher, Error &error);
+DynamicMachine *MachineForTargets(const Analyser::Static::TargetList &targets, const ::ROMMachine::ROMFetcher &rom_fetcher, Error &error, const Analyser::Dynamic::MultiMachineEvaluationPolicy &policy = {});
 
 /*!
 	Allocates an instance of DynamicMaachine holding the machine described
@@ -93,6 +97,12 @@ std::map<std::string, std::unique_ptr<Reflection::Struct>> AllOptionsByMachineNa
 */
 std::map<std::string, std::unique_ptr<Analyser::Static::Target>> TargetsByMachineName(bool meaningful_without_media_only);
 
+/*!
+	Returns an empty instance of the state that @c machine accepts via Analyser::Static::Target::state,
+	suitable for deserialising into, or @c nullptr if that machine doesn't accept state.
+*/
+std::unique_ptr<Reflection::Struct> StateForMachine(Analyser::Machine machine);
+
 }
 
 #endif /* MachineForTarget_hpp */
@@ -0,0 +1,39 @@
+//
+//  MediaLoader.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "MediaLoader.hpp"
+
+using namespace Machine;
+
+void MediaLoader::load(const std::string &file_name) {
+	queue_.enqueue([this, file_name] {
+		Loaded loaded{file_name, Analyser::Static::GetMedia(file_name)};
+
+		// Obtain the first track of each side, as a machine is most likely to seek
+		// there immediately upon insertion.
+		for(const auto &disk: loaded.media.disks) {
+			for(int head = 0; head < disk->get_head_count(); head++) {
+				disk->get_track_at_position(Storage::Disk::Track::Address(head, Storage::Disk::HeadPosition(0)));
+			}
+		}
+
+		std::lock_guard lock(loaded_mutex_);
+		loaded_.push_back(std::move(loaded));
+	});
+}
+
+std::vector<MediaLoader::Loaded> MediaLoader::take_loaded() {
+	std::vector<Loaded> loaded;
+	std::lock_guard lock(loaded_mutex_);
+	std::swap(loaded, loaded_);
+	return loaded;
+}
+
+void MediaLoader::flush() {
+	queue_.flush();
+}
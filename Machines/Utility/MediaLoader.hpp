@@ -0,0 +1,56 @@
+//
+//  MediaLoader.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef MediaLoader_hpp
+#define MediaLoader_hpp
+
+#include "../../Analyser/Static/StaticAnalyser.hpp"
+#include "../../Concurrency/AsyncTaskQueue.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Machine {
+
+/*!
+	Identifies and constructs media on a worker thread, so that a host can hot-swap media without
+	stalling whichever thread runs its machine; the host collects loaded media at a time of its
+	choosing and passes it to MediaTarget::insert_media as usual.
+
+	Beyond construction, only the first track of each side of any disk is obtained in advance. The
+	remainder are left to be fetched and cached as the machine needs them, subject to any memory budget.
+*/
+class MediaLoader {
+	public:
+		/// Begins loading the media in @c file_name.
+		void load(const std::string &file_name);
+
+		struct Loaded {
+			std::string file_name;
+			Analyser::Static::Media media;
+		};
+
+		/// @returns Everything that has finished loading since the last call, in the order requested.
+		/// Files that contain no recognisable media are included, with empty @c media.
+		std::vector<Loaded> take_loaded();
+
+		/// Blocks until all outstanding loads are complete.
+		void flush();
+
+	private:
+		std::mutex loaded_mutex_;
+		std::vector<Loaded> loaded_;
+
+		// Declared last so that it is destroyed, and its thread joined, first.
+		Concurrency::AsyncTaskQueue<true> queue_;
+};
+
+}
+
+#endif /* MediaLoader_hpp */
@@ -0,0 +1,53 @@
+//
+//  MemoryAccount.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef MemoryAccount_hpp
+#define MemoryAccount_hpp
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Utility {
+
+/*!
+	Accumulates a list of named subsystems and the number of bytes each currently holds,
+	as supplied by a MemoryAccountant.
+*/
+class MemoryAccount {
+	public:
+		void add(const std::string &subsystem, size_t bytes) {
+			subsystems_.emplace_back(subsystem, bytes);
+		}
+
+		/// @returns All subsystems added since the last call to @c reset(), in the order they were added.
+		const std::vector<std::pair<std::string, size_t>> &subsystems() const {
+			return subsystems_;
+		}
+
+		/// @returns The sum of all sizes added since the last call to @c reset().
+		size_t total() const {
+			size_t result = 0;
+			for(const auto &subsystem: subsystems_) {
+				result += subsystem.second;
+			}
+			return result;
+		}
+
+		void reset() {
+			subsystems_.clear();
+		}
+
+	private:
+		std::vector<std::pair<std::string, size_t>> subsystems_;
+};
+
+}
+
+#endif /* MemoryAccount_hpp */
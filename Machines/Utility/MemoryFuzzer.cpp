@@ -9,17 +9,33 @@
 #include "MemoryFuzzer.hpp"
 
 #include <cstdlib>
+#include <cstring>
 
 void Memory::Fuzz(uint8_t *buffer, std::size_t size) {
-	const unsigned int divider = (unsigned(RAND_MAX) + 1) / 256;
-	unsigned int shift = 1, value = 1;
-	while(value < divider) {
-		value <<= 1;
-		++shift;
+	// Seed an xorshift64* generator from rand(), so that any srand by the host remains
+	// meaningful, then fill eight bytes at a time.
+	uint64_t state = 0x9e3779b97f4a7c15;
+	for(int c = 0; c < 4; c++) {
+		state = (state << 16) ^ uint64_t(std::rand());
 	}
+	if(!state) state = 1;
 
-	for(size_t c = 0; c < size; c++) {
-		buffer[c] = uint8_t(std::rand() >> shift);
+	const auto next = [&state] {
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return state * 0x2545f4914f6cdd1d;
+	};
+
+	std::size_t c = 0;
+	for(; c + sizeof(uint64_t) <= size; c += sizeof(uint64_t)) {
+		const uint64_t value = next();
+		std::memcpy(&buffer[c], &value, sizeof(value));
+	}
+
+	if(c < size) {
+		const uint64_t value = next();
+		std::memcpy(&buffer[c], &value, size - c);
 	}
 }
 
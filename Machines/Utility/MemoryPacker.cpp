@@ -9,10 +9,28 @@
 #include "MemoryPacker.hpp"
 
 #include <cstddef>
+#include <cstring>
 
 void Memory::PackBigEndian16(const std::vector<uint8_t> &source, uint16_t *target) {
-	for(size_t c = 0; c < source.size(); c += 2) {
-		target[c >> 1] = uint16_t(source[c] << 8) | uint16_t(source[c+1]);
+	// A big-endian host needs only a copy.
+	const uint16_t test_value = 0x0001;
+	if(*reinterpret_cast<const uint8_t *>(&test_value) != 0x01) {
+		std::memcpy(target, source.data(), source.size() & ~size_t(1));
+		return;
+	}
+
+	// Otherwise swap the bytes within each 16-bit lane, eight bytes at a time.
+	const uint8_t *const data = source.data();
+	size_t c = 0;
+	for(; c + sizeof(uint64_t) <= source.size(); c += sizeof(uint64_t)) {
+		uint64_t value;
+		std::memcpy(&value, &data[c], sizeof(value));
+		value = ((value & 0x00ff'00ff'00ff'00ff) << 8) | ((value >> 8) & 0x00ff'00ff'00ff'00ff);
+		std::memcpy(&target[c >> 1], &value, sizeof(value));
+	}
+
+	for(; c + 1 < source.size(); c += 2) {
+		target[c >> 1] = uint16_t(data[c] << 8) | uint16_t(data[c+1]);
 	}
 }
 
@@ -0,0 +1,87 @@
+//
+//  StateHasher.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "StateHasher.hpp"
+
+#include <algorithm>
+
+using namespace Utility;
+
+namespace {
+
+/// Combines a page's hash with its index, so that identical pages at different addresses contribute differently.
+uint64_t page_contribution(size_t index, uint64_t hash) {
+	uint64_t result = hash ^ (uint64_t(index) * 0x9e3779b97f4a7c15);
+	result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9;
+	result = (result ^ (result >> 27)) * 0x94d049bb133111eb;
+	return result ^ (result >> 31);
+}
+
+}
+
+// MARK: - PagedMemoryHasher.
+
+PagedMemoryHasher::PagedMemoryHasher(const uint8_t *memory, size_t size) :
+	memory_(memory),
+	size_(size),
+	dirty_((size + PageSize - 1) >> PageShift, 1),
+	page_hashes_(dirty_.size(), 0) {
+	for(size_t c = 0; c < page_hashes_.size(); c++) {
+		total_ += page_contribution(c, 0);
+	}
+}
+
+void PagedMemoryHasher::invalidate() {
+	std::fill(dirty_.begin(), dirty_.end(), 1);
+}
+
+uint64_t PagedMemoryHasher::hash() {
+	for(size_t c = 0; c < dirty_.size(); c++) {
+		if(!dirty_[c]) continue;
+		dirty_[c] = 0;
+
+		const size_t start = c << PageShift;
+		const uint64_t page_hash = StateHasher::hash(&memory_[start], std::min(PageSize, size_ - start));
+
+		total_ -= page_contribution(c, page_hashes_[c]);
+		page_hashes_[c] = page_hash;
+		total_ += page_contribution(c, page_hash);
+	}
+	return total_;
+}
+
+// MARK: - StateHasher.
+
+StateHasher::Hash StateHasher::hash(const void *data, size_t size, Hash seed) {
+	// FNV-1a.
+	auto bytes = static_cast<const uint8_t *>(data);
+	Hash result = seed;
+	while(size--) {
+		result ^= *bytes;
+		result *= 0x100000001b3;
+		++bytes;
+	}
+	return result;
+}
+
+void StateHasher::add(const std::string &component, Hash hash) {
+	components_.emplace_back(component, hash);
+}
+
+void StateHasher::add(const std::string &component, const void *data, size_t size) {
+	add(component, hash(data, size));
+}
+
+void StateHasher::add(const std::string &component, const Reflection::Struct &state) {
+	const auto serialised = state.serialise();
+	add(component, serialised.data(), serialised.size());
+}
+
+void StateHasher::add(const std::string &component, PagedMemoryHasher &memory) {
+	add(component, memory.hash());
+}
@@ -0,0 +1,93 @@
+//
+//  StateHasher.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef StateHasher_hpp
+#define StateHasher_hpp
+
+#include "../../Reflection/Struct.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Utility {
+
+/*!
+	Hashes a block of memory in 256-byte pages, rehashing only those pages that have been
+	marked as dirty since the last call to @c hash().
+
+	Owners should mark pages dirty on every write; the cheapest way to do so is usually to keep
+	a pointer into @c dirty_flags() alongside each write pointer and to set
+	`dirty[address >> PageShift] = 1` as part of every write.
+*/
+class PagedMemoryHasher {
+	public:
+		static constexpr int PageShift = 8;
+		static constexpr size_t PageSize = 1 << PageShift;
+
+		/// Constructs a hasher for the @c size bytes at @c memory; all pages start dirty.
+		PagedMemoryHasher(const uint8_t *memory, size_t size);
+
+		/// Indicates that the byte at @c offset may have changed.
+		void mark_dirty(size_t offset) {
+			dirty_[offset >> PageShift] = 1;
+		}
+
+		/// Provides one flag per page; any non-zero value marks that page as dirty.
+		uint8_t *dirty_flags() {
+			return dirty_.data();
+		}
+
+		/// Marks every page as dirty, e.g. following a bulk copy into memory.
+		void invalidate();
+
+		/// @returns A hash of the entire block of memory.
+		uint64_t hash();
+
+	private:
+		const uint8_t *const memory_;
+		const size_t size_;
+
+		std::vector<uint8_t> dirty_;
+		std::vector<uint64_t> page_hashes_;
+		uint64_t total_ = 0;
+};
+
+/*!
+	Accumulates a list of named component hashes, as supplied by a StateHashProducer.
+*/
+class StateHasher {
+	public:
+		using Hash = uint64_t;
+
+		/// @returns A hash of @c size bytes at @c data.
+		static Hash hash(const void *data, size_t size, Hash seed = 0xcbf29ce484222325);
+
+		void add(const std::string &component, Hash hash);
+		void add(const std::string &component, const void *data, size_t size);
+		void add(const std::string &component, const Reflection::Struct &state);
+		void add(const std::string &component, PagedMemoryHasher &memory);
+
+		/// @returns All hashes added since the last call to @c reset(), in the order they were added.
+		const std::vector<std::pair<std::string, Hash>> &components() const {
+			return components_;
+		}
+
+		void reset() {
+			components_.clear();
+		}
+
+	private:
+		std::vector<std::pair<std::string, Hash>> components_;
+};
+
+}
+
+#endif /* StateHasher_hpp */
@@ -0,0 +1,85 @@
+//
+//  6526Tests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Components/6526/6526.hpp"
+
+#include <random>
+
+namespace {
+
+using CIA = MOS::MOS6526::MOS6526<MOS::MOS6526::PortHandler, MOS::MOS6526::Personality::P8250>;
+
+}
+
+@interface MOS6526Tests : XCTestCase
+@end
+
+@implementation MOS6526Tests
+
+/// Checks that the interrupt output never becomes active before the time indicated by get_next_sequence_point,
+/// for a variety of timer configurations.
+- (void)testSequencePointIsLowerBound {
+	std::mt19937 random(0x6526);
+	MOS::MOS6526::PortHandler handler;
+
+	for(int configuration = 0; configuration < 200; configuration++) {
+		CIA cia(handler);
+
+		cia.write(4, uint8_t(random() % 40));
+		cia.write(5, 0);
+		cia.write(6, uint8_t(random() % 40));
+		cia.write(7, 0);
+		cia.write(13, uint8_t(0x80 | (1 + random() % 3)));
+
+		// Start both timers, each possibly one-shot, with B possibly counting A's underflows;
+		// A is kept running if B counts it so that B is sure eventually to underflow.
+		const auto control_b = uint8_t(0x01 | (random() & 0x48));
+		const auto control_a = uint8_t(0x01 | ((control_b & 0x40) ? 0x00 : (random() & 0x08)));
+		cia.write(14, control_a);
+		cia.write(15, control_b);
+
+		int interrupts = 0;
+		for(int step = 0; step < 400; step++) {
+			if(cia.get_interrupt_line()) {
+				++interrupts;
+				cia.read(13);
+			}
+
+			const HalfCycles next = cia.get_next_sequence_point();
+			if(next == HalfCycles::max()) break;
+
+			if(next > HalfCycles(1)) {
+				cia.run_for(next - HalfCycles(1));
+				XCTAssertFalse(cia.get_interrupt_line(), @"Interrupt before sequence point in configuration %d", configuration);
+			}
+			cia.run_for(HalfCycles(1));
+		}
+
+		// Something should have happened, one-shot or otherwise.
+		XCTAssertGreaterThan(interrupts, 0, @"No interrupts in configuration %d", configuration);
+	}
+}
+
+/// Checks that a stopped CIA, or one with timer interrupts disabled, reports no sequence point.
+- (void)testNoSequencePoint {
+	MOS::MOS6526::PortHandler handler;
+	CIA cia(handler);
+	XCTAssertEqual(cia.get_next_sequence_point(), HalfCycles::max());
+
+	cia.write(4, 10);
+	cia.write(5, 0);
+	cia.write(14, 0x01);
+	XCTAssertEqual(cia.get_next_sequence_point(), HalfCycles::max());
+
+	cia.write(13, 0x81);
+	XCTAssertNotEqual(cia.get_next_sequence_point(), HalfCycles::max());
+}
+
+@end
@@ -0,0 +1,116 @@
+//
+//  6560Tests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Components/6560/6560.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Provides 16kb of video memory and 1kb of colour memory, counting bulk fetches.
+struct VideoMemory {
+	uint8_t pixel_memory[0x4000];
+	uint8_t colour_memory[0x0400];
+	int bulk_reads = 0;
+
+	void perform_read(uint16_t address, uint8_t *pixel_data, uint8_t *colour_data) {
+		*pixel_data = pixel_memory[address & 0x3fff];
+		*colour_data = colour_memory[address & 0x03ff];
+	}
+
+	void perform_reads(uint16_t address, int count, uint8_t *pixel_data, uint8_t *colour_data) {
+		++bulk_reads;
+		for(int c = 0; c < count; c++) {
+			perform_read(uint16_t(address + c), &pixel_data[c], &colour_data[c]);
+		}
+	}
+};
+
+/// Records every scan and every sample posted by a CRT.
+struct RecordingScanTarget: public Outputs::Display::ScanTarget {
+	std::vector<uint16_t> scans;
+	std::vector<uint8_t> samples;
+
+	void set_modals(Modals) final {}
+	Scan *begin_scan() final { return &scan_; }
+	void end_scan() final {
+		for(const auto &end_point: scan_.end_points) {
+			scans.push_back(end_point.x);
+			scans.push_back(end_point.y);
+			scans.push_back(end_point.data_offset);
+			scans.push_back(end_point.cycles_since_end_of_horizontal_retrace);
+		}
+	}
+	uint8_t *begin_data(size_t required_length, size_t) final {
+		data_.assign(required_length * 2, 0);
+		return data_.data();
+	}
+	void end_data(size_t actual_length) final {
+		// The 6560 produces Luminance8Phase8 samples, i.e. two bytes apiece.
+		samples.insert(samples.end(), data_.begin(), data_.begin() + ptrdiff_t(actual_length * 2));
+	}
+
+	private:
+		Scan scan_;
+		std::vector<uint8_t> data_;
+};
+
+using VIC = MOS::MOS6560::MOS6560<VideoMemory>;
+
+}
+
+@interface MOS6560Tests : XCTestCase
+@end
+
+@implementation MOS6560Tests
+
+/// Runs one 6560 in large steps, so that whole lines are run in bulk, and another a cycle at a time,
+/// applying the same register writes to each at the same times, and checks that their output is identical.
+- (void)testBulkLinesMatchCycleStepping {
+	std::mt19937 random(0x6560);
+
+	VideoMemory bulk_memory, stepped_memory;
+	for(auto &byte: bulk_memory.pixel_memory) byte = uint8_t(random());
+	for(auto &byte: bulk_memory.colour_memory) byte = uint8_t(random());
+	std::copy(std::begin(bulk_memory.pixel_memory), std::end(bulk_memory.pixel_memory), stepped_memory.pixel_memory);
+	std::copy(std::begin(bulk_memory.colour_memory), std::end(bulk_memory.colour_memory), stepped_memory.colour_memory);
+
+	for(const auto mode: {MOS::MOS6560::OutputMode::PAL, MOS::MOS6560::OutputMode::NTSC}) {
+		VIC bulk(bulk_memory), stepped(stepped_memory);
+		RecordingScanTarget bulk_target, stepped_target;
+		bulk.set_scan_target(&bulk_target);
+		stepped.set_scan_target(&stepped_target);
+		bulk.set_output_mode(mode);
+		stepped.set_output_mode(mode);
+
+		for(int write = 0; write < 200; write++) {
+			const int cycles = 1 + int(random() % 40'000);
+			bulk.run_for(Cycles(cycles));
+			for(int c = 0; c < cycles; c++) {
+				stepped.run_for(Cycles(1));
+			}
+
+			const int address = int(random() & 0xf);
+			const auto value = uint8_t(random());
+			bulk.write(address, value);
+			stepped.write(address, value);
+		}
+
+		XCTAssertGreaterThan(bulk_memory.bulk_reads, 0);
+		XCTAssertEqual(stepped_memory.bulk_reads, 0);
+		XCTAssert(bulk_target.scans == stepped_target.scans);
+		XCTAssert(bulk_target.samples == stepped_target.samples);
+		XCTAssertGreaterThan(bulk_target.samples.size(), 0);
+	}
+}
+
+@end
@@ -0,0 +1,184 @@
+//
+//  ADBBusTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/Apple/ADB/Bus.hpp"
+#include "../../../Machines/Apple/ADB/Keyboard.hpp"
+#include "../../../Machines/Apple/ADB/Mouse.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// The outcome of a single command: whether any device signalled a service request, and any response.
+struct Transaction {
+	bool service_request = false;
+	std::vector<uint8_t> response;
+
+	bool operator ==(const Transaction &rhs) const {
+		return service_request == rhs.service_request && response == rhs.response;
+	}
+};
+
+/// A bit-level ADB host attached to a keyboard and a mouse, sampling the bus every microsecond
+/// much as the IIgs' microcontroller does.
+struct Host {
+	Host(bool relay) : bus(HalfCycles(1'000'000)), id(bus.add_device()), keyboard(bus), mouse(bus) {
+		bus.set_relays_transactions(relay);
+	}
+
+	Transaction perform(uint8_t command, const std::vector<uint8_t> &listen_data = {}) {
+		// Attention, sync, command and stop bit.
+		drive(800, 70);
+		for(int c = 7; c >= 0; c--) {
+			send((command >> c) & 1);
+		}
+		send(0);
+
+		// Listen data, if any: a start bit, the data and a stop bit.
+		if(!listen_data.empty()) {
+			observe(200);
+			send(1);
+			for(const auto byte: listen_data) {
+				for(int c = 7; c >= 0; c--) {
+					send((byte >> c) & 1);
+				}
+			}
+			send(0);
+		}
+
+		// Collect the duration of each low period that follows, then decode.
+		const auto lows = observe(3000);
+		Transaction transaction;
+		auto low = lows.begin();
+		if(low != lows.end() && *low > 200) {
+			transaction.service_request = true;
+			++low;
+		}
+
+		// Skip the start bit and omit the stop bit.
+		if(low != lows.end()) ++low;
+		for(int bit = 0; low + 1 < lows.end(); ++low, ++bit) {
+			if(!(bit & 7)) transaction.response.push_back(0);
+			transaction.response.back() = uint8_t((transaction.response.back() << 1) | (*low < 50));
+		}
+		return transaction;
+	}
+
+	Apple::ADB::Bus bus;
+	const size_t id;
+	Apple::ADB::Keyboard keyboard;
+	Apple::ADB::Mouse mouse;
+
+	private:
+		void send(int bit) {
+			drive(bit ? 35 : 65, bit ? 65 : 35);
+		}
+
+		void drive(int low, int high) {
+			bus.set_device_output(id, false);
+			observe(low);
+			bus.set_device_output(id, true);
+			observe(high);
+		}
+
+		std::vector<int> observe(int microseconds) {
+			std::vector<int> lows;
+			int low_time = 0;
+			for(int c = 0; c < microseconds; c++) {
+				bus.run_for(HalfCycles(1));
+				if(!bus.get_state()) {
+					++low_time;
+				} else if(low_time) {
+					lows.push_back(low_time);
+					low_time = 0;
+				}
+			}
+			return lows;
+		}
+};
+
+/// Performs the same sequence of commands with and without transaction relaying, returning the
+/// results of each in that order.
+template <typename SequenceT> std::pair<std::vector<Transaction>, std::vector<Transaction>> perform(SequenceT sequence) {
+	Host bit_level(false), relayed(true);
+	return std::make_pair(sequence(bit_level), sequence(relayed));
+}
+
+}
+
+@interface ADBBusTests : XCTestCase
+@end
+
+@implementation ADBBusTests
+
+- (void)testTalkRegister3 {
+	const auto [bit_level, relayed] = perform([] (Host &host) {
+		return std::vector<Transaction>{host.perform(0x2f)};
+	});
+
+	XCTAssert(bit_level == relayed);
+	XCTAssertFalse(relayed[0].service_request);
+	XCTAssert(relayed[0].response == std::vector<uint8_t>({0x62, 0x01}));
+}
+
+- (void)testServiceRequest {
+	const auto [bit_level, relayed] = perform([] (Host &host) {
+		host.keyboard.set_key_pressed(Apple::ADB::Key::k1, true);
+		return std::vector<Transaction>{
+			host.perform(0x3c),		// Talk to the mouse; the keyboard should request service.
+			host.perform(0x2c),		// Talk to the keyboard, collecting the key press.
+			host.perform(0x3c),		// Talk to the mouse again; no request should now be pending.
+		};
+	});
+
+	XCTAssert(bit_level == relayed);
+	XCTAssertTrue(relayed[0].service_request);
+	XCTAssert(relayed[1].response == std::vector<uint8_t>({0x12, 0x80}));
+	XCTAssertFalse(relayed[2].service_request);
+}
+
+/// Checks that the bus reports activity while the line is low or a relayed response is being signalled,
+/// and reports a device that is seeking service.
+- (void)testActivity {
+	Host host(true);
+	XCTAssertFalse(host.bus.is_active());
+	XCTAssertFalse(host.bus.has_pending_service_request());
+
+	host.bus.set_device_output(host.id, false);
+	XCTAssertTrue(host.bus.is_active());
+	host.bus.set_device_output(host.id, true);
+	XCTAssertFalse(host.bus.is_active());
+
+	host.keyboard.set_key_pressed(Apple::ADB::Key::k1, true);
+	XCTAssertTrue(host.bus.has_pending_service_request());
+
+	// Collect the key press; the response is signalled by the bus over the following few milliseconds.
+	const auto transaction = host.perform(0x2c);
+	XCTAssert(transaction.response == std::vector<uint8_t>({0x12, 0x80}));
+	XCTAssertFalse(host.bus.is_active());
+	XCTAssertFalse(host.bus.has_pending_service_request());
+}
+
+- (void)testListenRegister3 {
+	const auto [bit_level, relayed] = perform([] (Host &host) {
+		return std::vector<Transaction>{
+			host.perform(0x2b, {0x65, 0x01}),	// Move the keyboard to address 5.
+			host.perform(0x2f),					// Talk to address 2; nothing should respond.
+			host.perform(0x5f),					// Talk to address 5.
+		};
+	});
+
+	XCTAssert(bit_level == relayed);
+	XCTAssert(relayed[1].response.empty());
+	XCTAssert(relayed[2].response == std::vector<uint8_t>({0x65, 0x01}));
+}
+
+@end
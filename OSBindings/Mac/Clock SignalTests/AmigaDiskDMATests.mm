@@ -0,0 +1,151 @@
+//
+//  AmigaDiskDMATests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/Amiga/Chipset.hpp"
+#include "../../../Storage/Disk/DiskImage/Formats/AmigaADF.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int ClockRate = 7'093'790;
+constexpr int HalfCyclesPerSecond = ClockRate * 2;
+
+constexpr uint32_t BufferAddress = 0x1'0000;
+constexpr uint16_t ReadLength = 0x1800;
+
+/// A chipset with a single disk drive, driven as the CPU would via its registers.
+struct DiskDMAHarness {
+	DiskDMAHarness(const std::string &adf, bool fast_reads) :
+		memory(Amiga::MemoryMap::ChipRAM::FiveHundredAndTwelveKilobytes, Amiga::MemoryMap::FastRAM::None),
+		chipset(memory, ClockRate)
+	{
+		chipset.set_fast_disk_reads_enabled(fast_reads);
+		chipset.insert({std::make_shared<Storage::Disk::DiskImageHolder<Storage::Disk::AmigaADF>>(adf)});
+
+		// Select DF0 with its motor on: deselect all, set /MTR, then select DF0 to latch it.
+		chipset.cia_b.write(1, 0xff);
+		chipset.cia_b.write(3, 0xff);
+		chipset.cia_b.write(1, 0x7f);
+		chipset.cia_b.write(1, 0x77);
+
+		write(0x096, 0x8210);		// DMACON: enable DMA and disk DMA.
+		write(0x09e, 0x7f00);		// ADKCON: clear all disk bits...
+		write(0x09e, 0x9500);		// ... then select MFM, word sync and 2µs bits.
+		write(0x07e, 0x4489);		// DSKSYNC.
+	}
+
+	void write(uint32_t address, uint16_t value) {
+		CPU::SlicedInt16 data;
+		data.w = value;
+
+		CPU::MC68000::Microcycle cycle;
+		cycle.operation = CPU::MC68000::Microcycle::SelectWord;
+		cycle.address = &address;
+		cycle.value = &data;
+		chipset.perform(cycle);
+	}
+
+	uint16_t read(uint32_t address) {
+		CPU::SlicedInt16 data;
+
+		CPU::MC68000::Microcycle cycle;
+		cycle.operation = CPU::MC68000::Microcycle::SelectWord | CPU::MC68000::Microcycle::Read;
+		cycle.address = &address;
+		cycle.value = &data;
+		chipset.perform(cycle);
+		return data.w;
+	}
+
+	/// Arms a sync-word read into chip RAM, and runs until it completes or @c limit half cycles have passed.
+	/// @returns The number of half cycles until DSKBLK was signalled, or -1 if it wasn't.
+	int read_track(int limit) {
+		write(0x09c, 0x0002);		// Clear DSKBLK.
+		write(0x020, uint16_t(BufferAddress >> 16));
+		write(0x022, uint16_t(BufferAddress));
+		write(0x024, 0x8000 | ReadLength);
+		write(0x024, 0x8000 | ReadLength);
+
+		constexpr int step = 16;
+		for(int time = 0; time < limit; time += step) {
+			chipset.run_for(HalfCycles(step));
+			if(read(0x01e) & 0x0002) {
+				write(0x024, 0x4000);
+				return time + step;
+			}
+		}
+		write(0x024, 0x4000);
+		return -1;
+	}
+
+	Amiga::MemoryMap memory;
+	Amiga::Chipset chipset;
+};
+
+}
+
+@interface AmigaDiskDMATests : XCTestCase
+@end
+
+@implementation AmigaDiskDMATests
+
+/// Performs the same series of sync-word reads, from a variety of starting rotations, with and
+/// without fast disk reads, and checks that chip RAM receives the same words, and that DSKBLK
+/// is signalled at the same time, in both cases.
+- (void)testFastReadsMatchBitByBit {
+	// Build an ADF of pseudo-random content.
+	const auto adf = (std::filesystem::temp_directory_path() / "AmigaDiskDMATests.adf").string();
+	{
+		std::mt19937 random(0xadf);
+		std::ofstream file(adf, std::ios::binary);
+		for(int c = 0; c < 80 * 2 * 11 * 512; c++) {
+			file.put(char(random()));
+		}
+	}
+
+	DiskDMAHarness fast(adf, true), slow(adf, false);
+
+	std::mt19937 random(0x1234);
+	for(int read = 0; read < 8; read++) {
+		// Advance both to a new starting rotation.
+		const auto delay = HalfCycles(int(random() % unsigned(HalfCyclesPerSecond / 5)));
+		fast.chipset.run_for(delay);
+		slow.chipset.run_for(delay);
+
+		// A read can take up to a revolution to find a sync word, and nearly another to complete;
+		// run both for the same fixed period regardless of when they finish.
+		constexpr int limit = HalfCyclesPerSecond / 2;
+		const int fast_time = fast.read_track(limit);
+		const int slow_time = slow.read_track(limit);
+		XCTAssertNotEqual(fast_time, -1, @"Fast read %d didn't complete", read);
+		XCTAssertNotEqual(slow_time, -1, @"Bit-by-bit read %d didn't complete", read);
+		fast.chipset.run_for(HalfCycles(limit - (fast_time < 0 ? limit : fast_time)));
+		slow.chipset.run_for(HalfCycles(limit - (slow_time < 0 ? limit : slow_time)));
+
+		XCTAssertEqual(fast_time, slow_time, @"Read %d completed at different times", read);
+
+		const auto fast_words = reinterpret_cast<const uint16_t *>(&fast.memory.chip_ram[BufferAddress]);
+		const auto slow_words = reinterpret_cast<const uint16_t *>(&slow.memory.chip_ram[BufferAddress]);
+		int differences = 0;
+		for(int c = 0; c < ReadLength; c++) {
+			differences += fast_words[c] != slow_words[c];
+		}
+		XCTAssertEqual(differences, 0, @"Read %d differs", read);
+	}
+
+	std::remove(adf.c_str());
+}
+
+@end
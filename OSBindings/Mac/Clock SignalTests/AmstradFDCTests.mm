@@ -0,0 +1,148 @@
+//
+//  AmstradFDCTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/AmstradCPC/FDC.hpp"
+#include "../../../Storage/Disk/DiskImage/DiskImage.hpp"
+#include "../../../Storage/Disk/Encodings/MFM/Encoder.hpp"
+
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/// @returns The byte expected at @c offset within sector @c sector of track @c track.
+uint8_t sector_byte(int track, int sector, int offset) {
+	return uint8_t(track * 9 + sector + offset * 3);
+}
+
+/// Provides forty single-sided tracks, each in the CPC data format: nine 512-byte sectors with IDs 0xc1–0xc9.
+struct DataFormatImage: public Storage::Disk::DiskImage {
+	Storage::Disk::HeadPosition get_maximum_head_position() final {
+		return Storage::Disk::HeadPosition(40);
+	}
+
+	std::shared_ptr<Storage::Disk::Track> get_track_at_position(Storage::Disk::Track::Address address) final {
+		const int track = address.position.as_int();
+		std::vector<Storage::Encodings::MFM::Sector> sectors(9);
+		for(int c = 0; c < 9; c++) {
+			auto &sector = sectors[size_t(c)];
+			sector.address.track = uint8_t(track);
+			sector.address.sector = uint8_t(0xc1 + c);
+			sector.size = 2;
+
+			sector.samples.emplace_back(512);
+			for(int offset = 0; offset < 512; offset++) {
+				sector.samples.back()[size_t(offset)] = sector_byte(track, 0xc1 + c, offset);
+			}
+		}
+		return Storage::Encodings::MFM::GetMFMTrackWithSectors(sectors);
+	}
+};
+
+/// Runs @c fdc in the same 2µs steps as skip_mechanical_delays until its main status, masked by @c mask, is @c value.
+/// @returns The number of cycles that took.
+int run_until(Amstrad::FDC &fdc, uint8_t mask, uint8_t value) {
+	int cycles = 0;
+	while((fdc.read(0) & mask) != value && cycles < 16'000'000) {
+		fdc.run_for(Cycles(16));
+		cycles += 16;
+	}
+	return cycles;
+}
+
+/// Writes @c command to @c fdc as the CPC would, with or without quick loading.
+void write_command(Amstrad::FDC &fdc, std::initializer_list<uint8_t> command, bool skip_delays) {
+	for(const auto byte: command) {
+		run_until(fdc, 0xc0, 0x80);
+		fdc.write(1, byte);
+	}
+	if(skip_delays) fdc.skip_mechanical_delays();
+}
+
+/// @returns An FDC with the data-format disk inserted and up to speed.
+std::unique_ptr<Amstrad::FDC> fdc() {
+	auto fdc = std::make_unique<Amstrad::FDC>();
+	fdc->set_disk(std::make_shared<Storage::Disk::DiskImageHolder<DataFormatImage>>(), 0);
+	fdc->set_motor_on(true);
+	fdc->run_for(Cycles(8'000'000));
+	return fdc;
+}
+
+}
+
+@interface AmstradFDCTests : XCTestCase
+@end
+
+@implementation AmstradFDCTests
+
+/// Checks that a seek is complete as soon as commanded if delays are skipped, but not otherwise.
+- (void)testSeek {
+	for(const bool skip: {false, true}) {
+		const auto controller = fdc();
+
+		write_command(*controller, {0x0f, 0x00, 20}, skip);	// SEEK to track 20.
+		XCTAssertNotEqual(controller->is_seeking(), skip);
+		if(!skip) {
+			while(controller->is_seeking()) controller->run_for(Cycles(16));
+		}
+
+		write_command(*controller, {0x08}, skip);	// SENSE INTERRUPT STATUS.
+		run_until(*controller, 0xc0, 0xc0);
+		XCTAssertEqual(controller->read(1) & 0xf8, 0x20, @"Seek end expected; skipping: %d", skip);
+		XCTAssertEqual(controller->read(1), 20, @"Skipping: %d", skip);
+	}
+}
+
+/// Checks that a sector is available as soon as a read is commanded if delays are skipped, and that
+/// it then reads correctly.
+- (void)testReadData {
+	for(const bool skip: {false, true}) {
+		const auto controller = fdc();
+
+		write_command(*controller, {0x0f, 0x00, 7}, skip);		// SEEK to track 7.
+		while(controller->is_seeking()) controller->run_for(Cycles(16));
+		write_command(*controller, {0x08}, skip);				// SENSE INTERRUPT STATUS.
+		run_until(*controller, 0xc0, 0xc0);
+		controller->read(1);
+		controller->read(1);
+
+		// READ DATA, for sector 0xc5 only.
+		write_command(*controller, {0x46, 0x00, 7, 0, 0xc5, 2, 0xc5, 0x2a, 0xff}, skip);
+		const int latency = run_until(*controller, 0xe0, 0xe0);
+		if(skip) {
+			XCTAssertEqual(latency, 0);
+		} else {
+			XCTAssertGreaterThan(latency, 0);
+		}
+
+		// Read the sector at full speed.
+		int offset = 0;
+		bool all_matched = true;
+		while(true) {
+			run_until(*controller, 0x80, 0x80);
+			if(!(controller->read(0) & 0x20)) break;
+			all_matched &= controller->read(1) == sector_byte(7, 0xc5, offset);
+			++offset;
+		}
+		XCTAssertEqual(offset, 512, @"Skipping: %d", skip);
+		XCTAssert(all_matched, @"Skipping: %d", skip);
+
+		// Check for no overrun or data errors.
+		const uint8_t st0 = controller->read(1);
+		const uint8_t st1 = controller->read(1);
+		const uint8_t st2 = controller->read(1);
+		XCTAssertEqual(st0 & 0x07, 0);
+		XCTAssertEqual(st1 & 0x35, 0, @"Skipping: %d", skip);
+		XCTAssertEqual(st2 & 0x61, 0, @"Skipping: %d", skip);
+	}
+}
+
+@end
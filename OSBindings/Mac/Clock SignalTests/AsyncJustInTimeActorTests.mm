@@ -0,0 +1,90 @@
+//
+//  AsyncJustInTimeActorTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../ClockReceiver/JustInTime.hpp"
+#include "../../../Machines/Utility/StateHasher.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Records every period of time supplied to it and every input received, with the time
+/// at which it was received.
+struct Recorder {
+	void run_for(Cycles duration) {
+		time += duration.as_integral();
+		log.push_back(uint64_t(duration.as_integral()));
+	}
+
+	void input(uint64_t value) {
+		log.push_back((value << 32) | time);
+	}
+
+	uint64_t time = 0;
+	std::vector<uint64_t> log;
+};
+
+/// As per Recorder, but also with a sequence point every 97 cycles.
+struct SequencedRecorder: public Recorder {
+	Cycles get_next_sequence_point() const {
+		return Cycles(97 - Cycles::IntType(time % 97));
+	}
+};
+
+/// Applies the same pseudo-random sequence of time, input and access to an actor, returning a
+/// hash of the resulting log.
+template <typename RecorderT> Utility::StateHasher::Hash exercise(bool is_asynchronous) {
+	AsyncJustInTimeActor<RecorderT, HalfCycles, 1, 2> actor(HalfCycles(64));
+	actor.set_is_asynchronous(is_asynchronous);
+
+	std::mt19937 random(0x1234);
+	for(int c = 0; c < 100'000; c++) {
+		const auto choice = random() % 32;
+		switch(choice) {
+			default:
+				actor += HalfCycles(int(random() % 24));
+			break;
+			case 0: case 1: case 2: {
+				const auto value = random();
+				actor.perform([value] (RecorderT &recorder) {
+					recorder.input(value);
+				});
+			} break;
+			case 3:
+				actor->input(choice);
+			break;
+			case 4:
+				actor.flush();
+			break;
+		}
+	}
+
+	actor.flush();
+	return Utility::StateHasher::hash(actor.last_valid()->log.data(), actor.last_valid()->log.size() * sizeof(uint64_t));
+}
+
+}
+
+@interface AsyncJustInTimeActorTests : XCTestCase
+@end
+
+@implementation AsyncJustInTimeActorTests
+
+- (void)testUnsequenced {
+	XCTAssertEqual(exercise<Recorder>(true), exercise<Recorder>(false));
+}
+
+- (void)testSequenced {
+	XCTAssertEqual(exercise<SequencedRecorder>(true), exercise<SequencedRecorder>(false));
+}
+
+@end
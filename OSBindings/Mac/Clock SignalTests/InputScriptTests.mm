@@ -0,0 +1,175 @@
+//
+//  InputScriptTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/MachineTypes.hpp"
+#include "../../../Machines/Utility/InputScript.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+/// A keyboard that records the cycle at which each key changes state.
+struct RecordingKeyboard: public Inputs::Keyboard {
+	RecordingKeyboard(const int &cycle) : cycle_(cycle) {}
+
+	bool set_key_pressed(Key key, char, bool is_pressed) final {
+		changes.emplace_back(cycle_, key, is_pressed);
+		return true;
+	}
+
+	std::vector<std::tuple<int, Key, bool>> changes;
+
+	private:
+		const int &cycle_;
+};
+
+/// A machine with a 1000Hz clock and a keyboard.
+struct KeyboardCounter: public MachineTypes::TimedMachine, public MachineTypes::KeyboardMachine {
+	KeyboardCounter() {
+		set_clock_rate(1000.0);
+	}
+
+	Inputs::Keyboard &get_keyboard() final {
+		return keyboard;
+	}
+
+	void run_for(const Cycles cycles) final {
+		cycle += cycles.as<int>();
+	}
+	using MachineTypes::TimedMachine::run_for;
+
+	int cycle = 0;
+	RecordingKeyboard keyboard{cycle};
+};
+
+Machine::InputScript script(const char *text) {
+	std::istringstream stream(text);
+	return Machine::InputScript(stream);
+}
+
+}
+
+@interface InputScriptTests : XCTestCase
+@end
+
+@implementation InputScriptTests
+
+- (void)testParsing {
+	using Type = MachineTypes::InputEvent::Type;
+
+	auto events = script(
+		"# Comment.\n"
+		"0.5 mouse-move 3 -4\n"
+		"\n"
+		"0.25 key LeftShift down	# Trailing comment.\n"
+		"0.5 joystick 1 fire down\n"
+		"  1 mouse-button 2 up\n"
+	);
+	XCTAssert(events.error().empty());
+
+	const auto all = events.next(2.0);
+	XCTAssert(events.empty());
+	XCTAssertEqual(all.size(), 4);
+
+	// Events should be sorted by time, with simultaneous events in the listed order.
+	XCTAssert(all[0].type == Type::Key);
+	XCTAssertEqual(all[0].offset, 0.25);
+	XCTAssert(all[0].key == Inputs::Keyboard::Key::LeftShift);
+	XCTAssert(all[0].is_active);
+
+	XCTAssert(all[1].type == Type::MouseMotion);
+	XCTAssertEqual(all[1].x, 3);
+	XCTAssertEqual(all[1].y, -4);
+
+	XCTAssert(all[2].type == Type::JoystickDigital);
+	XCTAssertEqual(all[2].index, 1);
+	XCTAssert(all[2].input() == Inputs::Joystick::Input(Inputs::Joystick::Input::Fire));
+
+	XCTAssert(all[3].type == Type::MouseButton);
+	XCTAssertEqual(all[3].offset, 1.0);
+	XCTAssertEqual(all[3].index, 2);
+	XCTAssertFalse(all[3].is_active);
+}
+
+- (void)testErrors {
+	for(const char *text: {
+		"key A down\n",
+		"0.1 key Nonsense down\n",
+		"0.1 key A sideways\n",
+		"0.1 key A down extra\n",
+		"0.1 joystick 0 jump down\n",
+		"0.1 mouse-move 1\n",
+		"-1 key A down\n",
+		"0.1 paddle 0 0.5\n",
+	}) {
+		auto events = script(text);
+		XCTAssertFalse(events.error().empty(), @"%s", text);
+		XCTAssert(events.empty(), @"%s", text);
+	}
+}
+
+- (void)testBatches {
+	auto events = script(
+		"0.01 key A down\n"
+		"0.02 key A up\n"
+		"0.05 key B down\n"
+	);
+
+	// The first period should contain both A events, relative to its start.
+	auto batch = events.next(0.03);
+	XCTAssertEqual(batch.size(), 2);
+	XCTAssertEqualWithAccuracy(batch[0].offset, 0.01, 1e-9);
+	XCTAssertEqualWithAccuracy(batch[1].offset, 0.02, 1e-9);
+
+	// The second should be empty; the third should contain the B event, relative to 0.04.
+	XCTAssertEqual(events.next(0.01).size(), 0);
+	batch = events.next(0.1);
+	XCTAssertEqual(batch.size(), 1);
+	XCTAssertEqualWithAccuracy(batch[0].offset, 0.01, 1e-9);
+	XCTAssert(events.empty());
+}
+
+/// Checks that TimedMachine's batch run_for applies each event at the proper cycle.
+- (void)testRunFor {
+	using Key = Inputs::Keyboard::Key;
+
+	auto events = script(
+		"0.010 key A down\n"
+		"0.020 key A up\n"
+		"0.035 key B down\n"
+		"0.895 key B up\n"
+	);
+	KeyboardCounter machine;
+	for(int c = 0; c < 50; c++) {
+		machine.run_for(0.02, events.next(0.02));
+	}
+	XCTAssert(events.empty());
+	XCTAssertEqualWithAccuracy(machine.cycle, 1000, 1);
+
+	// Conversion to whole cycles may place each event up to a cycle early.
+	const std::vector<std::tuple<int, Key, bool>> expected = {
+		{10, Key::A, true},
+		{20, Key::A, false},
+		{35, Key::B, true},
+		{895, Key::B, false},
+	};
+	XCTAssertEqual(machine.keyboard.changes.size(), expected.size());
+	for(size_t c = 0; c < std::min(expected.size(), machine.keyboard.changes.size()); c++) {
+		const auto &[cycle, key, is_pressed] = machine.keyboard.changes[c];
+		XCTAssertEqualWithAccuracy(cycle, std::get<0>(expected[c]), 1, @"Event %zu", c);
+		XCTAssert(key == std::get<1>(expected[c]), @"Event %zu", c);
+		XCTAssertEqual(is_pressed, std::get<2>(expected[c]), @"Event %zu", c);
+	}
+}
+
+@end
@@ -0,0 +1,130 @@
+//
+//  LowpassSpeakerTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
+#include "../../../Outputs/Speaker/Implementation/SampleSource.hpp"
+#include "../../../SignalProcessing/FIRFilter.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Produces pseudo-random samples, each held for @c period samples, while declaring a possibly-different period.
+struct HeldSource: public Outputs::Speaker::SampleSource {
+	HeldSource(std::size_t period, std::size_t declared_period) : period_(period), declared_period_(declared_period) {}
+
+	void get_samples(std::size_t number_of_samples, std::int16_t *target) {
+		while(number_of_samples--) {
+			if(!(position_ % period_)) {
+				value_ = int16_t(int(random_() % 16384) - 8192);
+			}
+			*target++ = value_;
+			++position_;
+		}
+	}
+
+	std::size_t get_sample_period() const {
+		return declared_period_;
+	}
+
+	private:
+		std::size_t period_, declared_period_;
+		std::size_t position_ = 0;
+		int16_t value_ = 0;
+		std::mt19937 random_{0xfeed};
+};
+
+/// Retains everything a speaker outputs.
+struct Recorder: public Outputs::Speaker::Speaker::Delegate {
+	std::vector<int16_t> samples;
+
+	void speaker_did_complete_samples(Outputs::Speaker::Speaker *, const std::vector<int16_t> &buffer) final {
+		samples.insert(samples.end(), buffer.begin(), buffer.end());
+	}
+};
+
+/// Runs a speaker with @c source for @c total_cycles, in irregular steps, and returns its output.
+std::vector<int16_t> filter(HeldSource &source, float input_rate, std::size_t total_cycles) {
+	Outputs::Speaker::PullLowpass<HeldSource> speaker(source);
+	Concurrency::AsyncTaskQueue<false> queue;
+	Recorder recorder;
+
+	speaker.set_input_rate(input_rate);
+	speaker.set_output_rate(44'100.0f, 256, false);
+	speaker.set_delegate(&recorder);
+
+	std::mt19937 random(0x5eed);
+	while(total_cycles) {
+		const auto step = std::min(total_cycles, std::size_t(1 + random() % 5'000));
+		speaker.run_for(queue, Cycles(int(step)));
+		total_cycles -= step;
+	}
+	queue.flush();
+
+	return recorder.samples;
+}
+
+}
+
+@interface LowpassSpeakerTests : XCTestCase
+@end
+
+@implementation LowpassSpeakerTests
+
+/// Checks that each decimated version of a filter, applied to the final sample of each run of
+/// held input, gives exactly the same result as the full filter.
+- (void)testDecimatedFilterMatchesFull {
+	const SignalProcessing::FIRFilter full(121, 1'789'772.0f, 0.0f, 22'050.0f);
+	std::mt19937 random(0xf1f);
+
+	for(const std::size_t period: {2, 3, 4, 16}) {
+		for(std::size_t phase = 0; phase < period; phase++) {
+			const auto decimated = full.decimated(period, phase);
+			XCTAssertEqual(decimated.get_number_of_taps(), (full.get_number_of_taps() + phase + period - 1) / period);
+
+			// Build input in which the filter's first sample falls at offset phase into a run.
+			std::vector<short> input(phase + full.get_number_of_taps() + period);
+			short value = 0;
+			for(std::size_t c = 0; c < input.size(); c++) {
+				if(!(c % period)) value = short(int(random() % 16384) - 8192);
+				input[c] = value;
+			}
+
+			XCTAssertEqual(
+				full.apply(&input[phase]),
+				decimated.apply(&input[period - 1], period),
+				@"Period %zu, phase %zu", period, phase);
+		}
+	}
+}
+
+/// Checks that a speaker produces the same output for a source that declares its period of repetition
+/// as for one that doesn't, and that the number of samples produced tracks the exact rate ratio.
+- (void)testDeclaredPeriodMatchesUndeclared {
+	for(const std::size_t period: {4, 16}) {
+		constexpr float input_rate = 1'789'772.0f;
+		constexpr std::size_t total_cycles = 1'789'772 * 3;
+
+		HeldSource declared(period, period), undeclared(period, 1);
+		const auto declared_output = filter(declared, input_rate, total_cycles);
+		const auto undeclared_output = filter(undeclared, input_rate, total_cycles);
+
+		XCTAssertGreaterThan(declared_output.size(), 0);
+		XCTAssert(declared_output == undeclared_output, @"Period %zu", period);
+
+		// Output arrives in buffers of 256 and lags by up to a filter window; allow for both.
+		const auto expected = double(total_cycles) * 44'100.0 / double(input_rate);
+		XCTAssertLessThanOrEqual(std::abs(double(declared_output.size()) - expected), 256.0 + 64.0, @"Period %zu", period);
+	}
+}
+
+@end
@@ -10,6 +10,9 @@
 
 #include "9918.hpp"
 
+#include <utility>
+#include <vector>
+
 @interface MasterSystemVDPTests : XCTestCase
 @end
 
@@ -164,4 +167,52 @@ using VDP = TI::TMS::TMS9918<TI::TMS::Personality::SMSVDP>;
 	}
 }
 
+/// Records the retrace events and pixel data requests posted by a CRT.
+struct RecordingScanTarget: public Outputs::Display::ScanTarget {
+	std::vector<std::pair<Event, bool>> events;
+	int data_requests = 0;
+
+	void set_modals(Modals) final {}
+	Scan *begin_scan() final { return &scan_; }
+	uint8_t *begin_data(size_t required_length, size_t) final {
+		++data_requests;
+		data_.resize(required_length * 4);
+		return data_.data();
+	}
+	void announce(Event event, bool is_visible, const Scan::EndPoint &, uint8_t) final {
+		events.emplace_back(event, is_visible);
+	}
+
+	private:
+		Scan scan_;
+		std::vector<uint8_t> data_;
+};
+
+- (void)testFrameSkip {
+	const auto record = [] (int frame_skip) {
+		VDP vdp;
+		RecordingScanTarget target;
+		vdp.set_scan_target(&target);
+		vdp.set_frame_skip(frame_skip);
+
+		// Enable the display.
+		vdp.write(1, 0x40);
+		vdp.write(1, 0x81);
+
+		for(int c = 0; c < 262*228*2*10; c += 1000) {
+			vdp.run_for(HalfCycles(1000));
+		}
+		return target;
+	};
+
+	const auto all_frames = record(0);
+	const auto alternate_frames = record(1);
+
+	// Skipped frames should still carry sync, so the CRT should see exactly the same sequence of
+	// retrace events, but pixel data should be requested for only around half as many lines.
+	XCTAssert(all_frames.events == alternate_frames.events);
+	XCTAssertGreaterThan(alternate_frames.data_requests, 0);
+	XCTAssertLessThan(alternate_frames.data_requests, (all_frames.data_requests * 6) / 10);
+}
+
 @end
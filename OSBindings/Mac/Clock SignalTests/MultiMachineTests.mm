@@ -0,0 +1,129 @@
+//
+//  MultiMachineTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Analyser/Dynamic/MultiMachine/MultiMachine.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+/// Counts the scan targets that stub machines still hold as they are destroyed.
+int attached_at_destruction = 0;
+
+/// A machine with a fixed confidence that does nothing other than hold a scan target.
+struct StubMachine:
+	public ::Machine::DynamicMachine,
+	public MachineTypes::TimedMachine,
+	public MachineTypes::ScanProducer,
+	public MachineTypes::AudioProducer {
+
+	StubMachine(float confidence) : confidence_(confidence) {
+		set_clock_rate(1000.0);
+	}
+	~StubMachine() {
+		if(scan_target) ++attached_at_destruction;
+	}
+
+	// TimedMachine.
+	void run_for(const Cycles) final {}
+	using MachineTypes::TimedMachine::run_for;
+	float get_confidence() final { return confidence_; }
+
+	// ScanProducer.
+	void set_scan_target(Outputs::Display::ScanTarget *target) final { scan_target = target; }
+	Outputs::Display::ScanTarget *scan_target = nullptr;
+
+	// AudioProducer.
+	Outputs::Speaker::Speaker *get_speaker() final { return nullptr; }
+
+	// DynamicMachine.
+	Activity::Source *activity_source() final { return nullptr; }
+	Configurable::Device *configurable_device() final { return nullptr; }
+	MachineTypes::TimedMachine *timed_machine() final { return this; }
+	MachineTypes::ScanProducer *scan_producer() final { return this; }
+	MachineTypes::AudioProducer *audio_producer() final { return this; }
+	MachineTypes::JoystickMachine *joystick_machine() final { return nullptr; }
+	MachineTypes::KeyboardMachine *keyboard_machine() final { return nullptr; }
+	MachineTypes::MouseMachine *mouse_machine() final { return nullptr; }
+	MachineTypes::MediaTarget *media_target() final { return nullptr; }
+	MachineTypes::StateHashProducer *state_hash_producer() final { return nullptr; }
+	MachineTypes::StateProducer *state_producer() final { return nullptr; }
+	MachineTypes::MemoryAccountant *memory_accountant() final { return nullptr; }
+	void *raw_pointer() final { return this; }
+
+	private:
+		float confidence_;
+};
+
+/// @returns Three stub machines, with confidences @c first, @c second and @c third.
+std::vector<std::unique_ptr<::Machine::DynamicMachine>> machines(float first, float second, float third) {
+	std::vector<std::unique_ptr<::Machine::DynamicMachine>> result;
+	result.emplace_back(new StubMachine(first));
+	result.emplace_back(new StubMachine(second));
+	result.emplace_back(new StubMachine(third));
+	return result;
+}
+
+}
+
+@interface MultiMachineTests : XCTestCase
+@end
+
+@implementation MultiMachineTests
+
+/// Checks that machines are detached from the scan target before being discarded.
+- (void)testDiscardDetachesScanTarget {
+	Outputs::Display::NullScanTarget scan_target;
+
+	{
+		attached_at_destruction = 0;
+
+		// The first machine should be discarded at the first checkpoint; the other two are too close to pick between.
+		Analyser::Dynamic::MultiMachine multi(machines(0.005f, 0.5f, 0.4f));
+		multi.scan_producer()->set_scan_target(&scan_target);
+
+		multi.timed_machine()->run_for(0.01);
+		XCTAssertEqual(attached_at_destruction, 0);
+		XCTAssertEqual(multi.timed_machine()->get_confidence(), 0.5f);
+	}
+
+	{
+		attached_at_destruction = 0;
+
+		// The first machine is decisive, so the other two should be discarded immediately.
+		Analyser::Dynamic::MultiMachine multi(machines(0.95f, 0.5f, 0.4f));
+		multi.scan_producer()->set_scan_target(&scan_target);
+
+		multi.timed_machine()->run_for(0.01);
+		XCTAssertEqual(attached_at_destruction, 0);
+		XCTAssertEqual(multi.timed_machine()->get_confidence(), 0.95f);
+	}
+}
+
+/// Checks that the evaluation policy supplied at construction is honoured.
+- (void)testPolicy {
+	Analyser::Dynamic::MultiMachineEvaluationPolicy policy;
+	policy.checkpoint_interval = 0.125;
+	policy.required_checkpoints = 3;
+
+	// 0.8 is at least twice 0.3, so is decisive; with the default policy that would mean picking
+	// at the first run_for, but here three checkpoints, 0.125 seconds apart, are required.
+	Analyser::Dynamic::MultiMachine multi(machines(0.3f, 0.8f, 0.2f), policy);
+	for(int c = 0; c < 23; c++) {
+		multi.timed_machine()->run_for(1.0 / 64.0);
+		XCTAssertNotEqual(multi.timed_machine()->get_confidence(), 0.8f, @"Picked after %d steps", c + 1);
+	}
+
+	multi.timed_machine()->run_for(1.0 / 64.0);
+	XCTAssertEqual(multi.timed_machine()->get_confidence(), 0.8f);
+}
+
+@end
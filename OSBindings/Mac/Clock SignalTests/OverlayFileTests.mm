@@ -0,0 +1,82 @@
+//
+//  OverlayFileTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Storage/MassStorage/OverlayFile.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t BlockSize = 512;
+
+/// @returns A block of @c BlockSize bytes, each of which is @c value.
+std::vector<uint8_t> block(uint8_t value) {
+	return std::vector<uint8_t>(BlockSize, value);
+}
+
+/// @returns A path within the temporary directory for the file @c name.
+std::string temporary_path(const char *name) {
+	return std::string(NSTemporaryDirectory().UTF8String) + name;
+}
+
+}
+
+@interface OverlayFileTests : XCTestCase
+@end
+
+@implementation OverlayFileTests
+
+/// Checks that blocks written to widely-separated addresses are retained, both in the current
+/// session and once reopened, without the index growing with the highest address.
+- (void)testSparseAddresses {
+	const auto base_name = temporary_path("OverlayFileTests-base");
+	const auto overlay_name = temporary_path("OverlayFileTests-overlay");
+	std::remove(overlay_name.c_str());
+
+	FILE *const base = std::fopen(base_name.c_str(), "wb");
+	const auto base_contents = block(0xaa);
+	std::fwrite(base_contents.data(), 1, base_contents.size(), base);
+	std::fclose(base);
+
+	const std::vector<size_t> addresses = {0, 7, 0x12345, 0xffff'fff0};
+
+	{
+		Storage::MassStorage::OverlayFile file(base_name, overlay_name, BlockSize, 4);
+		for(size_t c = 0; c < addresses.size(); c++) {
+			file.set_block(addresses[c], block(uint8_t(c + 1)));
+		}
+		file.set_block(7, block(0x77));
+
+		// Allow for the four cached blocks, but nothing proportional to the largest address.
+		XCTAssertLessThan(file.get_memory_usage(), 4 * BlockSize + 4096);
+	}
+
+	Storage::MassStorage::OverlayFile file(base_name, overlay_name, BlockSize, 4);
+	std::vector<uint8_t> contents;
+	for(size_t c = 0; c < addresses.size(); c++) {
+		XCTAssert(file.get_block(addresses[c], contents), @"Block %zx", addresses[c]);
+		XCTAssert(contents == block(addresses[c] == 7 ? 0x77 : uint8_t(c + 1)), @"Block %zx", addresses[c]);
+	}
+
+	contents.clear();
+	XCTAssertFalse(file.get_block(1, contents));
+	XCTAssertFalse(file.get_block(0xffff'ffff, contents));
+	XCTAssert(contents.empty());
+
+	XCTAssertEqual(file.base_size(), long(BlockSize));
+	XCTAssert(file.read_base(0, BlockSize) == block(0xaa));
+
+	std::remove(base_name.c_str());
+	std::remove(overlay_name.c_str());
+}
+
+@end
@@ -87,4 +87,25 @@
 	XCTAssert(next_event_duration >= 0.0 && next_event_duration < 0.005, "Next event should occur soon");
 }
 
+- (void)testMemoryUsageOfSharedSegments
+{
+	Storage::Disk::PCMSegment segment;
+	segment.data.resize(8000);
+	Storage::Disk::PCMTrack track(segment);
+
+	Storage::Disk::MemoryUsage usage;
+	track.add_memory_usage(usage);
+	XCTAssertEqual(usage.total(), 1000);
+
+	// A clone shares its segments with the original, so shouldn't be counted twice.
+	std::unique_ptr<Storage::Disk::Track> clone(track.clone());
+	clone->add_memory_usage(usage);
+	XCTAssertEqual(usage.total(), 1000);
+
+	// A separately constructed track has its own storage.
+	Storage::Disk::PCMTrack other(segment);
+	other.add_memory_usage(usage);
+	XCTAssertEqual(usage.total(), 2000);
+}
+
 @end
@@ -0,0 +1,148 @@
+//
+//  ReflectionTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Reflection/Enum.hpp"
+#include "../../../Reflection/Struct.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+ReflectableEnum(Colour, Red, Green, Blue);
+
+struct Options: public Reflection::StructImpl<Options> {
+	int count = 0;
+	uint8_t small = 0;
+	bool flag = false;
+	double rate = 0.0;
+	Colour colour = Colour::Red;
+
+	Options() {
+		if(needs_declare()) {
+			DeclareField(count);
+			DeclareField(small);
+			DeclareField(flag);
+			DeclareField(rate);
+			AnnounceEnum(Colour);
+			DeclareField(colour);
+		}
+	}
+};
+
+struct Snapshot: public Reflection::StructImpl<Snapshot> {
+	Colour colour = Colour::Red;
+	Colour palette[3] = {Colour::Red, Colour::Red, Colour::Red};
+	std::vector<uint8_t> ram;
+	uint8_t registers[4]{};
+	uint16_t address = 0;
+	uint32_t counter = 0;
+	int32_t offset = 0;
+	int64_t position = 0;
+	bool flag = false;
+
+	Snapshot() {
+		if(needs_declare()) {
+			AnnounceEnum(Colour);
+			DeclareField(colour);
+			DeclareField(palette);
+			DeclareField(ram);
+			DeclareField(registers);
+			DeclareField(address);
+			DeclareField(counter);
+			DeclareField(offset);
+			DeclareField(position);
+			DeclareField(flag);
+		}
+	}
+};
+
+}
+
+@interface ReflectionTests : XCTestCase
+@end
+
+@implementation ReflectionTests
+
+- (void)testFuzzySetInt {
+	Options options;
+
+	XCTAssertTrue(Reflection::fuzzy_set(options, "count", "3"));
+	XCTAssertEqual(options.count, 3);
+	XCTAssertTrue(Reflection::fuzzy_set(options, "count", "-12"));
+	XCTAssertEqual(options.count, -12);
+	XCTAssertTrue(Reflection::fuzzy_set(options, "small", "0x40"));
+	XCTAssertEqual(options.small, 0x40);
+
+	XCTAssertFalse(Reflection::fuzzy_set(options, "count", "3x"));
+	XCTAssertFalse(Reflection::fuzzy_set(options, "count", ""));
+	XCTAssertEqual(options.count, -12);
+}
+
+- (void)testFuzzySetBool {
+	Options options;
+
+	XCTAssertTrue(Reflection::fuzzy_set(options, "flag", "yes"));
+	XCTAssertTrue(options.flag);
+	XCTAssertTrue(Reflection::fuzzy_set(options, "flag", "False"));
+	XCTAssertFalse(options.flag);
+	XCTAssertTrue(Reflection::fuzzy_set(options, "flag", "1"));
+	XCTAssertTrue(options.flag);
+
+	XCTAssertFalse(Reflection::fuzzy_set(options, "flag", "maybe"));
+	XCTAssertTrue(options.flag);
+}
+
+- (void)testFuzzySetOther {
+	Options options;
+
+	XCTAssertTrue(Reflection::fuzzy_set(options, "rate", "1.5"));
+	XCTAssertEqual(options.rate, 1.5);
+
+	XCTAssertTrue(Reflection::fuzzy_set(options, "colour", "blue"));
+	XCTAssertEqual(options.colour, Colour::Blue);
+
+	XCTAssertFalse(Reflection::fuzzy_set(options, "missing", "1"));
+}
+
+/// Checks that enums, binary data and integers of every sign and size survive serialisation.
+- (void)testRoundTrip {
+	Snapshot source;
+	source.colour = Colour::Blue;
+	source.palette[1] = Colour::Green;
+	source.palette[2] = Colour::Blue;
+	source.ram = {0x00, 0x01, 0x80, 0xff, 0x7f};
+	source.registers[0] = 0x80;
+	source.registers[3] = 0xff;
+	source.address = 0x80ff;
+	source.counter = 0x8000'80ff;
+	source.offset = -0x7f80;
+	source.position = -0x1'0000'8000;
+	source.flag = true;
+
+	Snapshot destination;
+	XCTAssertTrue(destination.deserialise(source.serialise()));
+
+	XCTAssertEqual(destination.colour, Colour::Blue);
+	XCTAssertEqual(destination.palette[0], Colour::Red);
+	XCTAssertEqual(destination.palette[1], Colour::Green);
+	XCTAssertEqual(destination.palette[2], Colour::Blue);
+	XCTAssert(destination.ram == source.ram);
+	XCTAssertEqual(destination.registers[0], 0x80);
+	XCTAssertEqual(destination.registers[1], 0x00);
+	XCTAssertEqual(destination.registers[3], 0xff);
+	XCTAssertEqual(destination.address, 0x80ff);
+	XCTAssertEqual(destination.counter, 0x8000'80ff);
+	XCTAssertEqual(destination.offset, -0x7f80);
+	XCTAssertEqual(destination.position, -0x1'0000'8000);
+	XCTAssertTrue(destination.flag);
+}
+
+@end
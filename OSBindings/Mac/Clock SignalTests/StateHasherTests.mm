@@ -0,0 +1,271 @@
+//
+//  StateHasherTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/AmstradCPC/AmstradCPC.hpp"
+#include "../../../Machines/MSX/MSX.hpp"
+#include "../../../Machines/MSX/State.hpp"
+#include "../../../Machines/Sinclair/ZX8081/ZX8081.hpp"
+#include "../../../Machines/Sinclair/ZXSpectrum/ZXSpectrum.hpp"
+#include "../../../Machines/Utility/Divergence.hpp"
+#include "../../../Machines/Utility/StateHasher.hpp"
+#include "../../../Machines/Utility/TypedDynamicMachine.hpp"
+#include "../../../Analyser/Static/AmstradCPC/Target.hpp"
+#include "../../../Analyser/Static/MSX/Target.hpp"
+#include "../../../Analyser/Static/ZX8081/Target.hpp"
+#include "../../../Analyser/Static/ZXSpectrum/Target.hpp"
+#include "../../../Storage/Disk/DiskImage/DiskImage.hpp"
+#include "../../../Storage/Disk/Encodings/MFM/Encoder.hpp"
+#include "CSROMFetcher.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// @returns A 48kb Spectrum; rand() is seeded first so that all begin with the same fuzzed RAM.
+std::unique_ptr<Machine::DynamicMachine> spectrum() {
+	std::srand(1);
+
+	Analyser::Static::ZXSpectrum::Target target;
+	target.model = Analyser::Static::ZXSpectrum::Target::Model::FortyEightK;
+
+	try {
+		return std::make_unique<Machine::TypedDynamicMachine<Sinclair::ZXSpectrum::Machine>>(
+			Sinclair::ZXSpectrum::Machine::ZXSpectrum(&target, CSROMFetcher()));
+	} catch(...) {
+		return nullptr;
+	}
+}
+
+/// @returns A ROM fetcher that supplies @c program as the contents of every ROM requested.
+ROMMachine::ROMFetcher synthetic_roms(const std::vector<uint8_t> &program) {
+	return [program] (const ROM::Request &request) {
+		ROM::Map roms;
+		for(const auto &description: request.all_descriptions()) {
+			roms[description.name] = program;
+		}
+		return roms;
+	};
+}
+
+/// Increments every byte from 0x8000 upwards, wrapping around, while also sending each to the MSX's VDP.
+const std::vector<uint8_t> msx_program = {
+	0x3e, 0xf0,			// LD A, 0xf0
+	0xd3, 0xa8,			// OUT (0xa8), A	; Page slot 3 into 0x8000–0xffff.
+	0xaf,				// XOR A
+	0xd3, 0x99,			// OUT (0x99), A
+	0x3e, 0x40,			// LD A, 0x40
+	0xd3, 0x99,			// OUT (0x99), A	; Write to VRAM from address 0.
+	0x21, 0x00, 0x80,	// LD HL, 0x8000
+	0x34,				// loop: INC (HL)
+	0x7e,				// LD A, (HL)
+	0xd3, 0x98,			// OUT (0x98), A
+	0x23,				// INC HL
+	0x18, 0xf9,			// JR loop
+};
+
+/// Selects the MSX's second disk drive, turns its motor on, selects side 1 and seeks to track 5, waiting
+/// for that to complete; then increments every byte from 0x8000 upwards, wrapping back to 0x8000.
+const std::vector<uint8_t> msx_disk_program = {
+	0x3e, 0xf8,			// LD A, 0xf8
+	0xd3, 0xa8,			// OUT (0xa8), A	; Page the disk cartridge into 0x4000–0x7fff, RAM above.
+	0x3e, 0x81,			// LD A, 0x81
+	0x32, 0xfd, 0x7f,	// LD (0x7ffd), A	; Drive 1, motor on.
+	0x3e, 0x01,			// LD A, 0x01
+	0x32, 0xfc, 0x7f,	// LD (0x7ffc), A	; Side 1.
+	0x3e, 0x05,			// LD A, 0x05
+	0x32, 0xfb, 0x7f,	// LD (0x7ffb), A	; Data register = 5.
+	0x3e, 0x18,			// LD A, 0x18
+	0x32, 0xf8, 0x7f,	// LD (0x7ff8), A	; SEEK, loading the head.
+	0x3a, 0xf8, 0x7f,	// wait: LD A, (0x7ff8)
+	0x0f,				// RRCA
+	0x38, 0xfa,			// JR C, wait	; Until the seek is complete.
+	0x21, 0x00, 0x80,	// LD HL, 0x8000
+	0x34,				// loop: INC (HL)
+	0x23,				// INC HL
+	0xcb, 0xfc,			// SET 7, H
+	0x18, 0xfa,			// JR loop
+};
+
+/// Provides forty double-sided tracks of nine 512-byte sectors.
+struct MSXDiskImage: public Storage::Disk::DiskImage {
+	Storage::Disk::HeadPosition get_maximum_head_position() final {
+		return Storage::Disk::HeadPosition(40);
+	}
+
+	int get_head_count() final {
+		return 2;
+	}
+
+	std::shared_ptr<Storage::Disk::Track> get_track_at_position(Storage::Disk::Track::Address address) final {
+		std::vector<Storage::Encodings::MFM::Sector> sectors(9);
+		for(int c = 0; c < 9; c++) {
+			auto &sector = sectors[size_t(c)];
+			sector.address.track = uint8_t(address.position.as_int());
+			sector.address.side = uint8_t(address.head);
+			sector.address.sector = uint8_t(1 + c);
+			sector.size = 2;
+			sector.samples.emplace_back(512, uint8_t(c));
+		}
+		return Storage::Encodings::MFM::GetMFMTrackWithSectors(sectors);
+	}
+};
+
+/// Increments every byte from 0x4000 upwards, wrapping around.
+const std::vector<uint8_t> increment_program = {
+	0x21, 0x00, 0x40,	// LD HL, 0x4000
+	0x34,				// loop: INC (HL)
+	0x23,				// INC HL
+	0x18, 0xfc,			// JR loop
+};
+
+/// Constructs two instances of a machine via @c make, hashing one after every 50th of a second and the
+/// other only at the end of a second, and checks that the final hashes agree.
+template <typename MachineT> void check_incremental_hashing(MachineT *(*make)(), const char *name) {
+	std::vector<std::pair<std::string, Utility::StateHasher::Hash>> hashes[2];
+	for(int incremental = 0; incremental < 2; incremental++) {
+		std::srand(1);
+		Machine::TypedDynamicMachine<MachineT> machine(make());
+
+		Utility::StateHasher hasher;
+		for(int frame = 0; frame < 50; frame++) {
+			machine.timed_machine()->run_for(1.0 / 50.0);
+			if(incremental) {
+				hasher.reset();
+				machine.state_hash_producer()->hash_state(hasher);
+			}
+		}
+		hasher.reset();
+		machine.state_hash_producer()->hash_state(hasher);
+		hashes[incremental] = hasher.components();
+	}
+
+	XCTAssertGreaterThan(hashes[0].size(), 0, @"%s", name);
+	XCTAssert(hashes[0] == hashes[1], @"%s", name);
+}
+
+}
+
+@interface StateHasherTests : XCTestCase
+@end
+
+@implementation StateHasherTests
+
+/// Checks that a PagedMemoryHasher updated incrementally always agrees with one that hashes from scratch.
+- (void)testPagedMemoryHasher {
+	std::vector<uint8_t> memory(10'000);
+	std::mt19937 random(0x5678);
+	for(auto &byte: memory) byte = uint8_t(random());
+
+	Utility::PagedMemoryHasher incremental(memory.data(), memory.size());
+	const auto original = incremental.hash();
+
+	for(int c = 0; c < 1000; c++) {
+		const size_t offset = random() % memory.size();
+		memory[offset] = uint8_t(random());
+		incremental.mark_dirty(offset);
+
+		if(!(c % 50)) {
+			Utility::PagedMemoryHasher fresh(memory.data(), memory.size());
+			XCTAssertEqual(incremental.hash(), fresh.hash());
+		}
+	}
+
+	// Memory changed without being marked dirty should go unnoticed until invalidation.
+	const auto before = incremental.hash();
+	memory[0] ^= 0xff;
+	XCTAssertEqual(incremental.hash(), before);
+	incremental.invalidate();
+	XCTAssertNotEqual(incremental.hash(), before);
+
+	// Identical pages at different addresses should contribute differently.
+	std::vector<uint8_t> lhs(512, 0), rhs(512, 0);
+	lhs[0] = rhs[256] = 1;
+	XCTAssertNotEqual(
+		Utility::PagedMemoryHasher(lhs.data(), lhs.size()).hash(),
+		Utility::PagedMemoryHasher(rhs.data(), rhs.size()).hash());
+	XCTAssertNotEqual(original, 0);
+}
+
+/// Checks that machines which hash their memory and video RAM incrementally notice every write to them.
+- (void)testIncrementalMachineHashing {
+	check_incremental_hashing<AmstradCPC::Machine>([] {
+		Analyser::Static::AmstradCPC::Target target;
+		target.model = Analyser::Static::AmstradCPC::Target::Model::CPC6128;
+		return AmstradCPC::Machine::AmstradCPC(&target, synthetic_roms(increment_program));
+	}, "CPC");
+
+	for(const auto model: {Analyser::Static::MSX::Target::Model::MSX1, Analyser::Static::MSX::Target::Model::MSX2}) {
+		static Analyser::Static::MSX::Target target;
+		target.model = model;
+		check_incremental_hashing<MSX::Machine>([] {
+			return MSX::Machine::MSX(&target, synthetic_roms(msx_program));
+		}, "MSX");
+	}
+
+	check_incremental_hashing<Sinclair::ZX8081::Machine>([] {
+		Analyser::Static::ZX8081::Target target;
+		target.is_ZX81 = true;
+		target.memory_model = Analyser::Static::ZX8081::Target::MemoryModel::SixteenKB;
+		return Sinclair::ZX8081::Machine::ZX8081(&target, synthetic_roms(increment_program));
+	}, "ZX81");
+}
+
+/// Checks that two identical machines do not diverge, and that one run ahead of the other does.
+- (void)testDivergence {
+	auto reference = spectrum(), candidate = spectrum();
+	XCTAssert(reference && candidate);
+	if(!reference || !candidate) return;
+
+	XCTAssertFalse(Machine::find_divergence(*reference, *candidate, 100).found);
+
+	candidate->timed_machine()->run_for(0.001);
+	const auto divergence = Machine::find_divergence(*reference, *candidate, 100);
+	XCTAssertTrue(divergence.found);
+	XCTAssertEqual(divergence.frame, 0);
+}
+
+/// Checks that an MSX 1 with a disk drive can be restored from its state, including that of the disk
+/// controller and drives, and then proceeds exactly as the original.
+- (void)testMSXDiskStateRoundTrip {
+	Analyser::Static::MSX::Target target;
+	target.model = Analyser::Static::MSX::Target::Model::MSX1;
+	target.has_disk_drive = true;
+	target.has_msx_music = false;
+	target.media.disks.push_back(std::make_shared<Storage::Disk::DiskImageHolder<MSXDiskImage>>());
+	target.media.disks.push_back(std::make_shared<Storage::Disk::DiskImageHolder<MSXDiskImage>>());
+
+	Machine::TypedDynamicMachine<MSX::Machine> original(MSX::Machine::MSX(&target, synthetic_roms(msx_disk_program)));
+	// Run only for whole seconds, so that there's no fractional cycle carried by the original but not the restored.
+	original.timed_machine()->run_for(1.0);
+	const auto state = original.state_producer()->get_state();
+	XCTAssert(state);
+	if(!state) return;
+
+	target.state = std::make_unique<MSX::State>();
+	XCTAssert(target.state->deserialise(state->serialise()));
+	Machine::TypedDynamicMachine<MSX::Machine> restored(MSX::Machine::MSX(&target, synthetic_roms(msx_disk_program)));
+
+	for(int c = 0; c < 3; c++) {
+		const auto original_state = original.state_producer()->get_state();
+		const auto restored_state = restored.state_producer()->get_state();
+		XCTAssert(original_state && restored_state);
+		if(!original_state || !restored_state) return;
+
+		XCTAssert(original_state->serialise() == restored_state->serialise(), @"States differ after %d steps", c);
+		original.timed_machine()->run_for(1.0);
+		restored.timed_machine()->run_for(1.0);
+	}
+}
+
+@end
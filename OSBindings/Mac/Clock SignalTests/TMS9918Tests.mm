@@ -0,0 +1,89 @@
+//
+//  TMS9918Tests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Components/9918/9918.hpp"
+
+#include <random>
+
+namespace {
+
+using VDP = TI::TMS::TMS9918<TI::TMS::Personality::TMS9918A>;
+
+void write_register(VDP &vdp, uint8_t reg, uint8_t value) {
+	vdp.write(1, value);
+	vdp.write(1, 0x80 | reg);
+}
+
+}
+
+@interface TMS9918Tests : XCTestCase
+@end
+
+@implementation TMS9918Tests
+
+/// Captures the state of a VDP part way through a frame, serialises it and applies it to a new VDP,
+/// then checks that both subsequently produce the same interrupts, status and video RAM reads.
+- (void)testStateRoundTrip {
+	std::mt19937 random(0x9918);
+
+	for(const auto standard: {TI::TMS::TVStandard::PAL, TI::TMS::TVStandard::NTSC}) {
+		for(int capture = 0; capture < 20; capture++) {
+			VDP original;
+			original.set_tv_standard(standard);
+
+			// Fill video RAM with random content.
+			original.write(1, 0x00);
+			original.write(1, 0x40);
+			for(int c = 0; c < 16384; c++) {
+				original.write(0, uint8_t(random()));
+				original.run_for(HalfCycles(32));
+			}
+
+			// Select Graphics I with interrupts and 16x16 sprites, so that there'll be collisions and overflow.
+			write_register(original, 0, 0x00);
+			write_register(original, 1, 0xe2);
+			write_register(original, 2, 0x06);
+			write_register(original, 3, 0x80);
+			write_register(original, 4, 0x00);
+			write_register(original, 5, 0x36);
+			write_register(original, 6, 0x07);
+			write_register(original, 7, 0xf4);
+			original.run_for(HalfCycles(int(random() % (313 * 456 * 3))));
+
+			// Leave a read queued.
+			original.write(1, uint8_t(random()));
+			original.write(1, uint8_t(random() & 0x3f));
+
+			TI::TMS::State restored;
+			XCTAssertTrue(restored.deserialise(TI::TMS::State(original).serialise()));
+
+			VDP copy;
+			copy.set_tv_standard(standard);
+			restored.apply(copy);
+
+			for(int step = 0; step < 2000; step++) {
+				XCTAssertEqual(original.get_interrupt_line(), copy.get_interrupt_line(), @"Capture %d, step %d", capture, step);
+				XCTAssertEqual(original.get_next_sequence_point(), copy.get_next_sequence_point(), @"Capture %d, step %d", capture, step);
+
+				switch(random() % 8) {
+					default: break;
+					case 0:		XCTAssertEqual(original.read(1), copy.read(1), @"Capture %d, step %d", capture, step);	break;
+					case 1:		XCTAssertEqual(original.read(0), copy.read(0), @"Capture %d, step %d", capture, step);	break;
+				}
+
+				const auto duration = HalfCycles(int(random() % 1000));
+				original.run_for(duration);
+				copy.run_for(duration);
+			}
+		}
+	}
+}
+
+@end
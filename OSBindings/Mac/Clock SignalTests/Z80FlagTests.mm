@@ -0,0 +1,147 @@
+//
+//  Z80FlagTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 19/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Processors/Z80/AllRAM/Z80AllRAM.hpp"
+
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using Register = CPU::Z80::Register;
+using Flag = CPU::Z80::Flag;
+
+/// @returns Flag::Parity if @c value has even parity; 0 otherwise.
+uint8_t parity(uint8_t value) {
+	int bits = 0;
+	for(int c = 0; c < 8; c++) {
+		bits += (value >> c) & 1;
+	}
+	return (bits & 1) ? 0 : Flag::Parity;
+}
+
+/// @returns The sign, zero, bit 5 and bit 3 flags for @c value.
+uint8_t sz53(uint8_t value) {
+	return uint8_t((value & (Flag::Sign | Flag::Bit5 | Flag::Bit3)) | (value ? 0 : Flag::Zero));
+}
+
+/// Runs @c program from address 0, one instruction per byte, having first set A and F.
+std::unique_ptr<CPU::Z80::AllRAMProcessor> run(std::initializer_list<uint8_t> program, uint8_t a, uint8_t f, std::size_t instructions) {
+	std::unique_ptr<CPU::Z80::AllRAMProcessor> z80(CPU::Z80::AllRAMProcessor::Processor());
+	z80->reset_power_on();
+
+	const std::vector<uint8_t> code(program);
+	z80->set_data_at_address(0, code.size(), code.data());
+	z80->set_value_of(Register::ProgramCounter, 0);
+	z80->set_value_of(Register::A, a);
+	z80->set_value_of(Register::Flags, f);
+
+	while(instructions--) {
+		z80->run_for_instruction();
+	}
+	return z80;
+}
+
+}
+
+@interface Z80FlagTests : XCTestCase
+@end
+
+@implementation Z80FlagTests
+
+/// Checks DAA for every combination of A, carry, half carry and subtract against a
+/// step-by-step description of its behaviour.
+- (void)testDAA {
+	for(int c = 0; c < 2048; c++) {
+		const auto a = uint8_t(c);
+		const bool carry = c & 0x100;
+		const bool half_carry = c & 0x200;
+		const bool subtract = c & 0x400;
+
+		const int low_nibble = a & 0xf;
+		const int high_nibble = a >> 4;
+
+		int adjustment = 0;
+		bool carry_out = carry;
+		if(carry) {
+			adjustment = (low_nibble > 0x9 || half_carry) ? 0x66 : 0x60;
+		} else if(low_nibble > 0x9) {
+			adjustment = (high_nibble > 0x8) ? 0x66 : 0x06;
+			carry_out = high_nibble > 0x8;
+		} else {
+			adjustment = (high_nibble > 0x9) ? 0x60 : 0x00;
+			if(half_carry) adjustment |= 0x06;
+			carry_out = high_nibble > 0x9;
+		}
+
+		const auto result = uint8_t(subtract ? a - adjustment : a + adjustment);
+		const bool half_carry_out = subtract ? (half_carry && low_nibble < 0x6) : (low_nibble > 0x9);
+		const auto expected_flags = uint8_t(
+			sz53(result) |
+			parity(result) |
+			(half_carry_out ? Flag::HalfCarry : 0) |
+			(subtract ? Flag::Subtract : 0) |
+			(carry_out ? Flag::Carry : 0)
+		);
+
+		const auto z80 = run(
+			{0x27},	// DAA
+			a,
+			uint8_t((carry ? Flag::Carry : 0) | (half_carry ? Flag::HalfCarry : 0) | (subtract ? Flag::Subtract : 0)),
+			1);
+		XCTAssertEqual(z80->value_of(Register::A), result, @"A for input %03x", c);
+		XCTAssertEqual(z80->value_of(Register::Flags), expected_flags, @"Flags for input %03x", c);
+	}
+}
+
+/// Checks the parity flag as set by OR A for every value of A.
+- (void)testParity {
+	for(int a = 0; a < 256; a++) {
+		const auto z80 = run({0xb7}, uint8_t(a), 0, 1);	// OR A
+		XCTAssertEqual(z80->value_of(Register::Flags), sz53(uint8_t(a)) | parity(uint8_t(a)), @"Flags for %02x", a);
+	}
+}
+
+/// Checks NEG for every value of A; overflow should be set only for 0x80.
+- (void)testNEG {
+	for(int a = 0; a < 256; a++) {
+		const auto result = uint8_t(-a);
+		const auto z80 = run({0xed, 0x44}, uint8_t(a), 0, 1);	// NEG
+		XCTAssertEqual(z80->value_of(Register::A), result, @"A for %02x", a);
+		XCTAssertEqual(
+			z80->value_of(Register::Flags),
+			sz53(result) |
+				((a & 0xf) ? Flag::HalfCarry : 0) |
+				(a == 0x80 ? Flag::Overflow : 0) |
+				Flag::Subtract |
+				(a ? Flag::Carry : 0),
+			@"Flags for %02x", a);
+	}
+}
+
+/// Checks that SCF and CCF copy A into bits 5 and 3 if the previous instruction set flags,
+/// but otherwise OR A into the existing bits.
+- (void)testSCFCCFBits53 {
+	for(const uint8_t opcode: {0x37, 0x3f}) {	// SCF, CCF
+		// NOP leaves bits 5 and 3 as set; A adds nothing to them.
+		auto z80 = run({0x00, opcode}, 0x00, Flag::Bit5 | Flag::Bit3, 2);
+		XCTAssertEqual(z80->value_of(Register::Flags) & (Flag::Bit5 | Flag::Bit3), Flag::Bit5 | Flag::Bit3, @"Opcode %02x after NOP", opcode);
+
+		// CP B sets bits 5 and 3 from B; those should then be replaced by A.
+		z80 = run({0xb8, opcode}, 0x00, 0, 0);
+		z80->set_value_of(Register::B, Flag::Bit5 | Flag::Bit3);
+		z80->run_for_instruction();
+		z80->run_for_instruction();
+		XCTAssertEqual(z80->value_of(Register::Flags) & (Flag::Bit5 | Flag::Bit3), 0, @"Opcode %02x after CP", opcode);
+	}
+}
+
+@end
@@ -9,20 +9,30 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <csignal>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
+#include <thread>
 #include <sys/stat.h>
 
 #include <SDL2/SDL.h>
 
 #include "../../Analyser/Static/StaticAnalyser.hpp"
 #include "../../Machines/Utility/MachineForTarget.hpp"
+#include "../../Machines/Utility/BootSnapshotCache.hpp"
+#include "../../Machines/Utility/Divergence.hpp"
+#include "../../Machines/Utility/InputScript.hpp"
+#include "../../Machines/Utility/MediaLoader.hpp"
+#include "../../Machines/Utility/MemoryAccount.hpp"
 
 #include "../../ClockReceiver/TimeTypes.hpp"
 #include "../../ClockReceiver/ScanSynchroniser.hpp"
@@ -33,6 +43,8 @@
 #include "../../Outputs/OpenGL/Primitives/Rectangle.hpp"
 #include "../../Outputs/OpenGL/ScanTarget.hpp"
 #include "../../Outputs/OpenGL/Screenshot.hpp"
+#include "../../Outputs/ScanTargets/FrameBufferScanTarget.hpp"
+#include "../../Outputs/SharedMemory/Exporter.hpp"
 
 #include "../../Reflection/Enum.hpp"
 #include "../../Reflection/Struct.hpp"
@@ -525,6 +537,77 @@ class SDLJoystick {
 		std::vector<Uint8> hat_values_;
 };
 
+/// Set upon SIGINT or SIGTERM to end a headless run.
+volatile std::sig_atomic_t headless_should_quit = 0;
+
+/*!
+	Runs @c machine in real time without a window or audio device, publishing its frames and audio
+	to the shared-memory object @c name until terminated.
+
+	If supplied, input is taken from @c input_script.
+*/
+int run_shared_memory_export(::Machine::DynamicMachine &machine, std::string name, ::Machine::InputScript *input_script) {
+	constexpr int FrameWidth = 640, FrameHeight = 480;
+	constexpr int SampleRate = 48000, AudioBlockSamples = 1024;
+
+	// POSIX requires that shared-memory names begin with a slash.
+	if(name.empty() || name[0] != '/') {
+		name = "/" + name;
+	}
+
+	std::unique_ptr<Outputs::SharedMemory::Exporter> exporter;
+	try {
+		exporter = std::make_unique<Outputs::SharedMemory::Exporter>(name, FrameWidth, FrameHeight, AudioBlockSamples);
+	} catch(const std::system_error &error) {
+		std::cerr << "Could not create shared memory " << error.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const auto scan_target = std::make_unique<Outputs::Display::FrameBufferScanTarget>(FrameWidth, FrameHeight);
+	scan_target->set_delegate(exporter.get());
+	const auto scan_producer = machine.scan_producer();
+	if(scan_producer) {
+		scan_producer->set_scan_target(scan_target.get());
+	}
+
+	Outputs::Speaker::Speaker *speaker = nullptr;
+	if(const auto audio_producer = machine.audio_producer()) {
+		speaker = audio_producer->get_speaker();
+	}
+	if(speaker) {
+		const bool is_stereo = speaker->get_is_stereo();
+		exporter->set_audio_format(SampleRate, is_stereo ? 2 : 1);
+		speaker->set_output_rate(float(SampleRate), AudioBlockSamples, is_stereo);
+		speaker->set_delegate(exporter.get());
+	}
+
+	std::signal(SIGINT, [](int) { headless_should_quit = 1; });
+	std::signal(SIGTERM, [](int) { headless_should_quit = 1; });
+
+	// Run in short steps, matching elapsed time, and publish whatever output each produces.
+	const auto timed_machine = machine.timed_machine();
+	auto last_time = Time::nanos_now();
+	while(!headless_should_quit) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+		const auto time_now = Time::nanos_now();
+		const auto duration = Time::seconds(time_now - last_time);
+		if(input_script) {
+			timed_machine->run_for(duration, input_script->next(duration));
+		} else {
+			timed_machine->run_for(duration);
+		}
+		timed_machine->flush_output(MachineTypes::TimedMachine::Output::All);
+		scan_target->update();
+		last_time = time_now;
+	}
+
+	// Detach before the exporter and scan target are destroyed.
+	if(speaker) speaker->set_delegate(nullptr);
+	if(scan_producer) scan_producer->set_scan_target(nullptr);
+	return EXIT_SUCCESS;
+}
+
 }
 
 int main(int argc, char *argv[]) {
@@ -534,7 +617,7 @@ int main(int argc, char *argv[]) {
 	const ParsedArguments arguments = parse_arguments(argc, argv);
 
 	// This may be printed either as
-	const std::string usage_suffix = " [file or --new={machine}] [OPTIONS] [--rompath={path to ROMs}] [--speed={speed multiplier, e.g. 1.5}] [--logical-keyboard] [--volume={0.0 to 1.0}]";
+	const std::string usage_suffix = " [file or --new={machine}] [OPTIONS] [--rompath={path to ROMs}] [--speed={speed multiplier, e.g. 1.5}] [--logical-keyboard] [--volume={0.0 to 1.0}] [--mass-storage-overlay={path}] [--divergence-test={number of frames}] [--memory-budget={bytes per cache}] [--memory-report] [--shared-memory-export={name}] [--input-script={path}] [--boot-snapshot-cache={directory}] [--multimachine-interval={seconds}] [--multimachine-checkpoints={number}]";
 
 	// Print a help message if requested.
 	if(arguments.selections.find("help") != arguments.selections.end() || arguments.selections.find("h") != arguments.selections.end()) {
@@ -562,6 +645,10 @@ int main(int argc, char *argv[]) {
 		}
 		std::cout << "." << std::endl << std::endl;
 
+		std::cout << "For long-running instances:" << std::endl << std::endl;
+		std::cout << "\t--memory-budget={bytes}: caps each of the machine's growable caches and queues, such as disk track caches, at the given size." << std::endl;
+		std::cout << "\t--memory-report: prints the bytes held by each subsystem's caches and queues to standard output every ten seconds." << std::endl << std::endl;
+
 		std::cout << "Further machine options:" << std::endl << std::endl;;
 
 		const auto targets = Machine::TargetsByMachineName(false);
@@ -616,10 +703,12 @@ int main(int argc, char *argv[]) {
 						std::cout << value;
 					}
 					std::cout << "}";
+				} else if(*type == typeid(int)) {
+					std::cout << "={n}";
 				}
 
-				// The above effectively assumes that every field is either a
-				// Boolean or an enum. This may need to be revisted. It also
+				// The above effectively assumes that every field is a Boolean,
+				// an enum or an int. This may need to be revisted. It also
 				// assumes no name collisions, but that's kind of unavoidable.
 
 				std::cout << std::endl;
@@ -761,6 +850,14 @@ int main(int argc, char *argv[]) {
 			return results;
 		};
 
+	// If a boot snapshot cache was requested, obtain ROMs via it so that they form part of the cache key.
+	std::unique_ptr<::Machine::BootSnapshotCache> boot_snapshot_cache;
+	const auto boot_snapshot_argument = arguments.selections.find("boot-snapshot-cache");
+	if(boot_snapshot_argument != arguments.selections.end() && !boot_snapshot_argument->second.empty()) {
+		boot_snapshot_cache = std::make_unique<::Machine::BootSnapshotCache>(boot_snapshot_argument->second, rom_fetcher);
+		rom_fetcher = boot_snapshot_cache->rom_fetcher();
+	}
+
 	// Apply all command-line options to the targets.
 	for(auto &target: targets) {
 		auto reflectable_target = dynamic_cast<Reflection::Struct *>(target.get());
@@ -768,10 +865,61 @@ int main(int argc, char *argv[]) {
 		arguments.apply(reflectable_target);
 	}
 
+	// Divert mass-storage writes to overlay files, if requested; if there are multiple devices
+	// then the second and subsequent have their index appended to the overlay's file name.
+	const auto overlay_argument = arguments.selections.find("mass-storage-overlay");
+	if(overlay_argument != arguments.selections.end() && !overlay_argument->second.empty()) {
+		size_t index = 0;
+		for(auto &target: targets) {
+			for(auto &device: target->media.mass_storage_devices) {
+				const std::string overlay_name = index ? overlay_argument->second + "." + std::to_string(index) : overlay_argument->second;
+				if(!device->set_overlay(overlay_name)) {
+					std::cerr << "Could not use overlay " << overlay_name << "; writes will go directly to the disk image" << std::endl;
+				}
+				++index;
+			}
+		}
+	}
+
+	// A divergence test compares two copies of the machine from power-on, so ensure that each
+	// begins with the same fuzzed memory contents by seeding rand() identically before each is created.
+	const auto divergence_argument = arguments.selections.find("divergence-test");
+	constexpr unsigned int divergence_seed = 1;
+	if(divergence_argument != arguments.selections.end()) {
+		std::srand(divergence_seed);
+	}
+
+	// Determine how to pick between machines if the analyser offered several.
+	Analyser::Dynamic::MultiMachineEvaluationPolicy evaluation_policy;
+	{
+		const auto interval_argument = arguments.selections.find("multimachine-interval");
+		if(interval_argument != arguments.selections.end()) {
+			const char *interval_string = interval_argument->second.c_str();
+			char *end;
+			const double interval = strtod(interval_string, &end);
+
+			if(size_t(end - interval_string) != strlen(interval_string) || interval < 0.0) {
+				std::cerr << "Unable to parse multimachine interval: " << interval_string << std::endl;
+			} else {
+				evaluation_policy.checkpoint_interval = interval;
+			}
+		}
+
+		const auto checkpoints_argument = arguments.selections.find("multimachine-checkpoints");
+		if(checkpoints_argument != arguments.selections.end()) {
+			const int checkpoints = atoi(checkpoints_argument->second.c_str());
+			if(checkpoints < 1) {
+				std::cerr << "Unable to parse multimachine checkpoints: " << checkpoints_argument->second << std::endl;
+			} else {
+				evaluation_policy.required_checkpoints = checkpoints;
+			}
+		}
+	}
+
 	// Create and configure a machine.
 	::Machine::Error error;
 	std::mutex machine_mutex;
-	std::unique_ptr<::Machine::DynamicMachine> machine(::Machine::MachineForTargets(targets, rom_fetcher, error));
+	std::unique_ptr<::Machine::DynamicMachine> machine(::Machine::MachineForTargets(targets, rom_fetcher, error, evaluation_policy));
 	if(!machine) {
 		switch(error) {
 			default: break;
@@ -804,6 +952,20 @@ int main(int argc, char *argv[]) {
 		configurable->set_options(options);
 	}
 
+	// Skip boot by restoring from the cache if possible, otherwise boot now and populate the cache.
+	// The cache itself declines media other than disks, which form part of its key.
+	if(boot_snapshot_cache) {
+		switch(boot_snapshot_cache->boot(machine, targets)) {
+			default: break;
+			case ::Machine::BootSnapshotCache::Outcome::NotStored:
+				std::cerr << "Could not store a boot snapshot in " << boot_snapshot_argument->second << std::endl;
+			break;
+			case ::Machine::BootSnapshotCache::Outcome::Unsupported:
+				std::cerr << "This machine or its media does not support boot snapshots" << std::endl;
+			break;
+		}
+	}
+
 	// Apply the speed multiplier, if one was requested.
 	{
 		const auto speed_argument = arguments.selections.find("speed");
@@ -844,14 +1006,6 @@ int main(int argc, char *argv[]) {
 		}
 	}
 
-	// Check whether a 'logical' keyboard has been requested, or the machine would prefer one anyway.
-	const bool logical_keyboard =
-		(arguments.selections.find("logical-keyboard") != arguments.selections.end()) ||
-		(machine->keyboard_machine() && machine->keyboard_machine()->prefers_logical_input());
-	if(logical_keyboard) {
-		SDL_StartTextInput();
-	}
-
 	// Ensure all media is inserted, if this machine accepts it.
 	{
 		auto media_target = machine->media_target();
@@ -864,12 +1018,130 @@ int main(int argc, char *argv[]) {
 		}
 	}
 
+	// Cap the machine's caches and queues if requested; this is intended for long-running instances.
+	std::optional<size_t> memory_budget;
+	const auto memory_budget_argument = arguments.selections.find("memory-budget");
+	if(memory_budget_argument != arguments.selections.end()) {
+		memory_budget = size_t(strtoull(memory_budget_argument->second.c_str(), nullptr, 10));
+
+		const auto memory_accountant = machine->memory_accountant();
+		if(memory_accountant) {
+			memory_accountant->set_memory_budget(*memory_budget);
+		} else {
+			std::cerr << "This machine does not support a memory budget" << std::endl;
+		}
+	}
+
+	// Report on the size of the machine's caches and queues every ten seconds if requested, as a single
+	// line per report on standard output listing each subsystem's usage and then the total, in bytes.
+	// Machines that don't implement MemoryAccountant produce no reports.
+	const bool memory_report = arguments.selections.find("memory-report") != arguments.selections.end();
+	Uint32 last_memory_report = 0;
+
+	// If a divergence test was requested, build a reference copy of the machine that has the same
+	// targets and media but only default runtime options, run it alongside the one configured above
+	// without any display or audio, and report the first frame and component at which they differ.
+	if(divergence_argument != arguments.selections.end()) {
+		const int frames = divergence_argument->second.empty() ? 500 : atoi(divergence_argument->second.c_str());
+		if(frames <= 0) {
+			std::cerr << "Unable to parse number of frames: " << divergence_argument->second << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		Analyser::Static::TargetList reference_targets;
+		if(!long_machine_name.empty()) {
+			auto targets_by_machine = Machine::TargetsByMachineName(false);
+			reference_targets.push_back(std::move(targets_by_machine[long_machine_name]));
+		} else {
+			auto file_name = arguments.file_names.begin();
+			while(file_name != arguments.file_names.end() && reference_targets.empty()) {
+				reference_targets = Analyser::Static::GetTargets(*file_name);
+				++file_name;
+			}
+		}
+		for(auto &target: reference_targets) {
+			auto reflectable_target = dynamic_cast<Reflection::Struct *>(target.get());
+			if(!reflectable_target) continue;
+			arguments.apply(reflectable_target);
+		}
+
+		std::srand(divergence_seed);
+		std::unique_ptr<::Machine::DynamicMachine> reference(::Machine::MachineForTargets(reference_targets, rom_fetcher, error, evaluation_policy));
+		if(!reference) {
+			std::cerr << "Could not create a reference machine" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// Put the reference through the same boot as the machine above, so that the two are
+		// compared from the same point whether each was restored from a snapshot or booted afresh.
+		if(boot_snapshot_cache && arguments.file_names.empty()) {
+			boot_snapshot_cache->boot(reference, reference_targets);
+		}
+
+		if(auto media_target = reference->media_target()) {
+			Analyser::Static::Media media;
+			for(const auto &file_name: arguments.file_names) {
+				media += Analyser::Static::GetMedia(file_name);
+			}
+			media_target->insert_media(media);
+		}
+
+		if(!machine->state_hash_producer() || !reference->state_hash_producer()) {
+			std::cerr << "This machine does not support state hashing" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		const auto divergence = ::Machine::find_divergence(*reference, *machine, frames);
+		if(!divergence.found) {
+			std::cout << "No divergence within " << frames << " frames" << std::endl;
+			return EXIT_SUCCESS;
+		}
+
+		std::cout << "First divergence at the end of frame " << divergence.frame << ", in " << divergence.component << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// If shared-memory export was requested, run headless, with output going only to shared memory.
+	const auto export_argument = arguments.selections.find("shared-memory-export");
+	if(export_argument != arguments.selections.end()) {
+		if(export_argument->second.empty()) {
+			std::cerr << "A name is required for shared-memory export" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		// Load a script of timed input if one was supplied.
+		std::unique_ptr<Machine::InputScript> input_script;
+		const auto script_argument = arguments.selections.find("input-script");
+		if(script_argument != arguments.selections.end()) {
+			std::ifstream script_file(script_argument->second);
+			if(!script_file) {
+				std::cerr << "Could not open input script " << script_argument->second << std::endl;
+				return EXIT_FAILURE;
+			}
+			input_script = std::make_unique<Machine::InputScript>(script_file);
+			if(!input_script->error().empty()) {
+				std::cerr << "Input script " << script_argument->second << ": " << input_script->error() << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+
+		return run_shared_memory_export(*machine, export_argument->second, input_script.get());
+	}
+
 	// Attempt to set up video and audio.
 	if(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
 		std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
 		return EXIT_FAILURE;
 	}
 
+	// Check whether a 'logical' keyboard has been requested, or the machine would prefer one anyway.
+	const bool logical_keyboard =
+		(arguments.selections.find("logical-keyboard") != arguments.selections.end()) ||
+		(machine->keyboard_machine() && machine->keyboard_machine()->prefers_logical_input());
+	if(logical_keyboard) {
+		SDL_StartTextInput();
+	}
+
 	// Ask for no depth buffer, a core profile and vsync-aligned rendering.
 	SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 0);
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
@@ -983,6 +1255,9 @@ int main(int argc, char *argv[]) {
 	};
 	std::vector<KeyPress> keypresses;
 
+	// Dropped files are loaded on a worker thread so that large media doesn't stall the machine.
+	Machine::MediaLoader media_loader;
+
 	// Run the main event loop until the OS tells us to quit.
 	bool should_quit = false;
 	Uint32 fullscreen_mode = 0;
@@ -1004,6 +1279,47 @@ int main(int argc, char *argv[]) {
 
 		// Grab the machine lock and process all pending events.
 		std::lock_guard lock_guard(machine_mutex);
+
+		// Deal with any dropped files that have now been loaded.
+		for(const auto &loaded: media_loader.take_loaded()) {
+			// If the new file is only media, insert it; if it is a state snapshot then
+			// tear down the entire machine and replace it.
+			if(!loaded.media.empty()) {
+				machine->media_target()->insert_media(loaded.media);
+				continue;
+			}
+
+			targets = Analyser::Static::GetTargets(loaded.file_name);
+			if(targets.empty()) continue;
+
+			::Machine::Error error;
+			std::unique_ptr<::Machine::DynamicMachine> new_machine(::Machine::MachineForTargets(targets, rom_fetcher, error, evaluation_policy));
+			if(error != Machine::Error::None) continue;
+
+			machine = std::move(new_machine);
+			static_cast<Outputs::Display::ScanTarget *>(&scan_target)->will_change_owner();
+			setup_machine_input_output();
+			window_titler.set_file_name(final_path_component(loaded.file_name));
+
+			if(const auto memory_accountant = machine->memory_accountant(); memory_accountant && memory_budget) {
+				memory_accountant->set_memory_budget(*memory_budget);
+			}
+		}
+
+		if(memory_report && SDL_GetTicks() - last_memory_report >= 10'000) {
+			last_memory_report = SDL_GetTicks();
+			if(const auto memory_accountant = machine->memory_accountant()) {
+				Utility::MemoryAccount account;
+				memory_accountant->account_memory(account);
+
+				std::cout << "Memory:";
+				for(const auto &subsystem: account.subsystems()) {
+					std::cout << " " << subsystem.first << " " << subsystem.second << ";";
+				}
+				std::cout << " total " << account.total() << std::endl;
+			}
+		}
+
 		const auto keyboard_machine = machine->keyboard_machine();
 		SDL_Event event;
 		while(SDL_PollEvent(&event)) {
@@ -1024,28 +1340,10 @@ int main(int argc, char *argv[]) {
 					}
 				break;
 
-				case SDL_DROPFILE: {
-					const Analyser::Static::Media media = Analyser::Static::GetMedia(event.drop.file);
-
-					// If the new file is only media, insert it; if it is a state snapshot then
-					// tear down the entire machine and replace it.
-					if(!media.empty()) {
-						machine->media_target()->insert_media(media);
-						break;
-					}
-
-					targets = Analyser::Static::GetTargets(event.drop.file);
-					if(targets.empty()) break;
-
-					::Machine::Error error;
-					std::unique_ptr<::Machine::DynamicMachine> new_machine(::Machine::MachineForTargets(targets, rom_fetcher, error));
-					if(error != Machine::Error::None) break;
-
-					machine = std::move(new_machine);
-					static_cast<Outputs::Display::ScanTarget *>(&scan_target)->will_change_owner();
-					setup_machine_input_output();
-					window_titler.set_file_name(final_path_component(event.drop.file));
-				} break;
+				case SDL_DROPFILE:
+					// Load off this thread; the result will be collected in a subsequent pass.
+					media_loader.load(event.drop.file);
+				break;
 
 				case SDL_TEXTINPUT:
 					keypresses.emplace_back(event.text.timestamp, event.text.text);
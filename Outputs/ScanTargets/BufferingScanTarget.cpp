@@ -32,8 +32,8 @@ BufferingScanTarget::BufferingScanTarget() {
 uint8_t *BufferingScanTarget::begin_data(size_t required_length, size_t required_alignment) {
 	assert(required_alignment);
 
-	// Acquire the standard producer lock, nominally over write_pointers_.
-	std::lock_guard lock_guard(producer_mutex_);
+	// Pick up any new write area or data size.
+	adopt_producer_state();
 
 	// If allocation has already failed on this line, continue the trend.
 	if(allocation_has_failed_) return nullptr;
@@ -97,9 +97,6 @@ template <typename DataUnit> void BufferingScanTarget::end_data(size_t actual_le
 }
 
 void BufferingScanTarget::end_data(size_t actual_length) {
-	// Acquire the producer lock.
-	std::lock_guard lock_guard(producer_mutex_);
-
 	// Do nothing if no data write is actually ongoing.
 	if(!data_is_allocated_) return;
 	data_is_allocated_ = false;
@@ -132,7 +129,7 @@ void BufferingScanTarget::end_data(size_t actual_length) {
 // MARK: - Producer; scans.
 
 Outputs::Display::ScanTarget::Scan *BufferingScanTarget::begin_scan() {
-	std::lock_guard lock_guard(producer_mutex_);
+	adopt_producer_state();
 
 	// If there's already an allocation failure on this line, do no work.
 	if(allocation_has_failed_) {
@@ -169,8 +166,6 @@ Outputs::Display::ScanTarget::Scan *BufferingScanTarget::begin_scan() {
 }
 
 void BufferingScanTarget::end_scan() {
-	std::lock_guard lock_guard(producer_mutex_);
-
 #ifndef NDEBUG
 	assert(scan_is_ongoing_);
 	scan_is_ongoing_ = false;
@@ -189,7 +184,7 @@ void BufferingScanTarget::end_scan() {
 // MARK: - Producer; lines.
 
 void BufferingScanTarget::announce(Event event, bool is_visible, const Outputs::Display::ScanTarget::Scan::EndPoint &location, uint8_t composite_amplitude) {
-	std::lock_guard lock_guard(producer_mutex_);
+	adopt_producer_state();
 
 	// Forward the event to the display metrics tracker.
 	display_metrics_.announce_event(event);
@@ -273,12 +268,32 @@ void BufferingScanTarget::announce(Event event, bool is_visible, const Outputs::
 // MARK: - Producer; other state.
 
 void BufferingScanTarget::will_change_owner() {
+	// Adopting pending state discards any work in progress, so it's sufficient
+	// just to flag that the producer should do so.
+	std::lock_guard lock_guard(producer_mutex_);
+	producer_state_is_dirty_.store(true, std::memory_order::memory_order_relaxed);
+}
+
+void BufferingScanTarget::adopt_pending_producer_state() {
 	std::lock_guard lock_guard(producer_mutex_);
+
+	write_area_ = pending_write_area_;
+	data_type_size_ = pending_data_type_size_;
+	if(pending_pointer_reset_) {
+		pending_pointer_reset_ = false;
+		write_pointers_ = PointerSet();
+		submit_pointers_.store(write_pointers_, std::memory_order::memory_order_relaxed);
+		pointer_reset_is_pending_.store(false, std::memory_order::memory_order_release);
+	}
+
+	// Whatever was in progress may have been captured under the old state, so abandon it.
 	allocation_has_failed_ = true;
 	vended_scan_ = nullptr;
 #ifdef DEBUG
 	data_is_allocated_ = false;
 #endif
+
+	producer_state_is_dirty_.store(false, std::memory_order::memory_order_relaxed);
 }
 
 const Outputs::Display::Metrics &BufferingScanTarget::display_metrics() {
@@ -286,17 +301,21 @@ const Outputs::Display::Metrics &BufferingScanTarget::display_metrics() {
 }
 
 void BufferingScanTarget::set_write_area(uint8_t *base) {
+	// Reset the consumer's pointers now; the producer will reset its own upon adoption
+	// and until then get_output_area will report nothing new.
 	std::lock_guard lock_guard(producer_mutex_);
-	write_area_ = base;
-	write_pointers_ = submit_pointers_ = read_pointers_ = PointerSet();
-	allocation_has_failed_ = true;
-	vended_scan_ = nullptr;
+	pending_write_area_ = base;
+	pending_pointer_reset_ = true;
+	read_pointers_.store(PointerSet(), std::memory_order::memory_order_relaxed);
+	read_ahead_pointers_.store(PointerSet(), std::memory_order::memory_order_relaxed);
+	pointer_reset_is_pending_.store(true, std::memory_order::memory_order_relaxed);
+	producer_state_is_dirty_.store(true, std::memory_order::memory_order_relaxed);
 }
 
 size_t BufferingScanTarget::write_area_data_size() const {
-	// TODO: can I guarantee this is safe without requiring that set_write_area
-	// be within an @c perform block?
-	return data_type_size_;
+	// The pending_ value is the one most recently set by the consumer, which
+	// is the only thread expected to call this.
+	return pending_data_type_size_;
 }
 
 void BufferingScanTarget::set_modals(Modals modals) {
@@ -312,8 +331,13 @@ BufferingScanTarget::OutputArea BufferingScanTarget::get_output_area() {
 	// The area to draw is that between the read pointers, representing wherever reading
 	// last stopped, and the submit pointers, representing all the new data that has been
 	// cleared for submission.
-	const auto submit_pointers = submit_pointers_.load(std::memory_order::memory_order_acquire);
+	//
+	// If the write area has been reset but the producer hasn't yet caught up then the submit pointers
+	// don't yet relate to the read pointers, so nothing is ready.
 	const auto read_ahead_pointers = read_ahead_pointers_.load(std::memory_order::memory_order_relaxed);
+	const auto submit_pointers =
+		pointer_reset_is_pending_.load(std::memory_order::memory_order_acquire) ?
+			read_ahead_pointers : submit_pointers_.load(std::memory_order::memory_order_acquire);
 	std::atomic_thread_fence(std::memory_order::memory_order_acquire);
 
 	OutputArea area;
@@ -385,8 +409,9 @@ const Outputs::Display::ScanTarget::Modals *BufferingScanTarget::new_modals() {
 	// now ensure their texture buffer is appropriate. They might provide a new pointer and might now.
 	// But either way it's now appropriate to start treating the data size as implied by the data type.
 	std::lock_guard lock_guard(producer_mutex_);
-	data_type_size_ = Outputs::Display::size_for_data_type(modals_.input_data_type);
-	assert((data_type_size_ == 1) || (data_type_size_ == 2) || (data_type_size_ == 4));
+	pending_data_type_size_ = Outputs::Display::size_for_data_type(modals_.input_data_type);
+	assert((pending_data_type_size_ == 1) || (pending_data_type_size_ == 2) || (pending_data_type_size_ == 4));
+	producer_state_is_dirty_.store(true, std::memory_order::memory_order_relaxed);
 
 	return &modals_;
 }
@@ -175,7 +175,8 @@ class BufferingScanTarget: public Outputs::Display::ScanTarget {
 		void announce(Event event, bool is_visible, const Outputs::Display::ScanTarget::Scan::EndPoint &location, uint8_t colour_burst_amplitude) final;
 		void will_change_owner() final;
 
-		// Uses a texture to vend write areas.
+		// Uses a texture to vend write areas. These are the producer's copies; other threads
+		// post changes via the pending_ fields below.
 		uint8_t *write_area_ = nullptr;
 		size_t data_type_size_ = 0;
 
@@ -234,15 +235,31 @@ class BufferingScanTarget: public Outputs::Display::ScanTarget {
 		/// This is used as a spinlock to guard `perform` calls.
 		std::atomic_flag is_updating_;
 
-		/// A mutex for gettng access to anything the producer modifies — i.e. the write_pointers_,
-		/// data_type_size_ and write_area_texture_, and all other state to do with capturing
-		/// data, scans and lines.
+		/// A mutex guarding the pending_ fields below, via which other threads ask the producer
+		/// to adopt a new write area or data size, or to abandon whatever it is currently doing.
 		///
-		/// This is almost never contended. The main collision is a user-prompted change of modals while the
-		/// emulation thread is running.
+		/// The producer takes this only once producer_state_is_dirty_ indicates that there is
+		/// something to adopt, so it is never acquired while capturing ordinary data, scans and lines.
 		std::mutex producer_mutex_;
+		std::atomic<bool> producer_state_is_dirty_ = false;
+		uint8_t *pending_write_area_ = nullptr;
+		size_t pending_data_type_size_ = 0;
+		bool pending_pointer_reset_ = false;
+
+		/// Set by the consumer upon a change of write area, having reset the read pointers; cleared by the
+		/// producer once it has similarly reset the write and submit pointers. Nothing can be output in between.
+		std::atomic<bool> pointer_reset_is_pending_ = false;
+
+		/// Applies any changes posted since the producer last looked; the fast path is a single relaxed load.
+		inline void adopt_producer_state() {
+			if(producer_state_is_dirty_.load(std::memory_order::memory_order_relaxed)) {
+				adopt_pending_producer_state();
+			}
+		}
+		void adopt_pending_producer_state();
 
 		/// A pointer to the next thing that should be provided to the caller for data.
+		/// This is touched only by the producer.
 		PointerSet write_pointers_;
 
 		// The owner-supplied scan buffer and size.
@@ -0,0 +1,226 @@
+//
+//  FrameBufferScanTarget.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "FrameBufferScanTarget.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace Outputs::Display;
+
+namespace {
+
+uint32_t rgba(float red, float green, float blue) {
+	const uint8_t components[4] = {
+		uint8_t(std::clamp(red, 0.0f, 1.0f) * 255.0f),
+		uint8_t(std::clamp(green, 0.0f, 1.0f) * 255.0f),
+		uint8_t(std::clamp(blue, 0.0f, 1.0f) * 255.0f),
+		255
+	};
+	uint32_t result;
+	memcpy(&result, components, sizeof(result));
+	return result;
+}
+
+/// Maps a single input sample to RGBA, per @c modals.
+uint32_t decode(const ScanTarget::Modals &modals, const uint8_t *sample) {
+	float red = 0.0f, green = 0.0f, blue = 0.0f;
+
+	switch(modals.input_data_type) {
+		case InputDataType::Luminance1:
+			red = green = blue = sample[0] ? 1.0f : 0.0f;
+		break;
+
+		case InputDataType::Luminance8:
+			red = green = blue = float(sample[0]) / 255.0f;
+		break;
+
+		case InputDataType::PhaseLinkedLuminance8:
+			red = green = blue = float(sample[0] + sample[1] + sample[2] + sample[3]) / (4.0f * 255.0f);
+		break;
+
+		case InputDataType::Luminance8Phase8: {
+			const float luminance = float(sample[0]) / 255.0f;
+			red = green = blue = luminance;
+			if(sample[1] > 191) break;
+
+			// This is the chrominance that quadrature demodulation of the encoded phase would produce.
+			const float phase = float(sample[1]) * 4.0f * float(M_PI) / 255.0f;
+			const float a = 0.5f * std::cos(phase);
+			const float b = -0.5f * std::sin(phase);
+			switch(modals.composite_colour_space) {
+				case ColourSpace::YIQ:
+					red = luminance + 0.956f*a + 0.621f*b;
+					green = luminance - 0.272f*a - 0.647f*b;
+					blue = luminance - 1.106f*a + 1.703f*b;
+				break;
+				case ColourSpace::YUV:
+					red = luminance + 1.13983f*b;
+					green = luminance - 0.39465f*a - 0.58060f*b;
+					blue = luminance + 2.03211f*a;
+				break;
+			}
+		} break;
+
+		case InputDataType::Red1Green1Blue1:
+			red = (sample[0] & 4) ? 1.0f : 0.0f;
+			green = (sample[0] & 2) ? 1.0f : 0.0f;
+			blue = (sample[0] & 1) ? 1.0f : 0.0f;
+		break;
+
+		case InputDataType::Red2Green2Blue2:
+			red = float((sample[0] >> 4) & 3) / 3.0f;
+			green = float((sample[0] >> 2) & 3) / 3.0f;
+			blue = float(sample[0] & 3) / 3.0f;
+		break;
+
+		case InputDataType::Red4Green4Blue4:
+			red = float(sample[0] & 15) / 15.0f;
+			green = float(sample[1] >> 4) / 15.0f;
+			blue = float(sample[1] & 15) / 15.0f;
+		break;
+
+		case InputDataType::Red8Green8Blue8:
+			red = float(sample[0]) / 255.0f;
+			green = float(sample[1]) / 255.0f;
+			blue = float(sample[2]) / 255.0f;
+		break;
+	}
+
+	if(modals.display_type == DisplayType::CompositeMonochrome) {
+		red = green = blue = 0.299f*red + 0.587f*green + 0.114f*blue;
+	}
+	return rgba(red * modals.brightness, green * modals.brightness, blue * modals.brightness);
+}
+
+}
+
+FrameBufferScanTarget::FrameBufferScanTarget(int width, int height) : width_(width), height_(height) {
+	set_scan_buffer(scan_buffer_.data(), scan_buffer_.size());
+	set_line_buffer(line_buffer_.data(), line_metadata_buffer_.data(), line_buffer_.size());
+}
+
+void FrameBufferScanTarget::set_delegate(Delegate *delegate) {
+	perform([=] {
+		frame_ = nullptr;
+		delegate_ = delegate;
+	});
+}
+
+void FrameBufferScanTarget::update() {
+	perform([=] {
+		const OutputArea area = get_output_area();
+
+		if(new_modals()) {
+			setup_pipeline();
+		}
+
+		// Draw each line's scans, beginning a new frame wherever a line is marked as the first in one.
+		auto line = area.start.line;
+		while(line != area.end.line) {
+			const LineMetadata &metadata = line_metadata_buffer_[line];
+			if(metadata.is_first_in_frame) {
+				end_frame();
+				begin_frame();
+			}
+
+			const auto next_line = (line + 1) % line_buffer_.size();
+			const auto end_scan = next_line == area.end.line ? area.end.scan : line_metadata_buffer_[next_line].first_scan;
+			if(frame_) {
+				for(auto scan = metadata.first_scan; scan != end_scan; scan = (scan + 1) % scan_buffer_.size()) {
+					draw_scan(scan_buffer_[scan]);
+				}
+			}
+
+			line = next_line;
+		}
+
+		complete_output_area(area);
+	});
+}
+
+void FrameBufferScanTarget::setup_pipeline() {
+	const auto &modals = BufferingScanTarget::modals();
+
+	// Resize the write area only if required; as with the OpenGL target, this should happen only
+	// while the producer is inactive.
+	data_type_size_ = size_for_data_type(modals.input_data_type);
+	const size_t required_size = size_t(WriteAreaWidth*WriteAreaHeight) * data_type_size_;
+	if(required_size != write_area_.size()) {
+		write_area_.resize(required_size);
+		set_write_area(write_area_.data());
+	}
+
+	// Map the visible area to the whole frame; each line is drawn at least one pixel tall.
+	const auto &visible_area = modals.visible_area;
+	x_scale_ = float(width_) / (float(modals.output_scale.x) * visible_area.size.width);
+	x_offset_ = visible_area.origin.x * float(width_) / visible_area.size.width;
+	y_scale_ = float(height_) / (float(modals.output_scale.y) * visible_area.size.height);
+	y_offset_ = visible_area.origin.y * float(height_) / visible_area.size.height;
+	row_height_ = std::max(1, int(std::ceil(float(height_) / (float(std::max(modals.expected_vertical_lines, 1)) * visible_area.size.height))));
+
+	// Tabulate colours for all sample sizes small enough to make that worthwhile.
+	colours_.clear();
+	if(data_type_size_ <= 2) {
+		colours_.resize(size_t(1) << (8 * data_type_size_));
+		for(size_t value = 0; value < colours_.size(); value++) {
+			const uint8_t sample[2] = {uint8_t(value), uint8_t(value >> 8)};
+			colours_[value] = decode(modals, sample);
+		}
+	}
+}
+
+uint32_t FrameBufferScanTarget::colour(const uint8_t *sample) const {
+	switch(data_type_size_) {
+		case 1:		return colours_[sample[0]];
+		case 2:		return colours_[size_t(sample[0] | (sample[1] << 8))];
+		default:	return decode(modals(), sample);
+	}
+}
+
+void FrameBufferScanTarget::begin_frame() {
+	frame_ = delegate_ ? delegate_->scan_target_will_begin_frame(this, width_, height_) : nullptr;
+	if(frame_) {
+		std::fill_n(reinterpret_cast<uint32_t *>(frame_), size_t(width_ * height_), rgba(0.0f, 0.0f, 0.0f));
+	}
+}
+
+void FrameBufferScanTarget::end_frame() {
+	if(frame_) {
+		delegate_->scan_target_did_complete_frame(this);
+		frame_ = nullptr;
+	}
+}
+
+void FrameBufferScanTarget::draw_scan(const Scan &scan) {
+	if(!data_type_size_) return;
+
+	// Scans are very close to horizontal, so are drawn as such.
+	const auto &end_points = scan.scan.end_points;
+	const int x0 = int(float(end_points[0].x) * x_scale_ - x_offset_);
+	const int x1 = int(float(end_points[1].x) * x_scale_ - x_offset_);
+	const int y = int(float(end_points[0].y + end_points[1].y) * 0.5f * y_scale_ - y_offset_);
+
+	const int start_x = std::max(x0, 0), end_x = std::min(x1, width_);
+	const int start_y = std::max(y, 0), end_y = std::min(y + row_height_, height_);
+	if(start_x >= end_x || start_y >= end_y) return;
+
+	const uint8_t *const source = &write_area_[size_t(scan.data_y) * WriteAreaWidth * data_type_size_];
+	const int data_start = end_points[0].data_offset;
+	const int data_length = end_points[1].data_offset - data_start;
+
+	uint32_t *const target = reinterpret_cast<uint32_t *>(frame_) + size_t(start_y * width_);
+	for(int x = start_x; x < end_x; x++) {
+		const int sample = data_start + ((2*(x - x0) + 1) * data_length) / (2*(x1 - x0));
+		target[x] = colour(&source[size_t(sample) * data_type_size_]);
+	}
+	for(int row = start_y + 1; row < end_y; row++) {
+		std::copy(&target[start_x], &target[end_x], &target[size_t((row - start_y) * width_) + size_t(start_x)]);
+	}
+}
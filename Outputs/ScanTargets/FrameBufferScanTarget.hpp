@@ -0,0 +1,81 @@
+//
+//  FrameBufferScanTarget.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef FrameBufferScanTarget_hpp
+#define FrameBufferScanTarget_hpp
+
+#include "BufferingScanTarget.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Outputs::Display {
+
+/*!
+	Rasterises the output of a BufferingScanTarget into frames of RGBA pixels in software,
+	for hosts that have no GPU or no display.
+
+	Each scan is drawn directly to its position in the frame with nearest sampling, without any
+	of the filtering or persistence of the OpenGL pipeline. Luminance-plus-phase data is decoded
+	directly from its phase; phase-linked luminance is output in monochrome.
+*/
+class FrameBufferScanTarget: public BufferingScanTarget {
+	public:
+		struct Delegate {
+			/// Requests storage for the next frame, which should have space for @c width * @c height
+			/// pixels, each stored as four bytes: red, green, blue, alpha.
+			virtual uint8_t *scan_target_will_begin_frame(FrameBufferScanTarget *, int width, int height) = 0;
+
+			/// Announces that the frame most recently begun is complete.
+			virtual void scan_target_did_complete_frame(FrameBufferScanTarget *) = 0;
+		};
+
+		/// Constructs a scan target that produces frames of @c width by @c height pixels,
+		/// covering the visible area nominated by the machine.
+		FrameBufferScanTarget(int width, int height);
+
+		/// Sets the delegate that supplies storage for frames and is told when each is complete.
+		/// Output is consumed and discarded when there's no delegate.
+		void set_delegate(Delegate *);
+
+		/// Draws all output posted since the last call, beginning and completing frames as they occur.
+		void update();
+
+	private:
+		static constexpr int LineBufferHeight = 2048;
+
+		std::vector<uint8_t> write_area_;
+		std::array<Scan, LineBufferHeight*5> scan_buffer_;
+		std::array<Line, LineBufferHeight> line_buffer_;
+		std::array<LineMetadata, LineBufferHeight> line_metadata_buffer_;
+
+		const int width_, height_;
+		Delegate *delegate_ = nullptr;
+		uint8_t *frame_ = nullptr;
+
+		void begin_frame();
+		void end_frame();
+		void draw_scan(const Scan &);
+
+		// Mapping from output coordinates to frame pixels, as per the current modals.
+		float x_scale_ = 0.0f, x_offset_ = 0.0f;
+		float y_scale_ = 0.0f, y_offset_ = 0.0f;
+		int row_height_ = 1;
+
+		// Mapping from input samples to RGBA, either via a table for samples of up to two bytes,
+		// or directly for four-byte samples.
+		size_t data_type_size_ = 0;
+		std::vector<uint32_t> colours_;
+		uint32_t colour(const uint8_t *sample) const;
+		void setup_pipeline();
+};
+
+}
+
+#endif /* FrameBufferScanTarget_hpp */
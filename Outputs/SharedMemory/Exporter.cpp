@@ -0,0 +1,155 @@
+//
+//  Exporter.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "Exporter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+using namespace Outputs::SharedMemory;
+
+namespace {
+
+constexpr size_t align(size_t size) {
+	constexpr size_t Alignment = 64;
+	return (size + Alignment - 1) & ~(Alignment - 1);
+}
+
+}
+
+Exporter::Exporter(const std::string &name, int width, int height, size_t audio_block_samples, uint32_t frame_slots, uint32_t audio_slots) :
+	name_(name), frame_width_(width), frame_height_(height) {
+
+	const size_t frame_slot_size = align(sizeof(SlotHeader) + size_t(width * height) * 4);
+	const size_t audio_slot_size = align(sizeof(SlotHeader) + audio_block_samples * 2 * sizeof(int16_t));
+	const size_t frames_offset = align(sizeof(RegionHeader));
+	const size_t audio_offset = frames_offset + frame_slots * frame_slot_size;
+	size_ = audio_offset + audio_slots * audio_slot_size;
+
+	// Start from a fresh object, so that no consumer of a previous one can observe this one being set up.
+	shm_unlink(name_.c_str());
+	const int descriptor = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if(descriptor < 0) {
+		throw std::system_error(errno, std::generic_category(), name_);
+	}
+
+	void *mapping = MAP_FAILED;
+	if(!ftruncate(descriptor, off_t(size_))) {
+		mapping = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+	}
+	const int error = errno;
+	close(descriptor);
+	if(mapping == MAP_FAILED) {
+		shm_unlink(name_.c_str());
+		throw std::system_error(error, std::generic_category(), name_);
+	}
+	region_ = static_cast<uint8_t *>(mapping);
+
+	// The object is zero-filled, so all sequence numbers begin as 0, i.e. no blocks are yet available.
+	header_ = new (region_) RegionHeader{};
+	header_->version = Version;
+	header_->frames.offset = frames_offset;
+	header_->frames.slot_count = frame_slots;
+	header_->frames.slot_size = uint32_t(frame_slot_size);
+	header_->audio.offset = audio_offset;
+	header_->audio.slot_count = audio_slots;
+	header_->audio.slot_size = uint32_t(audio_slot_size);
+	for(uint32_t slot = 0; slot < frame_slots; slot++) {
+		new (region_ + frames_offset + slot * frame_slot_size) SlotHeader{};
+	}
+	for(uint32_t slot = 0; slot < audio_slots; slot++) {
+		new (region_ + audio_offset + slot * audio_slot_size) SlotHeader{};
+	}
+
+	// Publish the magic number last, so that a consumer that sees it also sees the complete header.
+	std::atomic_thread_fence(std::memory_order_release);
+	header_->magic = Magic;
+}
+
+Exporter::~Exporter() {
+	munmap(region_, size_);
+	shm_unlink(name_.c_str());
+}
+
+void Exporter::set_audio_format(int sample_rate, int channels) {
+	audio_parameters_[0] = uint32_t(sample_rate);
+	audio_parameters_[1] = uint32_t(channels);
+}
+
+SlotHeader *Exporter::begin_block(RingHeader &ring) {
+	const uint64_t sequence = ring.sequence.load(std::memory_order_relaxed) + 1;
+	auto *const slot = reinterpret_cast<SlotHeader *>(region_ + ring.offset + ((sequence - 1) % ring.slot_count) * ring.slot_size);
+
+	// Invalidate the slot before any of its payload is modified.
+	slot->sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	return slot;
+}
+
+void Exporter::end_block(RingHeader &ring, SlotHeader *slot) {
+	const uint64_t sequence = ring.sequence.load(std::memory_order_relaxed) + 1;
+	slot->sequence.store(sequence, std::memory_order_release);
+	ring.sequence.store(sequence, std::memory_order_release);
+
+	// Both of these are sequentially consistent so that either a consumer that is about to wait sees the
+	// new signal value, or this sees that consumer as waiting.
+	header_->signal.fetch_add(1);
+#ifdef __linux__
+	if(header_->waiters.load()) {
+		syscall(SYS_futex, reinterpret_cast<uint32_t *>(&header_->signal), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+	}
+#endif
+}
+
+// MARK: - FrameBufferScanTarget::Delegate.
+
+uint8_t *Exporter::scan_target_will_begin_frame(Outputs::Display::FrameBufferScanTarget *, int width, int height) {
+	if(width != frame_width_ || height != frame_height_) {
+		frame_slot_ = nullptr;
+		return nullptr;
+	}
+
+	frame_slot_ = begin_block(header_->frames);
+	frame_slot_->length = uint32_t(width * height * 4);
+	frame_slot_->parameters[0] = uint32_t(width);
+	frame_slot_->parameters[1] = uint32_t(height);
+	return reinterpret_cast<uint8_t *>(frame_slot_ + 1);
+}
+
+void Exporter::scan_target_did_complete_frame(Outputs::Display::FrameBufferScanTarget *) {
+	if(!frame_slot_) return;
+	end_block(header_->frames, frame_slot_);
+	frame_slot_ = nullptr;
+}
+
+// MARK: - Speaker::Delegate.
+
+void Exporter::speaker_did_complete_samples(Outputs::Speaker::Speaker *, const std::vector<int16_t> &buffer) {
+	const size_t capacity = (header_->audio.slot_size - sizeof(SlotHeader)) / sizeof(int16_t);
+	const size_t samples = std::min(buffer.size(), capacity);
+
+	SlotHeader *const slot = begin_block(header_->audio);
+	slot->length = uint32_t(samples * sizeof(int16_t));
+	slot->parameters[0] = audio_parameters_[0];
+	slot->parameters[1] = audio_parameters_[1];
+	memcpy(reinterpret_cast<uint8_t *>(slot + 1), buffer.data(), samples * sizeof(int16_t));
+	end_block(header_->audio, slot);
+}
@@ -0,0 +1,72 @@
+//
+//  Exporter.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef SharedMemory_Exporter_hpp
+#define SharedMemory_Exporter_hpp
+
+#include "Layout.hpp"
+
+#include "../ScanTargets/FrameBufferScanTarget.hpp"
+#include "../Speaker/Speaker.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Outputs::SharedMemory {
+
+/*!
+	Creates a POSIX shared-memory object laid out as per Layout.hpp and publishes into it
+	the frames of a FrameBufferScanTarget and the audio of a Speaker.
+
+	Frames are rasterised directly into their slots. Audio blocks are copied.
+*/
+class Exporter:
+	public Outputs::Display::FrameBufferScanTarget::Delegate,
+	public Outputs::Speaker::Speaker::Delegate {
+	public:
+		/// Creates and maps the shared-memory object @c name, replacing any existing object of that name,
+		/// with room for frames of @c width by @c height pixels and audio blocks of up to
+		/// @c audio_block_samples stereo samples.
+		///
+		/// @throws std::system_error if the object can't be created or mapped.
+		Exporter(const std::string &name, int width, int height, size_t audio_block_samples, uint32_t frame_slots = 4, uint32_t audio_slots = 32);
+
+		/// Unmaps and unlinks the shared-memory object; consumers that have it mapped may continue to read it.
+		~Exporter();
+
+		/// Sets the sample rate and channel count that will be attached to subsequent audio blocks.
+		void set_audio_format(int sample_rate, int channels);
+
+	private:
+		// FrameBufferScanTarget::Delegate.
+		uint8_t *scan_target_will_begin_frame(Outputs::Display::FrameBufferScanTarget *, int width, int height) final;
+		void scan_target_did_complete_frame(Outputs::Display::FrameBufferScanTarget *) final;
+
+		// Speaker::Delegate.
+		void speaker_did_complete_samples(Outputs::Speaker::Speaker *, const std::vector<int16_t> &buffer) final;
+
+		/// Marks the slot that will hold the next block of @c ring as being written, and returns it.
+		SlotHeader *begin_block(RingHeader &ring);
+
+		/// Publishes the block in @c slot, as obtained from begin_block, and wakes any waiting consumers.
+		void end_block(RingHeader &ring, SlotHeader *slot);
+
+		const std::string name_;
+		uint8_t *region_ = nullptr;
+		size_t size_ = 0;
+		RegionHeader *header_ = nullptr;
+
+		const int frame_width_, frame_height_;
+		SlotHeader *frame_slot_ = nullptr;
+
+		uint32_t audio_parameters_[2] = {0, 0};
+};
+
+}
+
+#endif /* SharedMemory_Exporter_hpp */
@@ -0,0 +1,83 @@
+//
+//  Layout.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef SharedMemory_Layout_hpp
+#define SharedMemory_Layout_hpp
+
+#include <atomic>
+#include <cstdint>
+
+namespace Outputs::SharedMemory {
+
+/*!
+	Describes the layout of a region of shared memory into which an instance exports its output,
+	for direct consumption by another process.
+
+	The region begins with a RegionHeader. That describes two rings, one of video frames and one of
+	audio blocks, each being a sequence of fixed-size slots. Each slot begins with a SlotHeader and
+	is followed by its payload:
+		*	frames are width * height pixels, each four bytes: red, green, blue, alpha;
+		*	audio blocks are signed 16-bit native-endian samples, interleaved if stereo.
+
+	Blocks in each ring are numbered from 1; block n occupies slot (n - 1) % slot_count. To read
+	block n, a consumer:
+		(i) loads the slot's sequence with acquire semantics; if it isn't n then the block is either
+			not yet complete or has already been replaced;
+		(ii) reads as much of the payload as it needs, in place; and
+		(iii) issues an acquire fence and loads the slot's sequence again; if it is still n then
+			everything read was valid; otherwise the block was replaced during reading.
+
+	Consumers that wish to sleep until a new block is available can wait on @c signal, which changes
+	after every block. Under Linux that can be done with a futex: increment @c waiters, FUTEX_WAIT
+	while @c signal still holds the value last seen, then decrement @c waiters. Elsewhere, poll.
+*/
+
+constexpr uint32_t Magic = 0x584b4c43;		// i.e. 'CLKX' in little-endian order.
+constexpr uint32_t Version = 1;
+
+struct SlotHeader {
+	/// The number of the block currently in this slot, or 0 while it is being written.
+	std::atomic<uint64_t> sequence;
+
+	/// The number of bytes of payload.
+	uint32_t length;
+
+	/// For frames: width and height in pixels. For audio: sample rate and channel count.
+	uint32_t parameters[2];
+
+	uint32_t reserved;
+};
+
+struct RingHeader {
+	/// The number of the most recently completed block, or 0 if none has yet been completed.
+	std::atomic<uint64_t> sequence;
+
+	/// The offset of the first slot from the start of the region, in bytes.
+	uint64_t offset;
+
+	/// The number of slots and the distance between them in bytes, including the SlotHeader.
+	uint32_t slot_count, slot_size;
+};
+
+struct RegionHeader {
+	uint32_t magic, version;
+
+	/// Changes after the completion of every block in either ring.
+	std::atomic<uint32_t> signal;
+
+	/// The number of consumers currently waiting on @c signal.
+	std::atomic<uint32_t> waiters;
+
+	RingHeader frames, audio;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free);
+
+}
+
+#endif /* SharedMemory_Layout_hpp */
@@ -14,6 +14,7 @@
 #include <cassert>
 #include <cstring>
 #include <atomic>
+#include <numeric>
 
 namespace Outputs::Speaker {
 
@@ -73,6 +74,13 @@ template <typename... T> class CompoundSource:
 			return average_output_peak_;
 		}
 
+		/*!
+			@returns the period over which all sources owned by this CompoundSource repeat their samples.
+		*/
+		std::size_t get_sample_period() const {
+			return source_holder_.get_sample_period();
+		}
+
 	private:
 		void push_volumes() {
 			const double scale = source_holder_.total_scale(volumes_.data());
@@ -98,6 +106,10 @@ template <typename... T> class CompoundSource:
 				double total_scale(double *) const {
 					return 0.0;
 				}
+
+				std::size_t get_sample_period() const {
+					return 0;
+				}
 		};
 
 		template <typename S, typename... R> class CompoundSourceHolder<S, R...> {
@@ -162,6 +174,10 @@ template <typename... T> class CompoundSource:
 					return (volumes[0] / source_.get_average_output_peak()) + next_source_.total_scale(&volumes[1]);
 				}
 
+				std::size_t get_sample_period() const {
+					return std::gcd(source_.get_sample_period(), next_source_.get_sample_period());
+				}
+
 			private:
 				S &source_;
 				CompoundSourceHolder<R...> next_source_;
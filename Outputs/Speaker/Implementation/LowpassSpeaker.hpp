@@ -19,6 +19,7 @@
 #include <cmath>
 #include <cstring>
 #include <mutex>
+#include <numeric>
 
 namespace Outputs::Speaker {
 
@@ -94,10 +95,31 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 		std::vector<int16_t> input_buffer_;
 		std::vector<int16_t> output_buffer_;
 
-		float step_rate_ = 0.0f;
-		float position_error_ = 0.0f;
+		// The ratio of input to output rates, held as an exact fraction: each output sample
+		// advances the filter window by step_whole_ input samples plus step_numerator_ / step_denominator_.
+		uint64_t step_whole_ = 1;
+		uint64_t step_numerator_ = 0;
+		uint64_t step_denominator_ = 1;
+		uint64_t step_error_ = 0;
+
+		// The offset into the input buffer, in samples, of the next filter window.
+		std::size_t window_start_ = 0;
+
+		// The input buffer is sized to allow this many output samples to be produced per fill.
+		static constexpr std::size_t OutputsPerBlock = 32;
+
+		// The total number of samples so far obtained from the source; used to locate
+		// the input buffer relative to runs of repeated samples.
+		uint64_t samples_read_ = 0;
+
 		std::unique_ptr<SignalProcessing::FIRFilter> filter_;
 
+		// If the source declares that it repeats each sample for sample_period_ samples then
+		// phase_filters_ holds one version of filter_ per possible starting offset into such a run,
+		// each reading only the final sample of each run.
+		std::size_t sample_period_ = 1;
+		std::vector<SignalProcessing::FIRFilter> phase_filters_;
+
 		std::mutex filter_parameters_mutex_;
 		struct FilterParameters {
 			float input_cycles_per_second = 0.0f;
@@ -120,8 +142,7 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 			);
 			number_of_taps = (number_of_taps * 2) | 1;
 
-			step_rate_ = filter_parameters.input_cycles_per_second / filter_parameters.output_cycles_per_second;
-			position_error_ = 0.0f;
+			set_step(filter_parameters.input_cycles_per_second, filter_parameters.output_cycles_per_second);
 
 			filter_ = std::make_unique<SignalProcessing::FIRFilter>(
 				unsigned(number_of_taps),
@@ -130,6 +151,14 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 				high_pass_frequency,
 				SignalProcessing::FIRFilter::DefaultAttenuation);
 
+			sample_period_ = std::max(static_cast<ConcreteT *>(this)->get_sample_period(), size_t(1));
+			phase_filters_.clear();
+			if(sample_period_ > 1) {
+				for(size_t phase = 0; phase < sample_period_; phase++) {
+					phase_filters_.push_back(filter_->decimated(sample_period_, phase));
+				}
+			}
+
 			// Pick the new conversion function.
 			if(	filter_parameters.input_cycles_per_second == filter_parameters.output_cycles_per_second &&
 				filter_parameters.high_frequency_cutoff < 0.0) {
@@ -145,7 +174,6 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 			}
 
 			// Do something sensible with any dangling input, if necessary.
-			const int scale = static_cast<ConcreteT *>(this)->get_scale();
 			switch(conversion_) {
 				// Neither direct copying nor resampling larger currently use any temporary input.
 				// Although in the latter case that's just because it's unimplemented. But, regardless,
@@ -153,68 +181,119 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 				default: break;
 
 				case Conversion::ResampleSmaller: {
-					// Reize the input buffer only if absolutely necessary; if sizing downward
-					// such that a sample would otherwise be lost then output it now. Keep anything
-					// currently in the input buffer that hasn't yet been processed.
-					const size_t required_buffer_size = size_t(number_of_taps) * (is_stereo + 1);
-					if(input_buffer_.size() != required_buffer_size) {
-						if(input_buffer_depth_ >= required_buffer_size) {
-							resample_input_buffer(scale);
-							input_buffer_depth_ %= required_buffer_size;
-						}
-						input_buffer_.resize(required_buffer_size);
+					// Size the input buffer to hold a filter window, the remainder of any run of repeated samples
+					// at its end and a block's worth of steps, so that several output samples are produced per fill
+					// and the unconsumed tail is moved only once per block. Keep the most recent input if shrinking;
+					// the new filter's windows begin at the start of the buffer.
+					const size_t required_buffer_size =
+						(size_t(number_of_taps) + sample_period_ + size_t(step_whole_ + 1) * OutputsPerBlock) * (is_stereo + 1);
+					if(input_buffer_depth_ > required_buffer_size) {
+						std::memmove(	input_buffer_.data(),
+										&input_buffer_[input_buffer_depth_ - required_buffer_size],
+										sizeof(int16_t) * required_buffer_size);
+						input_buffer_depth_ = required_buffer_size;
 					}
+					input_buffer_.resize(required_buffer_size);
+					window_start_ = 0;
 				} break;
 			}
 		}
 
-		inline void resample_input_buffer(int scale) {
-			if(output_buffer_.empty()) {
+		void set_step(float input_cycles_per_second, float output_cycles_per_second) {
+			step_whole_ = 1;
+			step_numerator_ = step_error_ = 0;
+			step_denominator_ = 1;
+			if(input_cycles_per_second <= 0.0f || output_cycles_per_second <= 0.0f) {
 				return;
 			}
 
-			if constexpr (is_stereo) {
-				output_buffer_[output_buffer_pointer_ + 0] = filter_->apply(input_buffer_.data(), 2);
-				output_buffer_[output_buffer_pointer_ + 1] = filter_->apply(input_buffer_.data() + 1, 2);
-				output_buffer_pointer_+= 2;
+			// Both rates are floats, so each is exactly a 24-bit integer multiplied by a power of two;
+			// use that to express their ratio as an exact fraction.
+			int input_exponent, output_exponent;
+			uint64_t numerator = uint64_t(std::ldexp(std::frexp(double(input_cycles_per_second), &input_exponent), 24));
+			uint64_t denominator = uint64_t(std::ldexp(std::frexp(double(output_cycles_per_second), &output_exponent), 24));
+			const int shift = input_exponent - output_exponent;
+			if(shift > 0) {
+				numerator <<= std::min(shift, 39);
 			} else {
-				output_buffer_[output_buffer_pointer_] = filter_->apply(input_buffer_.data());
-				output_buffer_pointer_++;
+				denominator <<= std::min(-shift, 39);
 			}
 
-			// Apply scale, if supplied, clamping appropriately.
-			if(scale != 65536) {
-				#define SCALE(x) x = int16_t(std::clamp((int(x) * scale) >> 16, -32768, 32767))
-				if constexpr (is_stereo) {
-					SCALE(output_buffer_[output_buffer_pointer_ - 2]);
-					SCALE(output_buffer_[output_buffer_pointer_ - 1]);
-				} else {
-					SCALE(output_buffer_[output_buffer_pointer_ - 1]);
+			const auto divisor = std::gcd(numerator, denominator);
+			numerator /= divisor;
+			denominator /= divisor;
+
+			step_whole_ = numerator / denominator;
+			step_numerator_ = numerator % denominator;
+			step_denominator_ = denominator;
+		}
+
+		inline void resample_input_buffer(int scale) {
+			constexpr size_t channels = is_stereo + 1;
+			const size_t depth = input_buffer_depth_ / channels;
+			const uint64_t buffer_start = samples_read_ - depth;
+
+			// Produce an output sample for every complete window in the buffer, plus the rest of
+			// the run of repeated samples that it ends within.
+			const size_t window_size = filter_->get_number_of_taps() + sample_period_ - 1;
+			while(window_start_ + window_size <= depth) {
+				if(!output_buffer_.empty()) {
+					const int16_t *window = &input_buffer_[window_start_ * channels];
+					const SignalProcessing::FIRFilter *filter = filter_.get();
+					if(sample_period_ > 1) {
+						const size_t phase = size_t((buffer_start + window_start_) % sample_period_);
+						window += (sample_period_ - 1 - phase) * channels;
+						filter = &phase_filters_[phase];
+					}
+
+					if constexpr (is_stereo) {
+						output_buffer_[output_buffer_pointer_ + 0] = filter->apply(window, 2 * sample_period_);
+						output_buffer_[output_buffer_pointer_ + 1] = filter->apply(window + 1, 2 * sample_period_);
+						output_buffer_pointer_+= 2;
+					} else {
+						output_buffer_[output_buffer_pointer_] = filter->apply(window, sample_period_);
+						output_buffer_pointer_++;
+					}
+
+					// Apply scale, if supplied, clamping appropriately.
+					if(scale != 65536) {
+						#define SCALE(x) x = int16_t(std::clamp((int(x) * scale) >> 16, -32768, 32767))
+						if constexpr (is_stereo) {
+							SCALE(output_buffer_[output_buffer_pointer_ - 2]);
+							SCALE(output_buffer_[output_buffer_pointer_ - 1]);
+						} else {
+							SCALE(output_buffer_[output_buffer_pointer_ - 1]);
+						}
+						#undef SCALE
+					}
+
+					// Announce to delegate if full.
+					if(output_buffer_pointer_ == output_buffer_.size()) {
+						output_buffer_pointer_ = 0;
+						did_complete_samples(this, output_buffer_, is_stereo);
+					}
 				}
-				#undef SCALE
-			}
 
-			// Announce to delegate if full.
-			if(output_buffer_pointer_ == output_buffer_.size()) {
-				output_buffer_pointer_ = 0;
-				did_complete_samples(this, output_buffer_, is_stereo);
+				// Advance to the next window, with no accumulated error.
+				window_start_ += step_whole_;
+				step_error_ += step_numerator_;
+				if(step_error_ >= step_denominator_) {
+					step_error_ -= step_denominator_;
+					++window_start_;
+				}
 			}
 
-			// If the next loop around is going to reuse some of the samples just collected, use a memmove to
-			// preserve them in the correct locations (TODO: use a longer buffer to fix that?) and don't skip
-			// anything. Otherwise skip as required to get to the next sample batch and don't expect to reuse.
-			const size_t steps = size_t(step_rate_ + position_error_) * (is_stereo + 1);
-			position_error_ = fmodf(step_rate_ + position_error_, 1.0f);
-			if(steps < input_buffer_.size()) {
+			// Move whatever may yet be reused to the front of the buffer. If the next window starts
+			// beyond the current input then just leave it to begin part way into the next fill.
+			if(window_start_ < depth) {
 				auto *const input_buffer = input_buffer_.data();
 				std::memmove(	input_buffer,
-								&input_buffer[steps],
-								sizeof(int16_t) * (input_buffer_.size() - steps));
-				input_buffer_depth_ -= steps;
+								&input_buffer[window_start_ * channels],
+								sizeof(int16_t) * (depth - window_start_) * channels);
+				input_buffer_depth_ = (depth - window_start_) * channels;
+				window_start_ = 0;
 			} else {
-				if(steps > input_buffer_.size()) {
-					static_cast<ConcreteT *>(this)->skip_samples((steps - input_buffer_.size()) / (1 + is_stereo));
-				}
+				window_start_ -= depth;
 				input_buffer_depth_ = 0;
 			}
 		}
@@ -254,6 +333,7 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 						const auto samples_to_read = std::min((output_buffer_.size() - output_buffer_pointer_) / (1 + is_stereo), length);
 						static_cast<ConcreteT *>(this)->get_samples(samples_to_read, &output_buffer_[output_buffer_pointer_ ]);
 						output_buffer_pointer_ += samples_to_read * (1 + is_stereo);
+						samples_read_ += samples_to_read;
 
 						// TODO: apply scale.
 
@@ -272,6 +352,7 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 						const auto cycles_to_read = std::min((input_buffer_.size() - input_buffer_depth_) / (1 + is_stereo), length);
 						static_cast<ConcreteT *>(this)->get_samples(cycles_to_read, &input_buffer_[input_buffer_depth_]);
 						input_buffer_depth_ += cycles_to_read * (1 + is_stereo);
+						samples_read_ += cycles_to_read;
 
 						if(input_buffer_depth_ == input_buffer_.size()) {
 							resample_input_buffer(scale);
@@ -304,12 +385,12 @@ template <bool is_stereo> class PushLowpass: public LowpassBase<PushLowpass<is_s
 			return scale_;
 		}
 
-		const int16_t *buffer_ = nullptr;
-
-		void skip_samples(size_t count) {
-			buffer_ += count;
+		size_t get_sample_period() {
+			return 1;
 		}
 
+		const int16_t *buffer_ = nullptr;
+
 		void get_samples(size_t length, int16_t *target) {
 			const auto word_length = length * (1 + is_stereo);
 			memcpy(target, buffer_, word_length * sizeof(int16_t));
@@ -396,14 +477,14 @@ template <typename SampleSource> class PullLowpass: public LowpassBase<PullLowpa
 
 		SampleSource &sample_source_;
 
-		void skip_samples(size_t count) {
-			sample_source_.skip_samples(count);
-		}
-
 		int get_scale() {
 			return int(65536.0 / sample_source_.get_average_output_peak());
 		}
 
+		size_t get_sample_period() {
+			return sample_source_.get_sample_period();
+		}
+
 		void get_samples(size_t length, int16_t *target) {
 			sample_source_.get_samples(length, target);
 		}
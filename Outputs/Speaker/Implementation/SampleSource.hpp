@@ -68,6 +68,17 @@ class SampleSource {
 			represent changes in hardware configuration.
 		*/
 		double get_average_output_peak() const { return 1.0; }
+
+		/*!
+			Permits a sample source to declare that it changes output only at sample indices that
+			are multiples of the returned value, counting from the first sample it ever produces;
+			i.e. that it repeats each sample for a fixed period. Speakers may use this to reduce
+			the cost of filtering, at the expense of observing any change to the output that is
+			prompted by some other means, such as a register write, up to one period early.
+
+			The value should not vary over time.
+		*/
+		std::size_t get_sample_period() const { return 1; }
 };
 
 }
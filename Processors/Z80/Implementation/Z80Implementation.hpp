@@ -60,10 +60,11 @@ template <	class T,
 	flag_adjustment_history_ |= 1;
 
 #define set_parity(v)	\
-	parity_overflow_result_ = uint8_t(v^1);\
-	parity_overflow_result_ ^= parity_overflow_result_ >> 4;\
-	parity_overflow_result_ ^= parity_overflow_result_ << 2;\
-	parity_overflow_result_ ^= parity_overflow_result_ >> 1;
+	parity_overflow_result_ = flag_tables_.parity[uint8_t(v)];
+
+// SCF and CCF copy A into bits 5 and 3 if the previous operation set flags; otherwise they OR it in.
+#define set_scf_ccf_bit53()	\
+	bit53_result_ = a_ | (bit53_result_ & uint8_t(((flag_adjustment_history_ >> 1) & 1) - 1));
 
 			switch(operation->type) {
 				case MicroOp::BusOperation:
@@ -155,11 +156,7 @@ template <	class T,
 					half_carry_result_ = uint8_t(carry_result_ << 4);
 					carry_result_ ^= Flag::Carry;
 					subtract_flag_ = 0;
-					if(flag_adjustment_history_&2) {
-						bit53_result_ = a_;
-					} else {
-						bit53_result_ |= a_;
-					}
+					set_scf_ccf_bit53();
 					set_did_compute_flags();
 				break;
 
@@ -167,11 +164,7 @@ template <	class T,
 					carry_result_ = Flag::Carry;
 					half_carry_result_ = 0;
 					subtract_flag_ = 0;
-					if(flag_adjustment_history_&2) {
-						bit53_result_ = a_;
-					} else {
-						bit53_result_ |= a_;
-					}
+					set_scf_ccf_bit53();
 					set_did_compute_flags();
 				break;
 
@@ -267,13 +260,15 @@ template <	class T,
 #undef set_arithmetic_flags
 
 				case MicroOp::NEG: {
-					const int overflow = (a_ == 0x80);
 					const int result = -a_;
 					const int halfResult = -(a_&0xf);
 
+					// overflow occurs only for 0x80, the one value that is negative both before and after
+					const int overflow = a_ & result;
+
 					a_ = uint8_t(result);
 					bit53_result_ = sign_result_ = zero_result_ = a_;
-					parity_overflow_result_ = overflow ? Flag::Overflow : 0;
+					parity_overflow_result_ = uint8_t(overflow >> 5) & Flag::Overflow;
 					subtract_flag_ = Flag::Subtract;
 					carry_result_ = uint8_t(result >> 8);
 					half_carry_result_ = uint8_t(halfResult);
@@ -319,45 +314,18 @@ template <	class T,
 				} break;
 
 				case MicroOp::DAA: {
-					const int lowNibble = a_ & 0xf;
-					const int highNibble = a_ >> 4;
-					int amountToAdd = 0;
-
-					if(carry_result_ & Flag::Carry) {
-						amountToAdd = (lowNibble > 0x9 || (half_carry_result_ & Flag::HalfCarry)) ? 0x66 : 0x60;
-					} else {
-						if(half_carry_result_ & Flag::HalfCarry) {
-							if(lowNibble > 0x9)
-								amountToAdd = (highNibble > 0x8) ? 0x66 : 0x06;
-							else
-								amountToAdd = (highNibble > 0x9) ? 0x66 : 0x06;
-						} else {
-							if(lowNibble > 0x9)
-								amountToAdd = (highNibble > 0x8) ? 0x66 : 0x06;
-							else
-								amountToAdd = (highNibble > 0x9) ? 0x60 : 0x00;
-						}
-					}
-
-					if(!(carry_result_ & Flag::Carry)) {
-						if(lowNibble > 0x9) {
-							if(highNibble > 0x8) carry_result_ = Flag::Carry;
-						} else {
-							if(highNibble > 0x9) carry_result_ = Flag::Carry;
-						}
-					}
-
-					if(subtract_flag_) {
-						a_ -= amountToAdd;
-						half_carry_result_ = ((half_carry_result_ & Flag::HalfCarry) && lowNibble < 0x6) ? Flag::HalfCarry : 0;
-					} else {
-						a_ += amountToAdd;
-						half_carry_result_ = (lowNibble > 0x9) ? Flag::HalfCarry : 0;
-					}
-
+					const uint16_t result = flag_tables_.daa[
+						a_ |
+						((carry_result_ & Flag::Carry) << 8) |
+						((half_carry_result_ & Flag::HalfCarry) << 5) |
+						(subtract_flag_ << 9)
+					];
+
+					a_ = uint8_t(result >> 8);
 					sign_result_ = zero_result_ = bit53_result_ = a_;
-
-					set_parity(a_);
+					carry_result_ = result & Flag::Carry;
+					half_carry_result_ = result & Flag::HalfCarry;
+					parity_overflow_result_ = result & Flag::Parity;
 					set_did_compute_flags();
 				} break;
 
@@ -891,6 +859,7 @@ template <	class T,
 				return;
 			}
 #undef set_parity
+#undef set_scf_ccf_bit53
 		}
 
 	}
@@ -12,7 +12,14 @@
 using namespace CPU::Z80;
 
 ProcessorStorage::ProcessorStorage() {
+	// Register contents are undefined at power on other than that AF and SP are usually
+	// observed to be all 1s; use that for everything so that startup is deterministic.
+	a_ = 0xff;
 	set_flags(0xff);
+	for(auto pair: {&bc_, &de_, &hl_, &af_dash_, &bc_dash_, &de_dash_, &hl_dash_, &ix_, &iy_, &pc_, &sp_, &ir_, &refresh_addr_, &temp16_, &memptr_}) {
+		pair->full = 0xffff;
+	}
+	operation_ = temp8_ = 0xff;
 }
 
 // Elemental bus operations
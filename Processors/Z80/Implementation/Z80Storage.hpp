@@ -11,8 +11,54 @@
 	class in order to remove it from visibility within the main Z80.hpp.
 */
 
+/*!
+	Flag outcomes that are cheaper to look up than to compute: parity for every 8-bit value,
+	and the complete result of DAA for every combination of A, carry, half-carry and subtract.
+*/
+struct FlagTables {
+	/// Flag::Parity if the index has even parity; 0 otherwise.
+	uint8_t parity[256]{};
+
+	/// Indexed by A | (C << 8) | (H << 9) | (N << 10); the high byte holds the new value
+	/// of A, the low byte holds the resulting carry, half-carry and parity flags.
+	uint16_t daa[2048]{};
+
+	constexpr FlagTables() {
+		for(int c = 0; c < 256; c++) {
+			int v = c ^ (c >> 4);
+			v ^= v >> 2;
+			v ^= v >> 1;
+			parity[c] = (v & 1) ? 0 : Flag::Parity;
+		}
+
+		for(int c = 0; c < 2048; c++) {
+			const int a = c & 0xff;
+			const bool carry = c & 0x100;
+			const bool half_carry = c & 0x200;
+			const bool subtract = c & 0x400;
+
+			const int low_nibble = a & 0xf;
+			const int adjust_low = (half_carry || low_nibble > 0x9) ? 0x06 : 0x00;
+			const bool carry_out = carry || a > 0x99;
+			const int adjustment = adjust_low | (carry_out ? 0x60 : 0x00);
+
+			const uint8_t result = uint8_t(subtract ? a - adjustment : a + adjustment);
+			const bool half_carry_out = subtract ? (half_carry && low_nibble < 0x6) : (low_nibble > 0x9);
+
+			daa[c] = uint16_t(
+				(result << 8) |
+				(carry_out ? Flag::Carry : 0) |
+				(half_carry_out ? Flag::HalfCarry : 0) |
+				parity[result]
+			);
+		}
+	}
+};
+
 class ProcessorStorage {
 	protected:
+		static constexpr FlagTables flag_tables_{};
+
 		struct MicroOp {
 			enum Type {
 				BusOperation,
@@ -51,6 +51,15 @@ State::State(const ProcessorBase &src): State() {
 	execution_state.refresh_address = src.refresh_addr_.full;
 	execution_state.half_cycles_into_step = src.number_of_cycles_.as<int>();
 
+	// A processor that has never run will begin with its power-on reset; capture it as having
+	// already started that, exactly as it will when first run.
+	if(!src.scheduled_program_counter_) {
+		execution_state.requests &= ~ProcessorStorage::PowerOn;
+		execution_state.phase = ExecutionState::Phase::Reset;
+		execution_state.steps_into_phase = 0;
+		return;
+	}
+
 	// Search for the current holder of the scheduled_program_counter_.
 #define ContainedBy(x)	(src.scheduled_program_counter_ >= &src.x[0]) && (src.scheduled_program_counter_ < &src.x[src.x.size()])
 #define Populate(x, y)	\
@@ -158,7 +167,7 @@ void State::apply(ProcessorBase &target) {
 		case ExecutionState::Phase::IRQMode2:					target.scheduled_program_counter_ = &target.irq_program_[2][0];											break;
 		case ExecutionState::Phase::NMI:						target.scheduled_program_counter_ = &target.nmi_program_[0];											break;
 		case ExecutionState::Phase::FetchDecode:				target.scheduled_program_counter_ = &target.current_instruction_page_->fetch_decode_execute[0];			break;
-		case ExecutionState::Phase::Operation:					target.scheduled_program_counter_ = target.current_instruction_page_->instructions[target.operation_];	break;
+		case ExecutionState::Phase::Operation:					target.scheduled_program_counter_ = target.current_instruction_page_->instructions[target.operation_ & target.halt_mask_];	break;
 	}
 	target.scheduled_program_counter_ += execution_state.steps_into_phase;
 }
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <iomanip>
 #include <iterator>
 #include <sstream>
@@ -68,7 +69,7 @@ template <> bool Reflection::set(Struct &target, const std::string &name, int64_
 		return true;
 	}
 
-#define SetInt(x)	if(*target_type == typeid(x)) { x truncated_value = x(value); target.set(name, &truncated_value, offset); }
+#define SetInt(x)	if(*target_type == typeid(x)) { x truncated_value = x(value); target.set(name, &truncated_value, offset); return true; }
 	ForAllInts(SetInt);
 #undef SetInt
 
@@ -110,7 +111,8 @@ template <> bool Reflection::set(Struct &target, const std::string &name, bool v
 	if(!target_type) return false;
 
 	if(*target_type == typeid(bool)) {
-		target.set(name, &value, offset);;
+		target.set(name, &value, offset);
+		return true;
 	}
 
 	return false;
@@ -122,9 +124,9 @@ bool Reflection::fuzzy_set(Struct &target, const std::string &name, const std::s
 	const auto target_type = target.type_of(name);
 	if(!target_type) return false;
 
-	// If the target is a registered enum, ttry to convert the value. Failing that,
+	// If the target is a registered enum, try to convert the value. Failing that,
 	// try to match without case sensitivity.
-	if(Reflection::Enum::size(*target_type)) {
+	if(!Reflection::Enum::name(*target_type).empty()) {
 		const int from_string = Reflection::Enum::from_string(*target_type, value);
 		if(from_string >= 0) {
 			target.set(name, &from_string);
@@ -153,7 +155,35 @@ bool Reflection::fuzzy_set(Struct &target, const std::string &name, const std::s
 		return false;
 	}
 
-	return false;
+	// If the target is a bool, accept the usual affirmatives and negatives.
+	if(*target_type == typeid(bool)) {
+		std::string lower_value;
+		std::transform(value.begin(), value.end(), std::back_inserter(lower_value), [] (char c) { return char(tolower(c)); });
+
+		static const char *const affirmatives[] = {"true", "yes", "y", "on", "1"};
+		static const char *const negatives[] = {"false", "no", "n", "off", "0"};
+		for(const auto affirmative: affirmatives) {
+			if(lower_value == affirmative) return set(target, name, true);
+		}
+		for(const auto negative: negatives) {
+			if(lower_value == negative) return set(target, name, false);
+		}
+		return false;
+	}
+
+	// Otherwise the value must be a number in its entirety.
+	if(value.empty()) return false;
+	char *end;
+
+	if(*target_type == typeid(float) || *target_type == typeid(double)) {
+		const double double_value = strtod(value.c_str(), &end);
+		if(*end) return false;
+		return set(target, name, double_value);
+	}
+
+	const int64_t int_value = strtoll(value.c_str(), &end, 0);
+	if(*end) return false;
+	return set(target, name, int_value);
 }
 
 
@@ -278,7 +308,7 @@ std::vector<uint8_t> Reflection::Struct::serialise() const {
 		if(!Reflection::Enum::name(*type).empty()) {
 			int value;
 			Reflection::get(*this, key, value, offset);
-			const auto text = Reflection::Enum::to_string(*type, 0);
+			const auto text = Reflection::Enum::to_string(*type, value);
 			push_string(text);
 			return;
 		}
@@ -448,13 +478,14 @@ bool Reflection::Struct::deserialise(const uint8_t *bson, size_t size) {
 	// Validate the object's declared size.
 	const auto end = bson + size;
 	auto read_int = [&bson] (auto &target) {
-		constexpr auto shift = 8 * (sizeof(target) - 1);
-		target = 0;
+		// Assemble in an unsigned type; shifting a signed one would extend its sign.
+		using IntT = std::remove_reference_t<decltype(target)>;
+		std::make_unsigned_t<IntT> value = 0;
 		for(size_t c = 0; c < sizeof(target); ++c) {
-			target >>= 8;
-			target |= decltype(target)(*bson) << shift;
+			value |= decltype(value)(*bson) << (8 * c);
 			++bson;
 		}
+		target = IntT(value);
 	};
 
 	uint32_t object_size;
@@ -494,6 +525,9 @@ bool Reflection::Struct::deserialise(const uint8_t *bson, size_t size) {
 				}
 
 				if(next_type == 0x05 && *type == typeid(std::vector<uint8_t>)) {
+					// Skip the binary subtype; serialise always writes 0x00, generic binary.
+					++bson;
+
 					auto child = reinterpret_cast<std::vector<uint8_t> *>(get(key));
 					*child = std::vector<uint8_t>(bson, bson + subobject_size);
 					bson += subobject_size;
@@ -377,7 +377,7 @@ template <typename Type> bool get(const Struct &target, const std::string &name,
 	// If the type is a registered enum and the value type is int, copy.
 	if constexpr (std::is_integral<Type>::value && sizeof(Type) == sizeof(int)) {
 		if(!Enum::name(*target_type).empty()) {
-			memcpy(&value, target.get(name), sizeof(int));
+			memcpy(&value, reinterpret_cast<const uint8_t *>(target.get(name)) + offset * sizeof(int), sizeof(int));
 			return true;
 		}
 	}
@@ -8,6 +8,7 @@
 
 #include "FIRFilter.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 #ifndef M_PI
@@ -175,3 +176,20 @@ FIRFilter FIRFilter::operator*(const FIRFilter &rhs) const {
 
 	return FIRFilter(sum);
 }
+
+FIRFilter FIRFilter::decimated(std::size_t period, std::size_t phase) const {
+	// Each run of identical samples contributes its value multiplied by the sum of the
+	// coefficients that fall within it; sum in fixed point so that results are exact.
+	FIRFilter result;
+	result.filter_coefficients_.resize((filter_coefficients_.size() + phase + period - 1) / period);
+
+	std::vector<int> sums(result.filter_coefficients_.size());
+	for(std::size_t c = 0; c < filter_coefficients_.size(); ++c) {
+		sums[(c + phase) / period] += filter_coefficients_[c];
+	}
+	for(std::size_t c = 0; c < sums.size(); ++c) {
+		result.filter_coefficients_[c] = short(std::clamp(sums[c], -32768, 32767));
+	}
+
+	return result;
+}
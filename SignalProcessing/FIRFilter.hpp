@@ -93,7 +93,19 @@ class FIRFilter {
 		*/
 		FIRFilter operator-() const;
 
+		/*!
+			Provides the equivalent of this filter for input that is known to consist of runs of
+			@c period identical samples, reading only the final sample of each run.
+
+			@param period The length of each run.
+			@param phase The offset into its run of the first sample that this filter would read.
+			@returns A filter that gives the same result as this one when applied with a stride of
+				@c period, starting from the final sample of the run that contains this filter's first sample.
+		*/
+		FIRFilter decimated(std::size_t period, std::size_t phase) const;
+
 	private:
+		FIRFilter() = default;
 		std::vector<short> filter_coefficients_;
 
 		static void coefficients_for_idealised_filter_response(short *filterCoefficients, float *A, float attenuation, std::size_t numberOfTaps);
@@ -50,6 +50,20 @@ Drive &Controller::get_drive() {
 	return *drive_;
 }
 
+size_t Controller::get_memory_usage() const {
+	MemoryUsage usage;
+	for(const auto &drive: drives_) {
+		drive->add_memory_usage(usage);
+	}
+	return usage.total();
+}
+
+void Controller::set_memory_budget(size_t bytes) {
+	for(auto &drive: drives_) {
+		drive->set_memory_budget(bytes);
+	}
+}
+
 // MARK: - Drive::EventDelegate
 
 void Controller::process_event(const Drive::Event &event) {
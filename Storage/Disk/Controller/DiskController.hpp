@@ -31,6 +31,18 @@ class Controller:
 	public ClockingHint::Source,
 	private Drive::EventDelegate,
 	private ClockingHint::Observer {
+	public:
+		/*!
+			@returns The approximate number of bytes of track content currently held in memory by all
+			drives attached to this controller; see @c Drive::get_memory_usage.
+		*/
+		size_t get_memory_usage() const;
+
+		/*!
+			Sets the track-caching budget of every drive attached to this controller; see @c Drive::set_memory_budget.
+		*/
+		void set_memory_budget(size_t bytes);
+
 	protected:
 		/*!
 			Constructs a @c Controller that will be run at @c clock_rate.
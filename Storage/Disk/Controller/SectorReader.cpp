@@ -0,0 +1,32 @@
+//
+//  SectorReader.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "SectorReader.hpp"
+
+#include <cstring>
+
+using namespace Storage::Disk;
+
+SectorReader::SectorReader(const Drive &drive, bool is_mfm) {
+	if(drive.get_disk()) {
+		parser_ = std::make_unique<Encodings::MFM::Parser>(is_mfm, drive.get_disk());
+	}
+}
+
+SectorReader::Result SectorReader::read(int head, int track, uint8_t sector, uint8_t *target, std::size_t size) {
+	if(!parser_) return Result::NoDisk;
+
+	const auto found = parser_->get_sector(head, track, sector);
+	if(!found || found->samples.empty()) return Result::NotFound;
+	if(found->has_data_crc_error) return Result::CRCError;
+
+	const auto &data = found->samples.front();
+	if(data.size() != size) return Result::WrongSize;
+	std::memcpy(target, data.data(), size);
+	return Result::Success;
+}
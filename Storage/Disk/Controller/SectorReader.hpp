@@ -0,0 +1,58 @@
+//
+//  SectorReader.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef SectorReader_hpp
+#define SectorReader_hpp
+
+#include "../Drive.hpp"
+#include "../Encodings/MFM/Parser.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Storage::Disk {
+
+/*!
+	Provides immediate, untimed access to the sectors on the disk in a drive, for machines
+	that trap their DOS's sector-read routine rather than run it against an emulated controller.
+
+	A SectorReader caches each track that it decodes so should be constructed afresh for each
+	trapped call, as the disk may subsequently be written to.
+*/
+class SectorReader {
+	public:
+		SectorReader(const Drive &drive, bool is_mfm = true);
+
+		enum class Result {
+			/// The sector was found and read without error.
+			Success,
+			/// The drive is empty.
+			NoDisk,
+			/// No sector with the requested address was found.
+			NotFound,
+			/// The sector was found but its data CRC was wrong.
+			CRCError,
+			/// The sector was found but isn't of the requested size.
+			WrongSize,
+		};
+
+		/*!
+			Copies the sector with logical ID @c sector on physical @c track of side @c head into
+			@c target, provided that it is exactly @c size bytes long; otherwise @c target is left
+			unmodified.
+		*/
+		Result read(int head, int track, uint8_t sector, uint8_t *target, std::size_t size);
+
+	private:
+		std::unique_ptr<Encodings::MFM::Parser> parser_;
+};
+
+}
+
+#endif /* SectorReader_hpp */
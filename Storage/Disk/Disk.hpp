@@ -66,6 +66,17 @@ class Disk {
 				This can avoid some degree of work when disk images offer sub-head-position precision.
 		*/
 		virtual bool tracks_differ(Track::Address, Track::Address) = 0;
+
+		/*!
+			Adds the approximate number of bytes of track content currently held in memory by this disk to @c usage.
+		*/
+		virtual void add_memory_usage(MemoryUsage &) {}
+
+		/*!
+			Sets the number of bytes of track content that this disk may cache. Tracks with unwritten
+			changes are retained regardless. Defaults to unlimited.
+		*/
+		virtual void set_memory_budget(size_t) {}
 };
 
 }
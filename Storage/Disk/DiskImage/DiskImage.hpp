@@ -9,11 +9,14 @@
 #ifndef DiskImage_hpp
 #define DiskImage_hpp
 
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
 
 #include "../Disk.hpp"
 #include "../Track/Track.hpp"
+#include "../Track/TrackStore.hpp"
 #include "../../TargetPlatforms.hpp"
 
 namespace Storage::Disk {
@@ -78,8 +81,17 @@ class DiskImage {
 class DiskImageHolderBase: public Disk {
 	protected:
 		std::set<Track::Address> unwritten_tracks_;
-		std::map<Track::Address, std::shared_ptr<Track>> cached_tracks_;
 		std::unique_ptr<Concurrency::AsyncTaskQueue<true>> update_queue_;
+
+		// Tracks are cached subject to a memory budget; the least-recently used are
+		// evicted first, other than those with unwritten changes.
+		struct CachedTrack {
+			std::shared_ptr<Track> track;
+			uint64_t last_use = 0;
+		};
+		std::map<Track::Address, CachedTrack> cached_tracks_;
+		size_t memory_budget_ = std::numeric_limits<size_t>::max();
+		uint64_t use_count_ = 0;
 };
 
 /*!
@@ -87,6 +99,12 @@ class DiskImageHolderBase: public Disk {
 	thereby, an intermediate store for modified tracks so that mutable disk images can either
 	update on the fly or perform a block update on closure, as appropriate.
 
+	Tracks obtained from the underlying image are deduplicated via the TrackStore, so identical tracks
+	share their data both within this disk and with any other disk currently loaded.
+
+	If a memory budget is set then unmodified tracks are evicted from the cache as necessary to stay within
+	it; they will be reobtained from the underlying image if requested again.
+
 	Implements TargetPlatform::TypeDistinguisher to return either no information whatsoever, if
 	the underlying image doesn't implement TypeDistinguisher, or else to pass the call along.
 */
@@ -103,10 +121,15 @@ template <typename T> class DiskImageHolder: public DiskImageHolderBase, public
 		void flush_tracks();
 		bool get_is_read_only();
 		bool tracks_differ(Track::Address lhs, Track::Address rhs);
+		void add_memory_usage(MemoryUsage &);
+		void set_memory_budget(size_t);
 
 	private:
 		T disk_image_;
 
+		void cache_track(Track::Address address, const std::shared_ptr<Track> &track);
+		void evict_tracks();
+
 		TargetPlatform::Type target_platform_type() final {
 			if constexpr (std::is_base_of<TargetPlatform::TypeDistinguisher, T>::value) {
 				return static_cast<TargetPlatform::TypeDistinguisher *>(&disk_image_)->target_platform_type();
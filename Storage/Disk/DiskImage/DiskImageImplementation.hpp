@@ -25,13 +25,16 @@ template <typename T> void DiskImageHolder<T>::flush_tracks() {
 		using TrackMap = std::map<Track::Address, std::shared_ptr<Track>>;
 		std::shared_ptr<TrackMap> track_copies(new TrackMap);
 		for(const auto &address : unwritten_tracks_) {
-			track_copies->insert(std::make_pair(address, std::shared_ptr<Track>(cached_tracks_[address]->clone())));
+			track_copies->insert(std::make_pair(address, std::shared_ptr<Track>(cached_tracks_[address].track->clone())));
 		}
 		unwritten_tracks_.clear();
 
 		update_queue_->enqueue([this, track_copies]() {
 			disk_image_.set_tracks(*track_copies);
 		});
+
+		// Tracks that were just written are now eligible for eviction.
+		evict_tracks();
 	}
 }
 
@@ -39,7 +42,7 @@ template <typename T> void DiskImageHolder<T>::set_track_at_position(Track::Addr
 	if(disk_image_.get_is_read_only()) return;
 
 	unwritten_tracks_.insert(address);
-	cached_tracks_[address] = track;
+	cache_track(address, track);
 }
 
 template <typename T> std::shared_ptr<Track> DiskImageHolder<T>::get_track_at_position(Track::Address address) {
@@ -47,14 +50,66 @@ template <typename T> std::shared_ptr<Track> DiskImageHolder<T>::get_track_at_po
 	if(address.position >= get_maximum_head_position()) return nullptr;
 
 	auto cached_track = cached_tracks_.find(address);
-	if(cached_track != cached_tracks_.end()) return cached_track->second;
+	if(cached_track != cached_tracks_.end()) {
+		cached_track->second.last_use = ++use_count_;
+		return cached_track->second.track;
+	}
 
-	std::shared_ptr<Track> track = disk_image_.get_track_at_position(address);
+	// This track may previously have been written and then evicted; ensure that any such write
+	// has reached the disk image before reading from it.
+	if(update_queue_) update_queue_->flush();
+
+	std::shared_ptr<Track> track = TrackStore::deduplicated(disk_image_.get_track_at_position(address));
 	if(!track) return nullptr;
-	cached_tracks_[address] = track;
+	cache_track(address, track);
 	return track;
 }
 
+template <typename T> void DiskImageHolder<T>::cache_track(Track::Address address, const std::shared_ptr<Track> &track) {
+	auto &entry = cached_tracks_[address];
+	entry.track = track;
+	entry.last_use = ++use_count_;
+
+	evict_tracks();
+}
+
+template <typename T> void DiskImageHolder<T>::evict_tracks() {
+	if(memory_budget_ == std::numeric_limits<size_t>::max()) return;
+
+	while(true) {
+		MemoryUsage usage;
+		add_memory_usage(usage);
+		if(usage.total() <= memory_budget_) return;
+
+		// Find the least-recently used track that can be evicted; the most-recently used
+		// is always retained as it's the one most likely to be under a head right now.
+		auto victim = cached_tracks_.end();
+		for(auto iterator = cached_tracks_.begin(); iterator != cached_tracks_.end(); ++iterator) {
+			if(iterator->second.last_use == use_count_ || unwritten_tracks_.find(iterator->first) != unwritten_tracks_.end()) {
+				continue;
+			}
+			if(victim == cached_tracks_.end() || iterator->second.last_use < victim->second.last_use) {
+				victim = iterator;
+			}
+		}
+		if(victim == cached_tracks_.end()) return;
+
+		cached_tracks_.erase(victim);
+	}
+}
+
+template <typename T> void DiskImageHolder<T>::add_memory_usage(MemoryUsage &usage) {
+	// Deduplicated tracks may be cached at several addresses, but are counted only once.
+	for(const auto &cached_track: cached_tracks_) {
+		cached_track.second.track->add_memory_usage(usage);
+	}
+}
+
+template <typename T> void DiskImageHolder<T>::set_memory_budget(size_t bytes) {
+	memory_budget_ = bytes;
+	evict_tracks();
+}
+
 template <typename T> DiskImageHolder<T>::~DiskImageHolder() {
 	if(update_queue_) update_queue_->flush();
 }
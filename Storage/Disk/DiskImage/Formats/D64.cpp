@@ -39,23 +39,40 @@ HeadPosition D64::get_maximum_head_position() {
 	return HeadPosition(number_of_tracks_);
 }
 
-std::shared_ptr<Track> D64::get_track_at_position(Track::Address address) {
-	// figure out where this track starts on the disk
-	int offset_to_track = 0;
-	int tracks_to_traverse = address.position.as_int();
-
-	int zone_sizes[] = {17, 7, 6, 10};
-	int sectors_by_zone[] = {21, 19, 18, 17};
-	int zone = 0;
-	for(int current_zone = 0; current_zone < 4; current_zone++) {
-		int tracks_in_this_zone = std::min(tracks_to_traverse, zone_sizes[current_zone]);
-		offset_to_track += tracks_in_this_zone * sectors_by_zone[current_zone];
-		tracks_to_traverse -= tracks_in_this_zone;
-		if(tracks_in_this_zone == zone_sizes[current_zone]) zone++;
+namespace {
+
+constexpr int MaxTracks = 40;
+
+/// Provides the number of sectors on each track, and the offset in sectors to the start of each track.
+struct TrackLayout {
+	constexpr TrackLayout() {
+		int offset = 0;
+		for(int track = 0; track < MaxTracks; track++) {
+			// Zones are: tracks 1–17, 21 sectors; 18–24, 19 sectors; 25–30, 18 sectors; 31+, 17 sectors.
+			const int sectors = track < 17 ? 21 : (track < 24 ? 19 : (track < 30 ? 18 : 17));
+			sectors_per_track[track] = sectors;
+			sector_offsets[track] = offset;
+			offset += sectors;
+		}
 	}
 
+	int sectors_per_track[MaxTracks]{};
+	int sector_offsets[MaxTracks]{};
+};
+constexpr TrackLayout track_layout;
+
+}
+
+bool D64::tracks_differ(Track::Address lhs, Track::Address rhs) {
+	return lhs.head != rhs.head || lhs.position.as_int() != rhs.position.as_int();
+}
+
+std::shared_ptr<Track> D64::get_track_at_position(Track::Address address) {
+	const int track = address.position.as_int();
+
 	// seek to start of data
-	file_.seek(offset_to_track * 256, SEEK_SET);
+	const int sectors = track_layout.sectors_per_track[track];
+	file_.seek(track_layout.sector_offsets[track] * 256, SEEK_SET);
 
 	// build up a PCM sampling of the GCR version of this track
 
@@ -79,36 +96,34 @@ std::shared_ptr<Track> D64::get_track_at_position(Track::Address address) {
 	//
 	// = 349 GCR bytes per sector
 
-	std::size_t track_bytes = 349 * size_t(sectors_by_zone[zone]);
+	std::size_t track_bytes = 349 * size_t(sectors);
 	std::vector<uint8_t> data(track_bytes);
 
-	for(int sector = 0; sector < sectors_by_zone[zone]; sector++) {
+	// Read the whole track's contents at once.
+	std::vector<uint8_t> contents(size_t(sectors) * 256);
+	file_.read(contents.data(), contents.size());
+
+	for(int sector = 0; sector < sectors; sector++) {
 		uint8_t *sector_data = &data[size_t(sector) * 349];
 		sector_data[0] = sector_data[1] = sector_data[2] = 0xff;
 
-		uint8_t sector_number = uint8_t(sector);						// sectors count from 0
-		uint8_t track_number = uint8_t(address.position.as_int() + 1);	// tracks count from 1
+		uint8_t sector_number = uint8_t(sector);			// sectors count from 0
+		uint8_t track_number = uint8_t(track + 1);			// tracks count from 1
 		uint8_t checksum = uint8_t(sector_number ^ track_number ^ disk_id_ ^ (disk_id_ >> 8));
-		uint8_t header_start[4] = {
-			0x08, checksum, sector_number, track_number
-		};
-		Encodings::CommodoreGCR::encode_block(&sector_data[3], header_start);
+		const uint8_t header[12] = {
+			0x08, checksum, sector_number, track_number,
+			uint8_t(disk_id_ & 0xff), uint8_t(disk_id_ >> 8), 0, 0,
 
-		uint8_t header_end[4] = {
-			uint8_t(disk_id_ & 0xff), uint8_t(disk_id_ >> 8), 0, 0
+			// pad out post-header parts
+			0, 0, 0, 0
 		};
-		Encodings::CommodoreGCR::encode_block(&sector_data[8], header_end);
-
-		// pad out post-header parts
-		uint8_t zeros[4] = {0, 0, 0, 0};
-		Encodings::CommodoreGCR::encode_block(&sector_data[13], zeros);
+		Encodings::CommodoreGCR::encode_blocks(&sector_data[3], header, 3);
 		sector_data[18] = 0x52;
 		sector_data[19] = 0x94;
 		sector_data[20] = 0xaf;
 
 		// get the actual contents
-		uint8_t source_data[256];
-		file_.read(source_data, sizeof(source_data));
+		const uint8_t *source_data = &contents[size_t(sector) * 256];
 
 		// compute the latest checksum
 		checksum = 0;
@@ -119,21 +134,15 @@ std::shared_ptr<Track> D64::get_track_at_position(Track::Address address) {
 		sector_data[21] = sector_data[22] = sector_data[23] = 0xff;
 
 		// now start writing in the actual data
-		uint8_t start_of_data[4] = {
+		const uint8_t start_of_data[4] = {
 			0x07, source_data[0], source_data[1], source_data[2]
 		};
 		Encodings::CommodoreGCR::encode_block(&sector_data[24], start_of_data);
-		int source_data_offset = 3;
-		int target_data_offset = 29;
-		while((source_data_offset+4) < 256) {
-			Encodings::CommodoreGCR::encode_block(&sector_data[target_data_offset], &source_data[source_data_offset]);
-			target_data_offset += 5;
-			source_data_offset += 4;
-		}
-		uint8_t end_of_data[4] = {
+		Encodings::CommodoreGCR::encode_blocks(&sector_data[29], &source_data[3], 63);
+		const uint8_t end_of_data[4] = {
 			source_data[255], checksum, 0, 0
 		};
-		Encodings::CommodoreGCR::encode_block(&sector_data[target_data_offset], end_of_data);
+		Encodings::CommodoreGCR::encode_block(&sector_data[344], end_of_data);
 	}
 
 	return std::make_shared<PCMTrack>(PCMSegment(data));
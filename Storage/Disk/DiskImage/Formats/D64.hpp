@@ -31,6 +31,7 @@ class D64: public DiskImage {
 		HeadPosition get_maximum_head_position() final;
 		using DiskImage::get_is_read_only;
 		std::shared_ptr<Track> get_track_at_position(Track::Address address) final;
+		bool tracks_differ(Track::Address, Track::Address) final;
 
 	private:
 		Storage::FileHolder file_;
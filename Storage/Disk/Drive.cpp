@@ -62,6 +62,7 @@ void Drive::set_disk(const std::shared_ptr<Disk> &disk) {
 	if(disk_) disk_->flush_tracks();
 	disk_ = disk;
 	has_disk_ = !!disk_;
+	if(disk_) disk_->set_memory_budget(memory_budget_);
 
 	invalidate_track();
 	did_set_disk(had_disk);
@@ -72,6 +73,23 @@ bool Drive::has_disk() const {
 	return has_disk_;
 }
 
+size_t Drive::get_memory_usage() const {
+	MemoryUsage usage;
+	add_memory_usage(usage);
+	return usage.total();
+}
+
+void Drive::add_memory_usage(MemoryUsage &usage) const {
+	// Any track being patched will share all unmodified segments with the cached original.
+	if(disk_) disk_->add_memory_usage(usage);
+	if(patched_track_) patched_track_->add_memory_usage(usage);
+}
+
+void Drive::set_memory_budget(size_t bytes) {
+	memory_budget_ = bytes;
+	if(disk_) disk_->set_memory_budget(memory_budget_);
+}
+
 ClockingHint::Preference Drive::preferred_clocking() const {
 	return (!has_disk_ || (time_until_motor_transition == Cycles(0) && !disk_is_rotating_)) ? ClockingHint::Preference::None : ClockingHint::Preference::JustInTime;
 }
@@ -252,6 +270,39 @@ void Drive::run_for(const Cycles cycles) {
 	}
 }
 
+void Drive::skip_for(const Cycles cycles) {
+	// Only a disk that is steadily spinning beneath a reading head can be skipped over.
+	if(!disk_is_rotating_ || !has_disk_ || !is_reading_ || time_until_motor_transition > Cycles(0)) {
+		run_for(cycles);
+		return;
+	}
+
+	// Pass any index holes.
+	auto position = cycles_since_index_hole_ + cycles.as_integral();
+	index_pulse_remaining_ = std::max(index_pulse_remaining_ - cycles, Cycles(0));
+	while(position >= cycles_per_revolution_) {
+		position -= cycles_per_revolution_;
+		pass_index_hole();
+		index_pulse_remaining_ = std::max(index_pulse_remaining_ - Cycles(position), Cycles(0));
+
+		if(event_delegate_) {
+			event_delegate_->process_event(Event{Track::Event::IndexHole});
+		}
+	}
+
+	set_cycles_since_index_hole(position);
+}
+
+void Drive::set_cycles_since_index_hole(Cycles::IntType position) {
+	// Pick up the track again from the new position; setup_track will round the
+	// position to that of the track's nearest event, so restore it afterwards.
+	cycles_since_index_hole_ = position;
+	reset_timer();
+	track_ = nullptr;
+	get_next_event(0.0f);
+	cycles_since_index_hole_ = position;
+}
+
 // MARK: - Track timed event loop
 
 void Drive::get_next_event(float duration_already_passed) {
@@ -322,14 +373,7 @@ void Drive::get_next_event(float duration_already_passed) {
 
 void Drive::process_next_event() {
 	if(current_event_.type == Track::Event::IndexHole) {
-		++ready_index_count_;
-		if(ready_index_count_ == 2 && (ready_type_ == ReadyType::ShugartRDY || ready_type_ == ReadyType::ShugartModifiedRDY)) {
-			is_ready_ = true;
-		}
-		cycles_since_index_hole_ = 0;
-
-		// Begin a 2ms period of holding the index line pulse active.
-		index_pulse_remaining_ = Cycles((get_input_clock_rate() * 2) / 1000);
+		pass_index_hole();
 	}
 	if(
 		event_delegate_ &&
@@ -340,6 +384,17 @@ void Drive::process_next_event() {
 	get_next_event(0.0f);
 }
 
+void Drive::pass_index_hole() {
+	++ready_index_count_;
+	if(ready_index_count_ == 2 && (ready_type_ == ReadyType::ShugartRDY || ready_type_ == ReadyType::ShugartModifiedRDY)) {
+		is_ready_ = true;
+	}
+	cycles_since_index_hole_ = 0;
+
+	// Begin a 2ms period of holding the index line pulse active.
+	index_pulse_remaining_ = Cycles((get_input_clock_rate() * 2) / 1000);
+}
+
 // MARK: - Track management
 
 std::shared_ptr<Track> Drive::get_track() {
@@ -476,3 +531,45 @@ void Drive::set_activity_observer(Activity::Observer *observer, const std::strin
 		}
 	}
 }
+
+// MARK: - State
+
+Drive::State::State(const Drive &source) : State() {
+	head_position = source.head_position_.as_quarter();
+	head = source.head_;
+
+	motor_on = source.motor_input_is_on_;
+	is_rotating = source.disk_is_rotating_;
+	motor_transition = source.time_until_motor_transition.as_integral();
+
+	is_ready = source.is_ready_;
+	ready_index_count = source.ready_index_count_;
+
+	cycles_since_index_hole = source.cycles_since_index_hole_;
+	index_pulse_remaining = source.index_pulse_remaining_.as_integral();
+	cycles_until_event = source.get_cycles_until_next_event();
+	subcycles_until_event = source.get_subcycles_until_next_event();
+}
+
+void Drive::State::apply(Drive &target) {
+	target.head_position_ = HeadPosition(std::max(head_position, 0), 4);
+	target.set_head(head);
+
+	target.motor_input_is_on_ = motor_on;
+	if(target.disk_is_rotating_ != is_rotating) {
+		target.set_disk_is_rotating(is_rotating);
+	}
+	target.time_until_motor_transition = Cycles(std::max(motor_transition, int64_t(0)));
+
+	target.is_ready_ = is_ready;
+	target.ready_index_count_ = ready_index_count;
+
+	target.index_pulse_remaining_ = Cycles(std::max(index_pulse_remaining, int64_t(0)));
+	target.set_cycles_since_index_hole(
+		std::clamp(Cycles::IntType(cycles_since_index_hole), Cycles::IntType(0), Cycles::IntType(target.cycles_per_revolution_ - 1))
+	);
+
+	// Seeking to the position above has established the next event; restore the exact time until it.
+	target.set_time_until_next_event(Cycles::IntType(cycles_until_event), subcycles_until_event);
+	target.update_clocking_observer();
+}
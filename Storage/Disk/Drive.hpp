@@ -16,7 +16,9 @@
 #include "../TimedEventLoop.hpp"
 #include "../../Activity/Observer.hpp"
 #include "../../ClockReceiver/ClockingHintSource.hpp"
+#include "../../Reflection/Struct.hpp"
 
+#include <limits>
 #include <memory>
 
 namespace Storage::Disk {
@@ -55,6 +57,30 @@ class Drive: public ClockingHint::Source, public TimedEventLoop {
 		*/
 		bool has_disk() const;
 
+		/*!
+			@returns The disk currently in the drive, if any.
+		*/
+		const std::shared_ptr<Disk> &get_disk() const {
+			return disk_;
+		}
+
+		/*!
+			@returns The approximate number of bytes of track content currently held in memory for this
+			drive, including any track that is in the process of being written.
+		*/
+		size_t get_memory_usage() const;
+
+		/*!
+			Adds the track content currently held in memory for this drive to @c usage; see @c get_memory_usage.
+		*/
+		void add_memory_usage(MemoryUsage &usage) const;
+
+		/*!
+			Sets the budget for track caching by this and any future disk inserted into this drive;
+			see @c Disk::set_memory_budget.
+		*/
+		void set_memory_budget(size_t bytes);
+
 		/*!
 			@returns @c true if the drive head is currently at track zero; @c false otherwise.
 		*/
@@ -133,6 +159,15 @@ class Drive: public ClockingHint::Source, public TimedEventLoop {
 		*/
 		void run_for(const Cycles cycles);
 
+		/*!
+			Advances the drive by @c cycles without announcing any of the flux transitions that pass
+			beneath the head; index holes are announced as usual.
+
+			This is for the benefit of fast-loading mechanisms that have obtained the intervening data
+			by other means, via @c get_track and @c get_rotation, **ONLY**.
+		*/
+		void skip_for(const Cycles cycles);
+
 		struct Event {
 			Track::Event::Type type;
 			float length = 0.0f;
@@ -187,6 +222,61 @@ class Drive: public ClockingHint::Source, public TimedEventLoop {
 		*/
 		bool get_tachometer() const;
 
+		/*!
+			@returns the current rotation of the disk, a float in the half-open range
+				0.0 (the index hole) to 1.0 (back to the index hole, a whole rotation later).
+		*/
+		float get_rotation() const;
+
+		/*!
+			@returns the track underneath the current head at the location now stepped to.
+		*/
+		std::shared_ptr<Track> get_track();
+
+		/*!
+			Captures or restores the mechanical state of a drive: head position and selection, motor, readiness
+			and rotation, including the time until the next flux transition or index hole. The disk is media, so
+			isn't included; states should be captured only while reading.
+		*/
+		struct State: public Reflection::StructImpl<State> {
+			int head_position = 0;		// In quarter tracks.
+			int head = 0;
+
+			bool motor_on = false;
+			bool is_rotating = false;
+			int64_t motor_transition = 0;
+
+			bool is_ready = false;
+			int ready_index_count = 0;
+
+			int64_t cycles_since_index_hole = 0;
+			int64_t index_pulse_remaining = 0;
+			int64_t cycles_until_event = 0;
+			float subcycles_until_event = 0.0f;
+
+			State() {
+				if(needs_declare()) {
+					DeclareField(head_position);
+					DeclareField(head);
+					DeclareField(motor_on);
+					DeclareField(is_rotating);
+					DeclareField(motor_transition);
+					DeclareField(is_ready);
+					DeclareField(ready_index_count);
+					DeclareField(cycles_since_index_hole);
+					DeclareField(index_pulse_remaining);
+					DeclareField(cycles_until_event);
+					DeclareField(subcycles_until_event);
+				}
+			}
+
+			/// Captures the state of @c source.
+			State(const Drive &source);
+
+			/// Applies this state to @c target, which should have the same disk inserted as @c source did.
+			void apply(Drive &target);
+		};
+
 	protected:
 		/*!
 			Announces the result of a step.
@@ -200,18 +290,13 @@ class Drive: public ClockingHint::Source, public TimedEventLoop {
 		*/
 		virtual void did_set_disk(bool did_replace [[maybe_unused]]) {}
 
-		/*!
-			@returns the current rotation of the disk, a float in the half-open range
-				0.0 (the index hole) to 1.0 (back to the index hole, a whole rotation later).
-		*/
-		float get_rotation() const;
-
 	private:
 		// Drives contain an entire disk; from that a certain track
 		// will be currently under the head.
 		std::shared_ptr<Disk> disk_;
 		std::shared_ptr<Track> track_;
 		bool has_disk_ = false;
+		size_t memory_budget_ = std::numeric_limits<size_t>::max();
 
 		// Contains the multiplier that converts between track-relative lengths
 		// to real-time lengths. So it's the reciprocal of rotation speed.
@@ -269,14 +354,12 @@ class Drive: public ClockingHint::Source, public TimedEventLoop {
 		// Helper for track changes.
 		float get_time_into_track() const;
 
+		// Helper for jumps in rotation; picks up the track again from @c position.
+		void set_cycles_since_index_hole(Cycles::IntType position);
+
 		// The target (if any) for track events.
 		EventDelegate *event_delegate_ = nullptr;
 
-		/*!
-			@returns the track underneath the current head at the location now stepped to.
-		*/
-		std::shared_ptr<Track> get_track();
-
 		/*!
 			Attempts to set @c track as the track underneath the current head at the location now stepped to.
 		*/
@@ -284,6 +367,7 @@ class Drive: public ClockingHint::Source, public TimedEventLoop {
 
 		void setup_track();
 		void invalidate_track();
+		void pass_index_hole();
 
 		// Activity observer description.
 		Activity::Observer *observer_ = nullptr;
@@ -10,6 +10,7 @@
 #define Storage_Disk_Encodings_CommodoreGCR_hpp
 
 #include "../../Storage.hpp"
+#include <cstddef>
 #include <cstdint>
 
 namespace Storage::Encodings {
@@ -34,7 +35,12 @@ namespace CommodoreGCR {
 	/*!
 		A block is defined to be four source bytes, which encodes to five GCR bytes.
 	*/
-	void encode_block(uint8_t *destination, uint8_t *source);
+	void encode_block(uint8_t *destination, const uint8_t *source);
+
+	/*!
+		Encodes @c blocks consecutive blocks, i.e. @c blocks * 4 source bytes to @c blocks * 5 GCR bytes.
+	*/
+	void encode_blocks(uint8_t *destination, const uint8_t *source, std::size_t blocks);
 
 	/*!
 		@returns the four bit nibble for the five-bit GCR @c quintet if a valid GCR value; INT_MAX otherwise.
@@ -68,7 +68,7 @@ class MFMEncoder: public Encoder {
 		}
 
 	private:
-		uint16_t last_output_;
+		uint16_t last_output_ = 0;
 		void output_short(uint16_t value, uint16_t fuzzy_mask = 0) final {
 			last_output_ = value;
 			Encoder::output_short(value, fuzzy_mask);
@@ -9,6 +9,8 @@
 #include "PCMTrack.hpp"
 #include "../../../Outputs/Log.hpp"
 
+#include <functional>
+
 using namespace Storage::Disk;
 
 PCMTrack::PCMTrack() : segment_pointer_(0) {}
@@ -72,6 +74,15 @@ Track *PCMTrack::clone() const {
 	return new PCMTrack(*this);
 }
 
+void PCMTrack::add_memory_usage(MemoryUsage &usage) const {
+	// Segments may be shared with clones of this track, so are keyed by address;
+	// their data is stored as bit vectors.
+	for(const auto &event_source: segment_event_sources_) {
+		const PCMSegment &segment = event_source.segment();
+		usage.add(&segment, (segment.data.size() + segment.fuzzy_mask.size()) >> 3);
+	}
+}
+
 PCMTrack *PCMTrack::resampled_clone(size_t bits_per_track) {
 	// Create an empty track.
 	PCMTrack *const new_track = new PCMTrack(unsigned(bits_per_track));
@@ -88,6 +99,40 @@ PCMTrack *PCMTrack::resampled_clone(size_t bits_per_track) {
 	return new_track;
 }
 
+size_t PCMTrack::content_hash() const {
+	size_t hash = segment_event_sources_.size();
+	const auto combine = [&hash](size_t value) {
+		hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	};
+
+	for(const auto &event_source: segment_event_sources_) {
+		const PCMSegment &segment = event_source.segment();
+		combine(segment.length_of_a_bit.length);
+		combine(segment.length_of_a_bit.clock_rate);
+		combine(std::hash<std::vector<bool>>()(segment.data));
+		combine(std::hash<std::vector<bool>>()(segment.fuzzy_mask));
+	}
+	return hash;
+}
+
+bool PCMTrack::has_same_content(const PCMTrack &rhs) const {
+	if(segment_event_sources_.size() != rhs.segment_event_sources_.size()) return false;
+
+	for(size_t c = 0; c < segment_event_sources_.size(); ++c) {
+		const PCMSegment &lhs_segment = segment_event_sources_[c].segment();
+		const PCMSegment &rhs_segment = rhs.segment_event_sources_[c].segment();
+		if(&lhs_segment == &rhs_segment) continue;
+
+		if(
+			lhs_segment.length_of_a_bit.length != rhs_segment.length_of_a_bit.length ||
+			lhs_segment.length_of_a_bit.clock_rate != rhs_segment.length_of_a_bit.clock_rate ||
+			lhs_segment.data != rhs_segment.data ||
+			lhs_segment.fuzzy_mask != rhs_segment.fuzzy_mask
+		) return false;
+	}
+	return true;
+}
+
 Track::Event PCMTrack::get_next_event() {
 	// ask the current segment for a new event
 	Track::Event event = segment_event_sources_[segment_pointer_].get_next_event();
@@ -51,6 +51,7 @@ class PCMTrack: public Track {
 		Event get_next_event() final;
 		float seek_to(float time_since_index_hole) final;
 		Track *clone() const final;
+		void add_memory_usage(MemoryUsage &) const final;
 
 		// Obtains a copy of this track, flattened to a single PCMSegment, which
 		// consists of @c bits_per_track potential flux transition points.
@@ -71,6 +72,17 @@ class PCMTrack: public Track {
 		*/
 		void add_segment(const Time &start_time, const PCMSegment &segment, bool clamp_to_index_hole);
 
+		/*!
+			@returns a hash of this track's content, which is guaranteed to be the same for any two tracks
+			for which @c has_same_content is @c true.
+		*/
+		size_t content_hash() const;
+
+		/*!
+			@returns @c true if this track consists of exactly the same segments as @c rhs; @c false otherwise.
+		*/
+		bool has_same_content(const PCMTrack &rhs) const;
+
 	private:
 		/*!
 			Creates a PCMTrack with a single segment, consisting of @c bits_per_track flux windows,
@@ -10,10 +10,34 @@
 #define Track_h
 
 #include "../../Storage.hpp"
+#include <cstddef>
+#include <map>
 #include <tuple>
 
 namespace Storage::Disk {
 
+/*!
+	Accumulates the number of bytes held by each distinct block of track content, keyed by the
+	block's address so that content shared between tracks, disks or drives is counted only once.
+*/
+class MemoryUsage {
+	public:
+		void add(const void *block, size_t bytes) {
+			blocks_[block] = bytes;
+		}
+
+		size_t total() const {
+			size_t result = 0;
+			for(const auto &block: blocks_) {
+				result += block.second;
+			}
+			return result;
+		}
+
+	private:
+		std::map<const void *, size_t> blocks_;
+};
+
 /*!
 	Contains a head position, with some degree of sub-integral precision.
 */
@@ -123,6 +147,11 @@ class Track {
 			The virtual copy constructor pattern; returns a copy of the Track.
 		*/
 		virtual Track *clone() const = 0;
+
+		/*!
+			Adds an approximation of the number of bytes used to store this track's content to @c usage.
+		*/
+		virtual void add_memory_usage(MemoryUsage &) const {}
 };
 
 }
@@ -0,0 +1,85 @@
+//
+//  TrackStore.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "TrackStore.hpp"
+
+#include "PCMTrack.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+using namespace Storage::Disk;
+
+namespace {
+
+std::mutex store_mutex;
+
+/// Maps from content hash to prototype tracks; a prototype is kept alive only by
+/// the tracks that have been vended from it.
+std::unordered_multimap<size_t, std::weak_ptr<PCMTrack>> prototypes;
+
+/// Expired prototypes are discarded only periodically, to amortise the cost of looking for them.
+size_t additions_since_purge = 0;
+constexpr size_t PurgeInterval = 256;
+
+void purge_expired() {
+	auto iterator = prototypes.begin();
+	while(iterator != prototypes.end()) {
+		if(iterator->second.expired()) {
+			iterator = prototypes.erase(iterator);
+		} else {
+			++iterator;
+		}
+	}
+	additions_since_purge = 0;
+}
+
+}
+
+std::shared_ptr<Track> TrackStore::deduplicated(const std::shared_ptr<Track> &track) {
+	const auto pcm_track = std::dynamic_pointer_cast<PCMTrack>(track);
+	if(!pcm_track) return track;
+
+	// Hashing may be relatively expensive, so do it before acquiring the lock.
+	const size_t hash = pcm_track->content_hash();
+
+	std::shared_ptr<PCMTrack> prototype;
+	{
+		std::lock_guard lock_guard(store_mutex);
+
+		const auto range = prototypes.equal_range(hash);
+		for(auto iterator = range.first; iterator != range.second; ++iterator) {
+			const auto candidate = iterator->second.lock();
+			if(candidate && candidate->has_same_content(*pcm_track)) {
+				prototype = candidate;
+				break;
+			}
+		}
+
+		if(!prototype) {
+			// PCMTracks' copy constructor shares underlying data, so this costs
+			// nothing beyond a new set of read positions.
+			prototype = std::make_shared<PCMTrack>(*pcm_track);
+			prototypes.emplace(hash, prototype);
+
+			++additions_since_purge;
+			if(additions_since_purge == PurgeInterval) {
+				purge_expired();
+			}
+		}
+	}
+
+	// Vend a copy of the prototype, which will therefore share its data, and which keeps the prototype
+	// alive for as long as the copy exists.
+	return std::shared_ptr<Track>(
+		new PCMTrack(*prototype),
+		[prototype] (Track *track) {
+			delete track;
+		}
+	);
+}
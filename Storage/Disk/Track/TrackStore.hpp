@@ -0,0 +1,36 @@
+//
+//  TrackStore.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef TrackStore_hpp
+#define TrackStore_hpp
+
+#include "Track.hpp"
+
+#include <memory>
+
+namespace Storage::Disk::TrackStore {
+
+/*!
+	Maintains a process-wide, content-addressed store of the data underlying tracks, so that identical
+	tracks — whether repeated within a single disk image or loaded from the same image by several
+	machines — share a single copy of their data.
+
+	Content is reference counted: it is retained only while at least one track that uses it is alive.
+
+	@returns a track with the same content as @c track. If @c track is a @c PCMTrack then the result
+	will share its data with any identical tracks previously returned and still in use; otherwise
+	@c track is returned unmodified. In the former case the result is always a distinct object, with
+	its own read position, so that callers may read from it independently.
+
+	Safe to call from any thread.
+*/
+std::shared_ptr<Track> deduplicated(const std::shared_ptr<Track> &track);
+
+}
+
+#endif /* TrackStore_hpp */
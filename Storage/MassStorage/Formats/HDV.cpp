@@ -14,6 +14,7 @@ using namespace Storage::MassStorage;
 
 HDV::HDV(const std::string &file_name, long start, long size):
 	file_(file_name),
+	file_name_(file_name),
 	file_start_(start),
 	image_size_(std::min(size, long(file_.stats().st_size)))
 {
@@ -36,6 +37,14 @@ std::vector<uint8_t> HDV::get_block(size_t address) {
 	const auto file_offset = offset_for_block(source_address);
 
 	if(source_address >= 0) {
+		if(overlay_) {
+			std::vector<uint8_t> written;
+			if(overlay_->get_block(size_t(source_address), written)) {
+				return mapper_.convert_source_block(source_address, written);
+			}
+			return mapper_.convert_source_block(source_address, overlay_->read_base(file_offset, get_block_size()));
+		}
+
 		file_.seek(file_offset, SEEK_SET);
 		return mapper_.convert_source_block(source_address, file_.read(get_block_size()));
 	} else {
@@ -48,11 +57,25 @@ void HDV::set_block(size_t address, const std::vector<uint8_t> &data) {
 	const auto file_offset = offset_for_block(source_address);
 
 	if(source_address >= 0 && file_offset >= 0) {
+		if(overlay_) {
+			overlay_->set_block(size_t(source_address), data);
+			return;
+		}
+
 		file_.seek(file_offset, SEEK_SET);
 		file_.write(data);
 	}
 }
 
+bool HDV::set_overlay(const std::string &file_name) {
+	try {
+		overlay_ = std::make_unique<OverlayFile>(file_name_, file_name, get_block_size());
+	} catch(...) {
+		return false;
+	}
+	return true;
+}
+
 long HDV::offset_for_block(ssize_t address) {
 	if(address < 0) return -1;
 
@@ -10,10 +10,12 @@
 #define HDV_hpp
 
 #include "../MassStorageDevice.hpp"
+#include "../OverlayFile.hpp"
 #include "../../FileHolder.hpp"
 #include "../Encodings/AppleIIVolume.hpp"
 
 #include <limits>
+#include <memory>
 #include <vector>
 
 namespace Storage::MassStorage {
@@ -35,7 +37,9 @@ class HDV: public MassStorageDevice {
 
 	private:
 		FileHolder file_;
+		const std::string file_name_;
 		long file_start_, image_size_;
+		std::unique_ptr<OverlayFile> overlay_;
 		Storage::MassStorage::Encodings::AppleII::Mapper mapper_;
 
 		/// @returns -1 if @c address is out of range; the offset into the file at which
@@ -47,6 +51,7 @@ class HDV: public MassStorageDevice {
 		size_t get_number_of_blocks() final;
 		std::vector<uint8_t> get_block(size_t address) final;
 		void set_block(size_t address, const std::vector<uint8_t> &) final;
+		bool set_overlay(const std::string &) final;
 };
 
 }
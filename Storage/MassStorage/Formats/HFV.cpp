@@ -10,7 +10,7 @@
 
 using namespace Storage::MassStorage;
 
-HFV::HFV(const std::string &file_name) : file_(file_name) {
+HFV::HFV(const std::string &file_name) : file_(file_name), file_name_(file_name) {
 	// Is the file a multiple of 512 bytes in size and larger than a floppy disk?
 	const auto file_size = file_.stats().st_size;
 	if(file_size & 511 || file_size <= 800*1024) throw std::exception();
@@ -30,12 +30,21 @@ size_t HFV::get_number_of_blocks() {
 }
 
 std::vector<uint8_t> HFV::get_block(size_t address) {
-	const auto written = writes_.find(address);
-	if(written != writes_.end()) return written->second;
+	if(overlay_) {
+		std::vector<uint8_t> written;
+		if(overlay_->get_block(address, written)) return written;
+	} else {
+		const auto written = writes_.find(address);
+		if(written != writes_.end()) return written->second;
+	}
 
 	const auto source_address = mapper_.to_source_address(address);
 	if(source_address >= 0 && size_t(source_address)*get_block_size() < size_t(file_.stats().st_size)) {
 		const long file_offset = long(get_block_size()) * long(source_address);
+		if(overlay_) {
+			return mapper_.convert_source_block(source_address, overlay_->read_base(file_offset, get_block_size()));
+		}
+
 		file_.seek(file_offset, SEEK_SET);
 		return mapper_.convert_source_block(source_address, file_.read(get_block_size()));
 	} else {
@@ -44,16 +53,40 @@ std::vector<uint8_t> HFV::get_block(size_t address) {
 }
 
 void HFV::set_block(size_t address, const std::vector<uint8_t> &contents) {
+	if(overlay_) {
+		overlay_->set_block(address, contents);
+		return;
+	}
+
 	const auto source_address = mapper_.to_source_address(address);
 	if(source_address >= 0 && size_t(source_address)*get_block_size() < size_t(file_.stats().st_size)) {
 		const long file_offset = long(get_block_size()) * long(source_address);
 		file_.seek(file_offset, SEEK_SET);
 		file_.write(contents);
+	} else if(contents == mapper_.convert_source_block(source_address)) {
+		writes_.erase(address);
 	} else {
 		writes_[address] = contents;
 	}
 }
 
+size_t HFV::get_memory_usage() {
+	size_t usage = overlay_ ? overlay_->get_memory_usage() : 0;
+	for(const auto &write: writes_) {
+		usage += write.second.size();
+	}
+	return usage;
+}
+
+bool HFV::set_overlay(const std::string &file_name) {
+	try {
+		overlay_ = std::make_unique<OverlayFile>(file_name_, file_name, get_block_size());
+	} catch(...) {
+		return false;
+	}
+	return true;
+}
+
 void HFV::set_drive_type(Encodings::Macintosh::DriveType drive_type) {
 	mapper_.set_drive_type(drive_type, size_t(file_.stats().st_size) / get_block_size());
 }
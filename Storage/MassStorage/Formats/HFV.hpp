@@ -10,11 +10,13 @@
 #define HFV_hpp
 
 #include "../MassStorageDevice.hpp"
+#include "../OverlayFile.hpp"
 #include "../../FileHolder.hpp"
 #include "../Encodings/MacintoshVolume.hpp"
 
-#include <vector>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace Storage::MassStorage {
 
@@ -33,6 +35,7 @@ class HFV: public MassStorageDevice, public Encodings::Macintosh::Volume {
 
 	private:
 		FileHolder file_;
+		const std::string file_name_;
 		Encodings::Macintosh::Mapper mapper_;
 
 		/* MassStorageDevices overrides. */
@@ -40,11 +43,17 @@ class HFV: public MassStorageDevice, public Encodings::Macintosh::Volume {
 		size_t get_number_of_blocks() final;
 		std::vector<uint8_t> get_block(size_t address) final;
 		void set_block(size_t address, const std::vector<uint8_t> &) final;
+		bool set_overlay(const std::string &) final;
+		size_t get_memory_usage() final;
 
 		/* Encodings::Macintosh::Volume overrides. */
 		void set_drive_type(Encodings::Macintosh::DriveType) final;
 
+		// Writes to blocks that the mapper synthesises, rather than reading from the file, are
+		// retained here — unless there's an overlay, in which case all writes go there. Writes
+		// that restore a block's synthesised contents are dropped.
 		std::map<size_t, std::vector<uint8_t>> writes_;
+		std::unique_ptr<OverlayFile> overlay_;
 };
 
 }
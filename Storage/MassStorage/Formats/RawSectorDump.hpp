@@ -10,9 +10,11 @@
 #define RawSectorDump_h
 
 #include "../MassStorageDevice.hpp"
+#include "../OverlayFile.hpp"
 #include "../../FileHolder.hpp"
 
 #include <cassert>
+#include <memory>
 
 namespace Storage::MassStorage {
 
@@ -20,6 +22,7 @@ template <long sector_size> class RawSectorDump: public MassStorageDevice {
 	public:
 		RawSectorDump(const std::string &file_name, long offset = 0, long length = -1) :
 			file_(file_name),
+			file_name_(file_name),
 			file_size_((length == -1) ? long(file_.stats().st_size) : length),
 			file_start_(offset)
 		{
@@ -37,19 +40,43 @@ template <long sector_size> class RawSectorDump: public MassStorageDevice {
 		}
 
 		std::vector<uint8_t> get_block(size_t address) final {
+			if(overlay_) {
+				std::vector<uint8_t> result;
+				if(!overlay_->get_block(address, result)) {
+					result = overlay_->read_base(file_start_ + long(address * sector_size), sector_size);
+				}
+				return result;
+			}
+
 			file_.seek(file_start_ + long(address * sector_size), SEEK_SET);
 			return file_.read(sector_size);
 		}
 
 		void set_block(size_t address, const std::vector<uint8_t> &contents) final {
 			assert(contents.size() == sector_size);
+			if(overlay_) {
+				overlay_->set_block(address, contents);
+				return;
+			}
+
 			file_.seek(file_start_ + long(address * sector_size), SEEK_SET);
 			file_.write(contents);
 		}
 
+		bool set_overlay(const std::string &file_name) final {
+			try {
+				overlay_ = std::make_unique<OverlayFile>(file_name_, file_name, sector_size);
+			} catch(...) {
+				return false;
+			}
+			return true;
+		}
+
 	private:
 		FileHolder file_;
+		const std::string file_name_;
 		const long file_size_, file_start_;
+		std::unique_ptr<OverlayFile> overlay_;
 };
 
 }
@@ -11,6 +11,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 #include <vector>
 
 namespace Storage::MassStorage {
@@ -52,6 +53,22 @@ class MassStorageDevice {
 			Sets new contents for the block at @c address.
 		*/
 		virtual void set_block([[maybe_unused]] size_t address, const std::vector<uint8_t> &) {}
+
+		/*!
+			Requests that all future writes go to a sparse overlay file named @c file_name, creating it if
+			necessary, leaving the underlying image unmodified. Any blocks already in the overlay will be
+			read from there in preference to the underlying image.
+
+			@returns @c true if the overlay was established; @c false if this device doesn't support
+			overlays or the overlay could not be opened.
+		*/
+		virtual bool set_overlay([[maybe_unused]] const std::string &file_name) { return false; }
+
+		/*!
+			@returns The approximate number of bytes this device currently holds in memory, e.g. as
+			caches or as written blocks that have no backing store.
+		*/
+		virtual size_t get_memory_usage() { return 0; }
 };
 
 }
@@ -0,0 +1,148 @@
+//
+//  OverlayFile.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "OverlayFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace Storage::MassStorage;
+
+namespace {
+
+constexpr char Signature[] = "CLK overlay\n";
+constexpr long HeaderLength = 16;
+
+/// Opens @c file_name for reading and writing, first creating it with a header if it doesn't yet exist.
+std::string create_if_necessary(const std::string &file_name, size_t block_size) {
+	try {
+		Storage::FileHolder existing(file_name, Storage::FileHolder::FileMode::Read);
+	} catch(const Storage::FileHolder::Error &) {
+		Storage::FileHolder file(file_name, Storage::FileHolder::FileMode::Rewrite);
+		file.write(reinterpret_cast<const uint8_t *>(Signature), sizeof(Signature) - 1);
+		file.put_le(uint32_t(block_size));
+	}
+	return file_name;
+}
+
+}
+
+OverlayFile::OverlayFile(const std::string &base_name, const std::string &overlay_name, size_t block_size, size_t cache_blocks) :
+	base_file_(base_name, FileHolder::FileMode::Read),
+	overlay_file_(create_if_necessary(overlay_name, block_size), FileHolder::FileMode::ReadWrite),
+	block_size_(block_size),
+	cache_(std::max(cache_blocks, size_t(1)))
+{
+	if(overlay_file_.get_is_known_read_only()) throw std::exception();
+
+	// Validate the overlay.
+	overlay_file_.seek(0, SEEK_SET);
+	if(!overlay_file_.check_signature(Signature)) throw std::exception();
+	if(overlay_file_.get32le() != block_size) throw std::exception();
+
+	// Index its contents.
+	const long overlay_size = long(overlay_file_.stats().st_size);
+	const long record_size = 4 + long(block_size);
+	for(long offset = HeaderLength; offset + record_size <= overlay_size; offset += record_size) {
+		overlay_file_.seek(offset, SEEK_SET);
+		const size_t address = overlay_file_.get32le();
+		record_offsets_[address] = offset + 4;
+	}
+
+	// Map the base image.
+	base_size_ = long(base_file_.stats().st_size);
+	const int descriptor = open(base_name.c_str(), O_RDONLY);
+	if(descriptor >= 0) {
+		if(base_size_) {
+			void *const mapping = mmap(nullptr, size_t(base_size_), PROT_READ, MAP_SHARED, descriptor, 0);
+			if(mapping != MAP_FAILED) {
+				base_ = static_cast<const uint8_t *>(mapping);
+			}
+		}
+		close(descriptor);
+	}
+}
+
+OverlayFile::~OverlayFile() {
+	if(base_) {
+		munmap(const_cast<uint8_t *>(base_), size_t(base_size_));
+	}
+}
+
+long OverlayFile::base_size() const {
+	return base_size_;
+}
+
+std::vector<uint8_t> OverlayFile::read_base(long offset, size_t length) {
+	if(offset < 0 || offset >= base_size_) return {};
+	length = std::min(length, size_t(base_size_ - offset));
+
+	if(base_) {
+		return std::vector<uint8_t>(base_ + offset, base_ + offset + length);
+	}
+
+	base_file_.seek(offset, SEEK_SET);
+	return base_file_.read(length);
+}
+
+size_t OverlayFile::get_memory_usage() const {
+	// Approximate each index entry as its key and value plus a node link and a cached hash,
+	// and add the bucket array.
+	size_t usage =
+		record_offsets_.size() * (sizeof(decltype(record_offsets_)::value_type) + 2 * sizeof(void *)) +
+		record_offsets_.bucket_count() * sizeof(void *);
+	for(const auto &line: cache_) {
+		usage += line.contents.capacity();
+	}
+	return usage;
+}
+
+OverlayFile::CacheLine &OverlayFile::cache_line(size_t address) {
+	return cache_[address % cache_.size()];
+}
+
+bool OverlayFile::get_block(size_t address, std::vector<uint8_t> &contents) {
+	const auto record = record_offsets_.find(address);
+	if(record == record_offsets_.end()) return false;
+
+	auto &line = cache_line(address);
+	if(line.address != address) {
+		overlay_file_.seek(record->second, SEEK_SET);
+		line.contents = overlay_file_.read(block_size_);
+		line.address = address;
+	}
+
+	contents = line.contents;
+	return true;
+}
+
+void OverlayFile::set_block(size_t address, const std::vector<uint8_t> &contents) {
+	// Normalise to exactly one block.
+	std::vector<uint8_t> block = contents;
+	block.resize(block_size_);
+
+	// Append a new record if this block hasn't been seen before; otherwise update the existing one.
+	const auto record = record_offsets_.find(address);
+	if(record == record_offsets_.end()) {
+		overlay_file_.seek(0, SEEK_END);
+		overlay_file_.put_le(uint32_t(address));
+		record_offsets_[address] = overlay_file_.tell();
+	} else {
+		overlay_file_.seek(record->second, SEEK_SET);
+	}
+	overlay_file_.write(block);
+	overlay_file_.flush();
+
+	auto &line = cache_line(address);
+	line.address = address;
+	line.contents = std::move(block);
+}
@@ -0,0 +1,91 @@
+//
+//  OverlayFile.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 18/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#ifndef OverlayFile_hpp
+#define OverlayFile_hpp
+
+#include "../FileHolder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Storage::MassStorage {
+
+/*!
+	Pairs a base image, which is treated as read-only and mapped into memory where possible,
+	with a sparse overlay file that captures every block subsequently written.
+
+	This allows any number of emulated machines to share a single base image, each keeping
+	its own modifications in its own overlay.
+
+	The overlay file consists of a short header followed by a sequence of records, each of which
+	is a 32-bit little-endian block address followed by that block's contents. Records are added
+	only for blocks that have not previously been written; all later writes to the same block
+	replace its record in place. Only an index of record locations and a small, fixed-size
+	cache of block contents are retained in memory.
+*/
+class OverlayFile {
+	public:
+		/*!
+			Maps @c base_name and opens the overlay @c overlay_name, creating it if it does not yet exist.
+
+			@throws if the overlay cannot be created, or exists but was created for a different block size.
+		*/
+		OverlayFile(const std::string &base_name, const std::string &overlay_name, size_t block_size, size_t cache_blocks = 64);
+		~OverlayFile();
+
+		/*!
+			@returns the @c length bytes of the base image that start at @c offset, or as many of them as exist.
+		*/
+		std::vector<uint8_t> read_base(long offset, size_t length);
+
+		/// @returns the size of the base image in bytes.
+		long base_size() const;
+
+		/*!
+			If the overlay holds a copy of block @c address then stores it to @c contents and returns @c true.
+			Otherwise returns @c false, leaving @c contents unmodified.
+		*/
+		bool get_block(size_t address, std::vector<uint8_t> &contents);
+
+		/*!
+			Stores @c contents to the overlay as the new value for block @c address.
+		*/
+		void set_block(size_t address, const std::vector<uint8_t> &contents);
+
+		/// @returns the number of bytes currently used by the index and cache.
+		size_t get_memory_usage() const;
+
+	private:
+		// The base image; if mapping fails then reads fall back upon base_file_.
+		const uint8_t *base_ = nullptr;
+		long base_size_ = 0;
+		FileHolder base_file_;
+
+		// The overlay and an index into it, mapping from the address of each block that has been
+		// written to the file offset of its contents. Writes are usually few and scattered across
+		// a large volume, so this is kept sparse.
+		FileHolder overlay_file_;
+		std::unordered_map<size_t, long> record_offsets_;
+		const size_t block_size_;
+
+		// A direct-mapped cache of recently-accessed overlay blocks.
+		struct CacheLine {
+			size_t address = ~size_t(0);
+			std::vector<uint8_t> contents;
+		};
+		std::vector<CacheLine> cache_;
+		CacheLine &cache_line(size_t address);
+};
+
+}
+
+#endif /* OverlayFile_hpp */
@@ -24,6 +24,13 @@ class DirectAccessDevice: public Target::Executor {
 		*/
 		void set_storage(const std::shared_ptr<Storage::MassStorage::MassStorageDevice> &device);
 
+		/*!
+			@returns The backing storage exposed by this direct-access device, if any.
+		*/
+		const std::shared_ptr<Storage::MassStorage::MassStorageDevice> &get_storage() const {
+			return device_;
+		}
+
 		/* SCSI commands. */
 		bool read(const Target::CommandState &, Target::Responder &);
 		bool write(const Target::CommandState &, Target::Responder &);
@@ -44,7 +44,7 @@ enum class SymbolType {
 	One, Zero
 };
 
-class Parser: public Storage::Tape::Parser<SymbolType>, public Shifter::Delegate {
+class Parser: public Storage::Tape::Parser<SymbolType, Parser>, public Shifter::Delegate {
 	public:
 		Parser();
 
@@ -56,8 +56,10 @@ class Parser: public Storage::Tape::Parser<SymbolType>, public Shifter::Delegate
 		uint16_t get_crc() const;
 
 	private:
+		friend Storage::Tape::Parser<SymbolType, Parser>;
+
 		void acorn_shifter_output_bit(int value) override;
-		void process_pulse(const Storage::Tape::Tape::Pulse &pulse) override;
+		void process_pulse(const Storage::Tape::Tape::Pulse &pulse);
 
 		bool did_update_shifter(int new_value, int length);
 		CRC::Generator<uint16_t, 0x0000, 0x0000, false, false> crc_;
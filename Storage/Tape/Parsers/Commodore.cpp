@@ -14,7 +14,7 @@
 using namespace Storage::Tape::Commodore;
 
 Parser::Parser() :
-	Storage::Tape::PulseClassificationParser<WaveType, SymbolType>() {}
+	Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser>() {}
 
 /*!
 	Advances to the next block on the tape, treating it as a header, then consumes, parses, and returns it.
@@ -254,7 +254,7 @@ void Parser::process_pulse(const Storage::Tape::Tape::Pulse &pulse) {
 	Per the contract with Analyser::Static::TapeParser; produces any of a word marker, an end-of-block marker,
 	a zero, a one or a lead-in symbol based on the currently captured waves.
 */
-void Parser::inspect_waves(const std::vector<WaveType> &waves) {
+void Parser::inspect_waves(const Storage::Tape::WaveQueue<WaveType> &waves) {
 	if(waves.size() < 2) return;
 
 	if(waves[0] == WaveType::Long && waves[1] == WaveType::Medium) {
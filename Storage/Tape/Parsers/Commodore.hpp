@@ -54,7 +54,7 @@ struct Data {
 	bool duplicate_matched;
 };
 
-class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType> {
+class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser> {
 	public:
 		Parser();
 
@@ -71,6 +71,9 @@ class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolTy
 		std::unique_ptr<Data> get_next_data(const std::shared_ptr<Storage::Tape::Tape> &tape);
 
 	private:
+		friend Storage::Tape::Parser<SymbolType, Parser>;
+		friend Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser>;
+
 		/*!
 			Template for the logic in selecting which of two copies of something to consider authoritative,
 			including setting the duplicate_matched flag.
@@ -118,7 +121,7 @@ class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolTy
 			indicates a high to low transition, inspects the time since the last transition, to produce
 			a long, medium, short or unrecognised wave period.
 		*/
-		void process_pulse(const Storage::Tape::Tape::Pulse &pulse) override;
+		void process_pulse(const Storage::Tape::Tape::Pulse &pulse);
 		bool previous_was_high_ = false;
 		float wave_period_ = 0.0f;
 
@@ -126,7 +129,7 @@ class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolTy
 			Per the contract with Analyser::Static::TapeParser; produces any of a word marker, an end-of-block marker,
 			a zero, a one or a lead-in symbol based on the currently captured waves.
 		*/
-		void inspect_waves(const std::vector<WaveType> &waves) override;
+		void inspect_waves(const Storage::Tape::WaveQueue<WaveType> &waves);
 };
 
 }
@@ -58,7 +58,7 @@ void Parser::process_pulse(const Storage::Tape::Tape::Pulse &pulse) {
 	cycle_length_ += pulse.length.get<float>();
 }
 
-void Parser::inspect_waves(const std::vector<WaveType> &waves) {
+void Parser::inspect_waves(const Storage::Tape::WaveQueue<WaveType> &waves) {
 	switch(detection_mode_) {
 		case FastZero:
 			if(waves.empty()) return;
@@ -150,7 +150,7 @@ void Parser::inspect_waves(const std::vector<WaveType> &waves) {
 	remove_waves(1);
 }
 
-std::size_t Parser::pattern_matching_depth(const std::vector<WaveType> &waves, const Pattern *pattern) {
+std::size_t Parser::pattern_matching_depth(const Storage::Tape::WaveQueue<WaveType> &waves, const Pattern *pattern) {
 	std::size_t depth = 0;
 	int pattern_depth = 0;
 	while(depth < waves.size() && pattern->type != WaveType::Unrecognised) {
@@ -24,14 +24,17 @@ enum class SymbolType {
 	One, Zero, FoundFast, FoundSlow
 };
 
-class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType> {
+class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser> {
 	public:
 		int get_next_byte(const std::shared_ptr<Storage::Tape::Tape> &tape, bool use_fast_encoding);
 		bool sync_and_get_encoding_speed(const std::shared_ptr<Storage::Tape::Tape> &tape);
 
 	private:
-		void process_pulse(const Storage::Tape::Tape::Pulse &pulse) override;
-		void inspect_waves(const std::vector<WaveType> &waves) override;
+		friend Storage::Tape::Parser<SymbolType, Parser>;
+		friend Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser>;
+
+		void process_pulse(const Storage::Tape::Tape::Pulse &pulse);
+		void inspect_waves(const Storage::Tape::WaveQueue<WaveType> &waves);
 
 		enum DetectionMode {
 			FastData,
@@ -47,7 +50,7 @@ class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolTy
 			WaveType type;
 			int count = 0;
 		};
-		std::size_t pattern_matching_depth(const std::vector<WaveType> &waves, const Pattern *pattern);
+		std::size_t pattern_matching_depth(const Storage::Tape::WaveQueue<WaveType> &waves, const Pattern *pattern);
 };
 
 }
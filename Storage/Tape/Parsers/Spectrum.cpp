@@ -143,7 +143,7 @@ void Parser::set_cpc_one_zero_boundary(float boundary) {
 	is_pilot_ = too_long_;
 }
 
-void Parser::inspect_waves(const std::vector<Storage::Tape::ZXSpectrum::WaveType> &waves) {
+void Parser::inspect_waves(const Storage::Tape::WaveQueue<Storage::Tape::ZXSpectrum::WaveType> &waves) {
 	switch(waves[0]) {
 		// Gap and Pilot map directly.
 		case WaveType::Gap:		push_symbol(SymbolType::Gap, 1);	break;
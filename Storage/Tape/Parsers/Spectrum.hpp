@@ -51,7 +51,7 @@ struct Block {
 	uint8_t type = 0;
 };
 
-class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType> {
+class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser> {
 	public:
 		enum class MachineType {
 			ZXSpectrum,
@@ -96,9 +96,11 @@ class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolTy
 			Push a pulse; primarily provided for Storage::Tape::PulseClassificationParser but also potentially useful
 			for picking up fast loading from an ongoing tape.
 		*/
-		void process_pulse(const Storage::Tape::Tape::Pulse &pulse) override;
+		void process_pulse(const Storage::Tape::Tape::Pulse &pulse);
 
 	private:
+		friend Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser>;
+
 		const MachineType machine_type_;
 		constexpr bool should_flip_bytes() {
 			return machine_type_ == MachineType::Enterprise;
@@ -107,7 +109,7 @@ class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolTy
 			return machine_type_ != MachineType::ZXSpectrum;
 		}
 
-		void inspect_waves(const std::vector<WaveType> &waves) override;
+		void inspect_waves(const Storage::Tape::WaveQueue<WaveType> &waves);
 
 		uint8_t checksum_ = 0;
 
@@ -12,12 +12,20 @@
 #include "../Tape.hpp"
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
 namespace Storage::Tape {
 
-template <typename SymbolType> class Parser {
+/*!
+	Provides the common functionality of a tape parser: symbol lookahead and the error flag.
+
+	@c Child should be the concrete parser; it is required to provide @c process_pulse(const Storage::Tape::Tape::Pulse &)
+	and may optionally provide @c mark_end(). Both are dispatched statically, so should be declared
+	without @c virtual; a parser that keeps them private should declare this class a friend.
+*/
+template <typename SymbolType, typename Child> class Parser {
 	public:
 		/// Resets the error flag.
 		void reset_error_flag()		{	error_flag_ = false;		}
@@ -30,9 +38,9 @@ template <typename SymbolType> class Parser {
 		*/
 		SymbolType get_next_symbol(const std::shared_ptr<Storage::Tape::Tape> &tape) {
 			while(!has_next_symbol_ && !tape->is_at_end()) {
-				process_pulse(tape->get_next_pulse());
+				static_cast<Child *>(this)->process_pulse(tape->get_next_pulse());
 			}
-			if(!has_next_symbol_ && tape->is_at_end()) mark_end();
+			if(!has_next_symbol_ && tape->is_at_end()) static_cast<Child *>(this)->mark_end();
 			has_next_symbol_ = false;
 			return next_symbol_;
 		}
@@ -67,16 +75,12 @@ template <typename SymbolType> class Parser {
 		}
 
 	protected:
-		/*!
-			Should be implemented by subclasses. Consumes @c pulse.
-		*/
-		virtual void process_pulse(const Storage::Tape::Tape::Pulse &pulse) = 0;
-
 		/*!
 			An optional implementation for subclasses; called to announce that the tape has ended: that
-			no more process_pulse calls will occur.
+			no more process_pulse calls will occur. Subclasses wishing to be informed should declare
+			a member of the same name.
 		*/
-		virtual void mark_end() {}
+		void mark_end() {}
 
 		/*!
 			Sets @c symbol as the newly-recognised symbol.
@@ -95,6 +99,64 @@ template <typename SymbolType> class Parser {
 		bool has_next_symbol_ = false;
 };
 
+/*!
+	A first-in, first-out queue of waves, stored as a ring buffer so that removal
+	from the front is constant time. Storage grows only if a parser allows more waves
+	than have ever previously been queued to accumulate, so in steady state this
+	performs no allocations.
+*/
+template <typename WaveType> class WaveQueue {
+	public:
+		WaveQueue() : storage_(16) {}
+
+		/// @returns The number of waves currently queued.
+		std::size_t size() const {
+			return write_pointer_ - read_pointer_;
+		}
+
+		/// @returns @c true if no waves are currently queued; @c false otherwise.
+		bool empty() const {
+			return write_pointer_ == read_pointer_;
+		}
+
+		/// @returns The wave @c index places from the front of the queue.
+		WaveType operator[](std::size_t index) const {
+			assert(index < size());
+			return storage_[(read_pointer_ + index) & (storage_.size() - 1)];
+		}
+
+		/// Adds @c wave to the back of the queue.
+		void push_back(WaveType wave) {
+			if(size() == storage_.size()) {
+				grow();
+			}
+			storage_[write_pointer_ & (storage_.size() - 1)] = wave;
+			++write_pointer_;
+		}
+
+		/// Removes @c count waves from the front of the queue.
+		void pop_front(std::size_t count) {
+			assert(count <= size());
+			read_pointer_ += count;
+		}
+
+	private:
+		// Invariant: storage_.size() is a power of two, so that indices can be masked.
+		std::vector<WaveType> storage_;
+		std::size_t read_pointer_ = 0, write_pointer_ = 0;
+
+		void grow() {
+			std::vector<WaveType> new_storage(storage_.size() * 2);
+			const std::size_t length = size();
+			for(std::size_t c = 0; c < length; c++) {
+				new_storage[c] = (*this)[c];
+			}
+			storage_ = std::move(new_storage);
+			read_pointer_ = 0;
+			write_pointer_ = length;
+		}
+};
+
 /*!
 	A partly-abstract base class to help in the authorship of tape format parsers;
 	provides hooks for receipt of pulses, which are intended to be classified into waves,
@@ -102,14 +164,14 @@ template <typename SymbolType> class Parser {
 
 	Very optional, not intended to box in the approaches taken for analysis. See also
 	the PLLParser.
-*/
-template <typename WaveType, typename SymbolType> class PulseClassificationParser: public Parser<SymbolType> {
-	public:
-		virtual void process_pulse(const Storage::Tape::Tape::Pulse &pulse) = 0;
 
-		/*
-			process_pulse should either call @c push_wave or to take no action.
-		*/
+	@c Child should provide @c process_pulse, per Parser, and @c inspect_waves(const WaveQueue<WaveType> &).
+	Both are dispatched statically.
+*/
+template <typename WaveType, typename SymbolType, typename Child> class PulseClassificationParser: public Parser<SymbolType, Child> {
+	/*
+		process_pulse should either call @c push_wave or to take no action.
+	*/
 
 	protected:
 		/*!
@@ -119,7 +181,7 @@ template <typename WaveType, typename SymbolType> class PulseClassificationParse
 			waves together represent @c symbol.
 		*/
 		void push_symbol(SymbolType symbol, int number_of_waves) {
-			Parser<SymbolType>::push_symbol(symbol);
+			Parser<SymbolType, Child>::push_symbol(symbol);
 			remove_waves(number_of_waves);
 		}
 
@@ -130,7 +192,7 @@ template <typename WaveType, typename SymbolType> class PulseClassificationParse
 		*/
 		void push_wave(WaveType wave) {
 			wave_queue_.push_back(wave);
-			inspect_waves(wave_queue_);
+			static_cast<Child *>(this)->inspect_waves(wave_queue_);
 		}
 
 		/*!
@@ -140,19 +202,19 @@ template <typename WaveType, typename SymbolType> class PulseClassificationParse
 			do not form a valid symbol.
 		*/
 		void remove_waves(int number_of_waves) {
-			wave_queue_.erase(wave_queue_.begin(), wave_queue_.begin()+number_of_waves);
+			wave_queue_.pop_front(std::size_t(number_of_waves));
 		}
 
 	private:
-		/*!
-			Should be implemented by subclasses. Inspects @c waves for a potential new symbol. If one is
-			found should call @c push_symbol. May wish alternatively to call @c remove_waves to have entries
-			removed from the start of @c waves that cannot form a valid symbol. Need not do anything while
-			the waves at the start of @c waves may end up forming a symbol but the symbol is not yet complete.
+		/*
+			inspect_waves should be implemented by subclasses. It inspects @c waves for a potential new symbol.
+			If one is found it should call @c push_symbol. It may wish alternatively to call @c remove_waves to
+			have entries removed from the start of @c waves that cannot form a valid symbol. It need not do
+			anything while the waves at the start of @c waves may end up forming a symbol but the symbol is not
+			yet complete.
 		*/
-		virtual void inspect_waves(const std::vector<WaveType> &waves) = 0;
 
-		std::vector<WaveType> wave_queue_;
+		WaveQueue<WaveType> wave_queue_;
 };
 
 }
@@ -49,7 +49,7 @@ void Parser::mark_end() {
 	push_wave(WaveType::LongGap);
 }
 
-void Parser::inspect_waves(const std::vector<WaveType> &waves) {
+void Parser::inspect_waves(const Storage::Tape::WaveQueue<WaveType> &waves) {
 	// A long gap is a file gap.
 	if(waves[0] == WaveType::LongGap) {
 		push_symbol(SymbolType::FileGap, 1);
@@ -27,7 +27,7 @@ enum class SymbolType {
 	One, Zero, FileGap, Unrecognised
 };
 
-class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType> {
+class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser> {
 	public:
 		Parser();
 
@@ -44,13 +44,16 @@ class Parser: public Storage::Tape::PulseClassificationParser<WaveType, SymbolTy
 		std::shared_ptr<Storage::Data::ZX8081::File> get_next_file(const std::shared_ptr<Storage::Tape::Tape> &tape);
 
 	private:
+		friend Storage::Tape::Parser<SymbolType, Parser>;
+		friend Storage::Tape::PulseClassificationParser<WaveType, SymbolType, Parser>;
+
 		bool pulse_was_high_;
 		Time pulse_time_;
 		void post_pulse();
 
-		void process_pulse(const Storage::Tape::Tape::Pulse &pulse) override;
-		void mark_end() override;
-		void inspect_waves(const std::vector<WaveType> &waves) override;
+		void process_pulse(const Storage::Tape::Tape::Pulse &pulse);
+		void mark_end();
+		void inspect_waves(const Storage::Tape::WaveQueue<WaveType> &waves);
 
 		std::shared_ptr<std::vector<uint8_t>> get_next_file_data(const std::shared_ptr<Storage::Tape::Tape> &tape);
 };
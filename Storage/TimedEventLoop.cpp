@@ -49,6 +49,15 @@ Cycles::IntType TimedEventLoop::get_cycles_until_next_event() const {
 	return std::max(cycles_until_event_, Cycles::IntType(0));
 }
 
+float TimedEventLoop::get_subcycles_until_next_event() const {
+	return subcycles_until_event_;
+}
+
+void TimedEventLoop::set_time_until_next_event(Cycles::IntType cycles, float subcycles) {
+	cycles_until_event_ = std::max(cycles, Cycles::IntType(0));
+	subcycles_until_event_ = std::clamp(subcycles, 0.0f, 1.0f);
+}
+
 Cycles::IntType TimedEventLoop::get_input_clock_rate() const {
 	return input_clock_rate_;
 }
@@ -100,6 +100,18 @@ namespace Storage {
 			*/
 			Time get_time_into_next_event();
 
+			/*!
+				@returns the fractional part of the time remaining until the next event, in cycles; the whole
+				part is given by @c get_cycles_until_next_event.
+			*/
+			float get_subcycles_until_next_event() const;
+
+			/*!
+				Sets the time remaining until the next event to @c cycles whole cycles plus @c subcycles; this
+				is for restoring the timing of an event that has already been set up, e.g. after a snapshot.
+			*/
+			void set_time_until_next_event(Cycles::IntType cycles, float subcycles);
+
 		private:
 			Cycles::IntType input_clock_rate_ = 0;
 			Cycles::IntType cycles_until_event_ = 0;